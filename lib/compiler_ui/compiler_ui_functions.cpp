@@ -6,6 +6,8 @@
 
 #include <argparser/ArgParser.hpp>
 
+#include "lib/lexer/TokenBuffer.hpp"
+#include "lib/lexer/source/SourceManager.hpp"
 #include "lib/parser/ParserFsm.hpp"
 #include "lib/parser/ast/BuilderAstFactory.hpp"
 #include "lib/parser/ast/visitors/BytecodeVisitor.hpp"
@@ -14,9 +16,9 @@
 #include "lib/parser/diagnostics/DiagnosticCollector.hpp"
 #include "lib/parser/pratt/DefaultOperatorResolver.hpp"
 #include "lib/parser/pratt/PrattExpressionParser.hpp"
-#include "lib/parser/tokens/token_streams/VectorTokenStream.hpp"
 #include "lib/parser/type_parser/QNameTypeParser.hpp"
 #include "lib/preprocessor/Preprocessor.hpp"
+#include "lib/preprocessor/preprocessed_artifact.hpp"
 
 static void PrintDiagnosticMessage(const ovum::compiler::parser::Diagnostic& diag, std::ostream& out) {
   if (diag.IsSuppressed()) {
@@ -37,10 +39,6 @@ static void PrintDiagnosticMessage(const ovum::compiler::parser::Diagnostic& dia
   if (where_opt.has_value()) {
     const ovum::compiler::parser::SourceSpan& where = where_opt.value();
 
-    if (!where.GetSourceId().Path().empty()) {
-      out << " \nAt " << where.GetSourceId().Path();
-    }
-
     if (where.GetStart() == where.GetEnd()) {
       out << " line " << where.GetStart().GetLine() << " column " << where.GetStart().GetColumn();
     } else {
@@ -60,6 +58,9 @@ int32_t StartCompilerConsoleUI(const std::vector<std::string>& args, std::ostrea
   std::vector<CompositeString> include_dirs;
   std::vector<std::string> define_symbols;
   std::vector<bool> no_lint;
+  std::vector<CompositeString> token_cache_dirs;
+  std::vector<CompositeString> emit_preprocessed_files;
+  std::vector<bool> from_preprocessed;
 
   ArgumentParser::ArgParser arg_parser("ovumc", PassArgumentTypes());
   arg_parser.AddCompositeArgument('m', "main-file", "Path to the main file").AddIsGood(is_file).AddValidate(is_file);
@@ -71,6 +72,15 @@ int32_t StartCompilerConsoleUI(const std::vector<std::string>& args, std::ostrea
       .StoreValues(include_dirs);
   arg_parser.AddStringArgument('D', "define-symbols", "Defined symbols").MultiValue(0).StoreValues(define_symbols);
   arg_parser.AddFlag('n', "no-lint", "Disable linter").MultiValue(0).StoreValues(no_lint);
+  arg_parser.AddCompositeArgument('c', "token-cache", "Directory where lexed imports are cached by content hash")
+      .MultiValue(0)
+      .StoreValues(token_cache_dirs);
+  arg_parser.AddCompositeArgument('E', "emit-preprocessed", "Write the preprocessed tokens to this file and stop")
+      .MultiValue(0)
+      .StoreValues(emit_preprocessed_files);
+  arg_parser.AddFlag('P', "from-preprocessed", "Main file is a token file written by --emit-preprocessed")
+      .MultiValue(0)
+      .StoreValues(from_preprocessed);
   arg_parser.AddHelp('h', "help", description);
 
   bool parse_result = arg_parser.Parse(args, {.out_stream = err, .print_messages = true});
@@ -109,19 +119,56 @@ int32_t StartCompilerConsoleUI(const std::vector<std::string>& args, std::ostrea
 
   include_paths.emplace(main_file.parent_path());
 
-  ovum::compiler::preprocessor::PreprocessingParameters params{
-      .include_paths = include_paths, .predefined_symbols = predefined_symbols, .main_file = main_file};
+  std::filesystem::path token_cache_dir;
 
-  ovum::compiler::preprocessor::Preprocessor preprocessor(params);
+  if (!token_cache_dirs.empty()) {
+    token_cache_dir = token_cache_dirs.back().c_str();
+  }
+
+  ovum::compiler::lexer::SourceManager sources;
+  ovum::compiler::lexer::TokenBuffer tokens;
 
-  auto result = preprocessor.Process();
+  if (!from_preprocessed.empty() && from_preprocessed[0]) {
+    auto read_result = ovum::compiler::preprocessor::ReadPreprocessedArtifact(main_file, sources);
+
+    if (!read_result) {
+      err << read_result.error().what() << "\n";
+      return 2;
+    }
 
-  if (!result) {
-    err << result.error().what() << "\n";
-    return 2;
+    tokens = std::move(read_result.value());
+  } else {
+    ovum::compiler::preprocessor::PreprocessingParameters params{.include_paths = include_paths,
+                                                                 .predefined_symbols = predefined_symbols,
+                                                                 .main_file = main_file,
+                                                                 .import_threads = 0,
+                                                                 .token_cache_dir = token_cache_dir,
+                                                                 .include_resolver = nullptr};
+
+    // The whole buffer is built before parsing: the import stage has to see every #import of the main file before
+    // emitting anything, and the parser wants random access (parallel pre-scan, lazy bodies, the -P artifact).
+    ovum::compiler::preprocessor::Preprocessor preprocessor(params);
+    auto result = preprocessor.Process(sources);
+
+    if (!result) {
+      err << result.error().what() << "\n";
+      return 2;
+    }
+
+    tokens = std::move(result.value());
   }
 
-  std::vector<ovum::TokenPtr> tokens = std::move(result.value());
+  if (!emit_preprocessed_files.empty()) {
+    const std::filesystem::path artifact_file = emit_preprocessed_files.back().c_str();
+    auto write_result = ovum::compiler::preprocessor::WritePreprocessedArtifact(tokens, artifact_file);
+
+    if (!write_result) {
+      err << write_result.error().what() << "\n";
+      return 1;
+    }
+
+    return 0;
+  }
 
   // Set up parser
   auto factory = std::make_shared<ovum::compiler::parser::BuilderAstFactory>();
@@ -131,11 +178,11 @@ int32_t StartCompilerConsoleUI(const std::vector<std::string>& args, std::ostrea
       std::make_unique<ovum::compiler::parser::PrattExpressionParser>(std::move(resolver), factory, type_parser.get());
   auto parser =
       std::make_unique<ovum::compiler::parser::ParserFsm>(std::move(expr_parser), std::move(type_parser), factory);
+  parser->EnableParallelParse(ovum::compiler::parser::MakeDefaultParserComponents);
 
   // Parse
   ovum::compiler::parser::DiagnosticCollector diags;
-  ovum::compiler::parser::VectorTokenStream stream(tokens);
-  auto module = parser->Parse(stream, diags);
+  auto module = parser->Parse(tokens, diags);
 
   if (!module) {
     err << "Parsing failed\n";
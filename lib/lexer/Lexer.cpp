@@ -1,10 +1,11 @@
 #include "Lexer.hpp"
 
-#include <string>
+#include <string_view>
 #include <utility>
 
 #include <tokens/TokenFactory.hpp>
 
+#include "char_class.hpp"
 #include "handlers/CharHandler.hpp"
 #include "handlers/ColonHandler.hpp"
 #include "handlers/DefaultHandler.hpp"
@@ -17,42 +18,90 @@
 #include "handlers/SlashHandler.hpp"
 #include "handlers/StringHandler.hpp"
 #include "handlers/WhitespaceHandler.hpp"
+#include "token_materializer.hpp"
+#include "token_view_scanner.hpp"
 
 namespace ovum::compiler::lexer {
 
-namespace {
-constexpr const char* kOperatorChars = "+-*%<>=!&|^~?";
-constexpr const char* kPunctChars = ",;(){}[]";
-} // namespace
-
-Lexer::Lexer(std::string_view src, bool keep_comments) :
-    wrapper_(src, keep_comments), handlers_(MakeDefaultHandlers()), default_handler_(MakeDefaultHandler()) {
+Lexer::Lexer(std::string_view src, bool keep_comments, LexerEngine engine) :
+    wrapper_(src, keep_comments), handlers_(MakeDefaultHandlers()), default_handler_(MakeDefaultHandler()),
+    engine_(engine) {
 }
 
 std::expected<std::vector<TokenPtr>, LexerError> Lexer::Tokenize() {
+  if (engine_ == LexerEngine::kHandlers) {
+    return TokenizeWithHandlers();
+  }
+
+  if (parallel_options_ && custom_handler_chars_.none() && !custom_default_handler_) {
+    if (auto views = TryTokenizeViewsParallel(wrapper_.GetSource(), wrapper_.IsKeepComments(), *parallel_options_)) {
+      return MaterializeInParallel(*views);
+    }
+  }
+
+  return TokenizeWithTable();
+}
+
+void Lexer::SetHandler(unsigned char ch, std::unique_ptr<Handler> handler) {
+  handlers_.at(ch) = std::move(handler);
+  custom_handler_chars_.set(ch);
+}
+
+void Lexer::SetDefaultHandler(std::unique_ptr<Handler> handler) {
+  default_handler_ = std::move(handler);
+  custom_default_handler_ = true;
+}
+
+void Lexer::EnableParallel(const ParallelLexOptions& options) {
+  parallel_options_ = options;
+}
+
+std::expected<std::vector<TokenPtr>, LexerError> Lexer::TokenizeWithTable() {
   std::vector<TokenPtr> tokens;
   tokens.reserve(kDefaultTokenReserve);
+  std::vector<TokenView> scanned;
+  const std::string_view src = wrapper_.GetSource();
 
   while (!wrapper_.IsAtEnd()) {
     wrapper_.ResetTokenPosition();
 
-    char ch_read = wrapper_.Advance();
-    Handler* current_handler = handlers_.at(static_cast<unsigned char>(ch_read)).get();
+    const char ch_read = wrapper_.Advance();
+    const auto ch = static_cast<unsigned char>(ch_read);
+
+    if (custom_handler_chars_.test(ch) || ClassifyChar(ch_read) == CharClass::kInvalid) {
+      if (auto scan_result = ScanWithHandler(ch, tokens); !scan_result) {
+        return std::unexpected(scan_result.error());
+      }
 
-    if (!current_handler) {
-      current_handler = default_handler_.get();
+      continue;
     }
 
-    auto maybe_token_result = current_handler->Scan(wrapper_);
+    scanned.clear();
 
-    if (!maybe_token_result) {
-      return std::unexpected(maybe_token_result.error());
+    if (auto scan_result = ScanTokenView(wrapper_, ch_read, scanned); !scan_result) {
+      return std::unexpected(scan_result.error());
     }
 
-    OptToken maybe_token = maybe_token_result.value();
+    for (const TokenView& view : scanned) {
+      tokens.push_back(MaterializeToken(view, src));
+    }
+  }
+
+  tokens.push_back(TokenFactory::MakeEof(wrapper_.GetLine(), wrapper_.GetCol()));
+  return tokens;
+}
+
+std::expected<std::vector<TokenPtr>, LexerError> Lexer::TokenizeWithHandlers() {
+  std::vector<TokenPtr> tokens;
+  tokens.reserve(kDefaultTokenReserve);
+
+  while (!wrapper_.IsAtEnd()) {
+    wrapper_.ResetTokenPosition();
+
+    const char ch_read = wrapper_.Advance();
 
-    if (maybe_token && *maybe_token) {
-      tokens.push_back(std::move(*maybe_token));
+    if (auto scan_result = ScanWithHandler(static_cast<unsigned char>(ch_read), tokens); !scan_result) {
+      return std::unexpected(scan_result.error());
     }
   }
 
@@ -60,12 +109,42 @@ std::expected<std::vector<TokenPtr>, LexerError> Lexer::Tokenize() {
   return tokens;
 }
 
-void Lexer::SetHandler(unsigned char ch, std::unique_ptr<Handler> handler) {
-  handlers_.at(ch) = std::move(handler);
+std::vector<TokenPtr> Lexer::MaterializeInParallel(const std::vector<TokenView>& views) const {
+  const std::string_view src = wrapper_.GetSource();
+  const std::size_t chunks = ParallelLexThreadCount(*parallel_options_);
+  std::vector<TokenPtr> tokens(views.size());
+
+  RunChunksInParallel(chunks, chunks, [&](std::size_t chunk) {
+    const std::size_t end = views.size() * (chunk + 1) / chunks;
+
+    for (std::size_t i = views.size() * chunk / chunks; i < end; ++i) {
+      tokens[i] = MaterializeToken(views[i], src);
+    }
+  });
+
+  return tokens;
 }
 
-void Lexer::SetDefaultHandler(std::unique_ptr<Handler> handler) {
-  default_handler_ = std::move(handler);
+std::expected<void, LexerError> Lexer::ScanWithHandler(unsigned char ch, std::vector<TokenPtr>& tokens) {
+  Handler* current_handler = handlers_[ch].get();
+
+  if (!current_handler) {
+    current_handler = default_handler_.get();
+  }
+
+  auto maybe_token_result = current_handler->Scan(wrapper_);
+
+  if (!maybe_token_result) {
+    return std::unexpected(maybe_token_result.error());
+  }
+
+  OptToken maybe_token = std::move(maybe_token_result.value());
+
+  if (maybe_token && *maybe_token) {
+    tokens.push_back(std::move(*maybe_token));
+  }
+
+  return {};
 }
 
 std::array<std::unique_ptr<Handler>, kDefaultTokenReserve> Lexer::MakeDefaultHandlers() {
@@ -99,12 +178,12 @@ std::array<std::unique_ptr<Handler>, kDefaultTokenReserve> Lexer::MakeDefaultHan
 
   table.at(':') = std::make_unique<ColonHandler>();
 
-  for (const unsigned char ch : std::string(kOperatorChars)) {
-    table.at(ch) = std::make_unique<OperatorHandler>();
+  for (const char ch : kOperatorStartChars) {
+    table.at(static_cast<unsigned char>(ch)) = std::make_unique<OperatorHandler>();
   }
 
-  for (const unsigned char ch : std::string(kPunctChars)) {
-    table.at(ch) = std::make_unique<PunctHandler>();
+  for (const char ch : kPunctChars) {
+    table.at(static_cast<unsigned char>(ch)) = std::make_unique<PunctHandler>();
   }
 
   return table;
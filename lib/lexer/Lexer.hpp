@@ -2,9 +2,12 @@
 #define LEXER_LEXER_HPP_
 
 #include <array>
+#include <bitset>
 #include <cstddef>
+#include <cstdint>
 #include <expected>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -12,7 +15,9 @@
 
 #include "LexerError.hpp"
 #include "SourceCodeWrapper.hpp"
+#include "TokenView.hpp"
 #include "handlers/Handler.hpp"
+#include "parallel_lexer.hpp"
 
 namespace ovum::compiler::lexer {
 
@@ -20,9 +25,13 @@ using TokenPtr = ovum::TokenPtr;
 
 constexpr std::size_t kDefaultTokenReserve = 256;
 
+// kTable classifies characters through a constexpr table and scans inline; handlers installed with SetHandler
+// still take precedence for their characters. kHandlers dispatches every token through the handler table.
+enum class LexerEngine : std::uint8_t { kTable, kHandlers };
+
 class Lexer {
 public:
-  explicit Lexer(std::string_view src, bool keep_comments = false);
+  explicit Lexer(std::string_view src, bool keep_comments = false, LexerEngine engine = LexerEngine::kTable);
 
   std::expected<std::vector<TokenPtr>, LexerError> Tokenize();
 
@@ -30,7 +39,19 @@ public:
 
   void SetDefaultHandler(std::unique_ptr<Handler> handler);
 
+  // Lets the table engine lex sources above options.threshold on several threads. The tokens are identical to the
+  // serial ones; custom handlers keep the lexer serial.
+  void EnableParallel(const ParallelLexOptions& options = {});
+
 private:
+  std::expected<std::vector<TokenPtr>, LexerError> TokenizeWithTable();
+
+  std::expected<std::vector<TokenPtr>, LexerError> TokenizeWithHandlers();
+
+  std::vector<TokenPtr> MaterializeInParallel(const std::vector<TokenView>& views) const;
+
+  std::expected<void, LexerError> ScanWithHandler(unsigned char ch, std::vector<TokenPtr>& tokens);
+
   static std::array<std::unique_ptr<Handler>, kDefaultTokenReserve> MakeDefaultHandlers();
 
   static std::unique_ptr<Handler> MakeDefaultHandler();
@@ -38,6 +59,10 @@ private:
   SourceCodeWrapper wrapper_;
   std::array<std::unique_ptr<Handler>, kDefaultTokenReserve> handlers_{};
   std::unique_ptr<Handler> default_handler_;
+  std::bitset<kDefaultTokenReserve> custom_handler_chars_;
+  bool custom_default_handler_{false};
+  std::optional<ParallelLexOptions> parallel_options_;
+  LexerEngine engine_;
 };
 
 } // namespace ovum::compiler::lexer
@@ -0,0 +1,37 @@
+#include "LineIndex.hpp"
+
+#include <algorithm>
+
+#include "scan_kernels.hpp"
+
+namespace ovum::compiler::lexer {
+
+LineIndex::LineIndex(std::string_view src) : size_(src.size()) {
+  for (std::size_t pos = FindLineEnd(src, 0); pos < src.size(); pos = FindLineEnd(src, pos + 1)) {
+    line_starts_.push_back(static_cast<uint32_t>(pos + 1));
+  }
+}
+
+LineColumn LineIndex::Locate(std::size_t offset) const noexcept {
+  offset = std::min(offset, size_);
+
+  const auto next_line = std::upper_bound(line_starts_.begin(), line_starts_.end(), offset);
+  const auto line = static_cast<std::size_t>(next_line - line_starts_.begin());
+
+  return LineColumn{.line = static_cast<int32_t>(line),
+                    .column = static_cast<int32_t>(offset - line_starts_[line - 1] + 1)};
+}
+
+std::size_t LineIndex::LineCount() const noexcept {
+  return line_starts_.size();
+}
+
+std::size_t LineIndex::LineStart(int32_t line) const noexcept {
+  if (line < 1) {
+    return 0;
+  }
+
+  return line_starts_[std::min(static_cast<std::size_t>(line), line_starts_.size()) - 1];
+}
+
+} // namespace ovum::compiler::lexer
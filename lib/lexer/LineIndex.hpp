@@ -0,0 +1,39 @@
+#ifndef LEXER_LINEINDEX_HPP_
+#define LEXER_LINEINDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace ovum::compiler::lexer {
+
+struct LineColumn {
+  int32_t line = 1;
+  int32_t column = 1;
+};
+
+// Start offsets of every line of one source, so byte offsets can be turned into 1-based line/column pairs on demand
+// instead of being tracked character by character while lexing.
+class LineIndex {
+public:
+  LineIndex() = default;
+
+  explicit LineIndex(std::string_view src);
+
+  // Offsets past the end map to the position just after the last character, like the lexer's EOF token.
+  [[nodiscard]] LineColumn Locate(std::size_t offset) const noexcept;
+
+  [[nodiscard]] std::size_t LineCount() const noexcept;
+
+  // Offset of the first character of the 1-based line.
+  [[nodiscard]] std::size_t LineStart(int32_t line) const noexcept;
+
+private:
+  std::vector<uint32_t> line_starts_{0};
+  std::size_t size_{0};
+};
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_LINEINDEX_HPP_
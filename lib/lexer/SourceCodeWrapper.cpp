@@ -2,16 +2,9 @@
 
 #include <algorithm>
 
-namespace ovum::compiler::lexer {
-
-const std::unordered_set<std::string_view> SourceCodeWrapper::kKeywords = {
-    "fun",        "class",   "interface", "var",    "override", "pure",    "if",     "else",      "continue",
-    "break",      "for",     "while",     "return", "unsafe",   "val",     "static", "public",    "private",
-    "implements", "as",      "is",        "in",     "null",     "true",    "false",  "typealias", "destructor",
-    "call",       "#import", "#define",   "#undef", "#ifdef",   "#ifndef", "#else",  "#endif",    "this"};
+#include "lexeme_recognizer.hpp"
 
-const std::unordered_set<std::string_view> SourceCodeWrapper::kMultiOps = {
-    "*=", "+=", "-=", "/=", "==", "!=", "<=", ">=", "&&", "||", "?:", "?.", "::", ":=", "<<", ">>"};
+namespace ovum::compiler::lexer {
 
 SourceCodeWrapper::SourceCodeWrapper(std::string_view src, bool keep_comments) :
     src_(src), keep_comments_(keep_comments) {
@@ -46,6 +39,10 @@ char SourceCodeWrapper::Advance() {
 
   char c = src_[current_++];
 
+  if (!track_positions_) {
+    return c;
+  }
+
   if (c == '\n') {
     ++line_;
     col_ = 1;
@@ -64,6 +61,10 @@ void SourceCodeWrapper::RetreatOne() {
   const char was = src_[current_ - 1];
   --current_;
 
+  if (!track_positions_) {
+    return;
+  }
+
   if (was == '\n') {
     line_ = std::max<int32_t>(1, line_ - 1);
     size_t i = current_;
@@ -81,10 +82,23 @@ void SourceCodeWrapper::RetreatOne() {
   col_ = std::max<int32_t>(1, col_ - 1);
 }
 
-void SourceCodeWrapper::ConsumeWhile(std::string& out, const std::function<bool(char)>& pred) {
-  while (!IsAtEnd() && pred(Peek())) {
-    out.push_back(Advance());
+void SourceCodeWrapper::AdvanceInLine(size_t end) noexcept {
+  if (track_positions_) {
+    col_ += static_cast<int32_t>(end - current_);
+  }
+
+  current_ = end;
+}
+
+void SourceCodeWrapper::AdvanceOver(const ScanRun& run) noexcept {
+  if (run.newlines == 0 || !track_positions_) {
+    AdvanceInLine(run.end);
+    return;
   }
+
+  line_ += static_cast<int32_t>(run.newlines);
+  col_ = static_cast<int32_t>(run.end - run.last_newline);
+  current_ = run.end;
 }
 
 void SourceCodeWrapper::ResetTokenPosition() {
@@ -112,16 +126,37 @@ int32_t SourceCodeWrapper::GetTokenCol() const noexcept {
   return token_col_;
 }
 
+size_t SourceCodeWrapper::GetOffset() const noexcept {
+  return current_;
+}
+
+size_t SourceCodeWrapper::GetTokenStart() const noexcept {
+  return start_;
+}
+
+std::string_view SourceCodeWrapper::GetSource() const noexcept {
+  return src_;
+}
+
 bool SourceCodeWrapper::IsKeepComments() const noexcept {
   return keep_comments_;
 }
 
+bool SourceCodeWrapper::IsTrackingPositions() const noexcept {
+  return track_positions_;
+}
+
+void SourceCodeWrapper::SetTrackPositions(bool track_positions) noexcept {
+  track_positions_ = track_positions;
+}
+
 bool SourceCodeWrapper::IsKeyword(std::string_view s) {
-  return kKeywords.contains(s);
+  const WordClass word_class = ClassifyWord(s);
+  return word_class == WordClass::kKeyword || word_class == WordClass::kBoolLiteral;
 }
 
 bool SourceCodeWrapper::IsMultiOp(std::string_view s) {
-  return kMultiOps.contains(s);
+  return s.size() == 2 && IsMultiOpPair(s[0], s[1]);
 }
 
 } // namespace ovum::compiler::lexer
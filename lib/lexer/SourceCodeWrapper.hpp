@@ -2,13 +2,14 @@
 #define LEXER_SOURCECODEWRAPPER_HPP_
 
 #include <cstdint>
-#include <functional>
 #include <string>
 #include <string_view>
-#include <unordered_set>
+
+#include "scan_kernels.hpp"
 
 namespace ovum::compiler::lexer {
 
+
 class SourceCodeWrapper {
 public:
   SourceCodeWrapper(std::string_view src, bool keep_comments = false);
@@ -23,7 +24,21 @@ public:
 
   void RetreatOne();
 
-  void ConsumeWhile(std::string& out, const std::function<bool(char)>& pred);
+  template<typename Predicate>
+  void ConsumeWhile(std::string& out, Predicate pred) {
+    const size_t begin = current_;
+
+    while (!IsAtEnd() && pred(Peek())) {
+      Advance();
+    }
+
+    out.append(src_.substr(begin, current_ - begin));
+  }
+
+  // Jumps to end, which must not be past the next newline; used with the vectorized scan kernels.
+  void AdvanceInLine(size_t end) noexcept;
+
+  void AdvanceOver(const ScanRun& run) noexcept;
 
   void ResetTokenPosition();
 
@@ -35,8 +50,20 @@ public:
 
   [[nodiscard]] int32_t GetTokenCol() const noexcept;
 
+  [[nodiscard]] size_t GetOffset() const noexcept;
+
+  [[nodiscard]] size_t GetTokenStart() const noexcept;
+
+  [[nodiscard]] std::string_view GetSource() const noexcept;
+
   [[nodiscard]] bool IsKeepComments() const noexcept;
 
+  // With tracking off only offsets advance: GetLine/GetCol/GetTokenCol stay at 1 and positions are recovered later
+  // from a LineIndex.
+  [[nodiscard]] bool IsTrackingPositions() const noexcept;
+
+  void SetTrackPositions(bool track_positions) noexcept;
+
   [[nodiscard]] static bool IsKeyword(std::string_view s);
 
   [[nodiscard]] static bool IsMultiOp(std::string_view s);
@@ -45,14 +72,12 @@ private:
   std::string_view src_;
 
   bool keep_comments_;
+  bool track_positions_{true};
   size_t start_{0};
   size_t current_{0};
   int32_t line_{1};
   int32_t col_{1};
   int32_t token_col_{1};
-
-  static const std::unordered_set<std::string_view> kKeywords;
-  static const std::unordered_set<std::string_view> kMultiOps;
 };
 
 } // namespace ovum::compiler::lexer
@@ -0,0 +1,179 @@
+#include "TokenBuffer.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace ovum::compiler::lexer {
+
+namespace {
+
+constexpr std::uint32_t kCommentOpenerLength = 2;
+
+} // namespace
+
+TokenBuffer::SourceIndex TokenBuffer::AddSource(std::string_view text) {
+  return AddSource(text, std::make_shared<const LineIndex>(text));
+}
+
+void TokenBuffer::Reserve(std::size_t count) {
+  kinds_.reserve(count);
+  offsets_.reserve(count);
+  lengths_.reserve(count);
+  source_of_.reserve(count);
+}
+
+void TokenBuffer::Append(const TokenView& view, SourceIndex source) {
+  kinds_.push_back(view.kind);
+  offsets_.push_back(view.offset);
+  lengths_.push_back(view.length);
+  source_of_.push_back(source);
+}
+
+void TokenBuffer::AppendRange(const TokenBuffer& other, std::size_t begin, std::size_t end) {
+  end = std::min(end, other.Size());
+
+  if (begin >= end) {
+    return;
+  }
+
+  std::vector<SourceIndex> remap(other.sources_.size());
+
+  for (SourceIndex source = 0; source < other.sources_.size(); ++source) {
+    remap[source] = FindOrAddSource(other, source);
+  }
+
+  kinds_.insert(kinds_.end(), other.kinds_.begin() + begin, other.kinds_.begin() + end);
+  offsets_.insert(offsets_.end(), other.offsets_.begin() + begin, other.offsets_.begin() + end);
+  lengths_.insert(lengths_.end(), other.lengths_.begin() + begin, other.lengths_.begin() + end);
+
+  for (std::size_t i = begin; i < end; ++i) {
+    source_of_.push_back(remap[other.source_of_[i]]);
+  }
+}
+
+TokenBuffer TokenBuffer::Select(const std::vector<std::size_t>& indices) const {
+  TokenBuffer selected;
+  selected.sources_ = sources_;
+  selected.line_indexes_ = line_indexes_;
+  selected.Reserve(indices.size());
+
+  for (const std::size_t index : indices) {
+    selected.kinds_.push_back(kinds_[index]);
+    selected.offsets_.push_back(offsets_[index]);
+    selected.lengths_.push_back(lengths_[index]);
+    selected.source_of_.push_back(source_of_[index]);
+  }
+
+  return selected;
+}
+
+void TokenBuffer::Clear() noexcept {
+  kinds_.clear();
+  offsets_.clear();
+  lengths_.clear();
+  source_of_.clear();
+  sources_.clear();
+  line_indexes_.clear();
+}
+
+std::size_t TokenBuffer::Size() const noexcept {
+  return kinds_.size();
+}
+
+bool TokenBuffer::IsEmpty() const noexcept {
+  return kinds_.empty();
+}
+
+TokenKind TokenBuffer::Kind(std::size_t index) const noexcept {
+  return kinds_[index];
+}
+
+std::uint32_t TokenBuffer::Offset(std::size_t index) const noexcept {
+  return offsets_[index];
+}
+
+std::uint32_t TokenBuffer::Length(std::size_t index) const noexcept {
+  return lengths_[index];
+}
+
+LineColumn TokenBuffer::Position(std::size_t index) const noexcept {
+  const LineIndex& lines = *line_indexes_[source_of_[index]];
+
+  if (kinds_[index] != TokenKind::kComment) {
+    return lines.Locate(offsets_[index]);
+  }
+
+  // Comment views skip their "//" or "/*" opener, but the token starts at the opener. Like the lexer, which reports a
+  // comment once it has scanned it, a block comment is placed on the line where it ends.
+  LineColumn position = lines.Locate(offsets_[index] - kCommentOpenerLength);
+  position.line = lines.Locate(offsets_[index] + lengths_[index]).line;
+
+  return position;
+}
+
+std::int32_t TokenBuffer::Line(std::size_t index) const noexcept {
+  return Position(index).line;
+}
+
+std::int32_t TokenBuffer::Column(std::size_t index) const noexcept {
+  return Position(index).column;
+}
+
+TokenBuffer::SourceIndex TokenBuffer::SourceOf(std::size_t index) const noexcept {
+  return source_of_[index];
+}
+
+std::string_view TokenBuffer::Source(SourceIndex source) const noexcept {
+  return sources_[source];
+}
+
+std::size_t TokenBuffer::SourceCount() const noexcept {
+  return sources_.size();
+}
+
+const LineIndex& TokenBuffer::Lines(SourceIndex source) const noexcept {
+  return *line_indexes_[source];
+}
+
+std::string_view TokenBuffer::Lexeme(std::size_t index) const noexcept {
+  return sources_[source_of_[index]].substr(offsets_[index], lengths_[index]);
+}
+
+TokenView TokenBuffer::View(std::size_t index) const noexcept {
+  const LineColumn position = Position(index);
+
+  return TokenView{.kind = kinds_[index],
+                   .offset = offsets_[index],
+                   .length = lengths_[index],
+                   .line = position.line,
+                   .column = position.column};
+}
+
+std::span<const TokenKind> TokenBuffer::Kinds() const noexcept {
+  return kinds_;
+}
+
+std::size_t TokenBuffer::MemoryUsage() const noexcept {
+  return kinds_.capacity() * sizeof(TokenKind) + offsets_.capacity() * sizeof(std::uint32_t) +
+         lengths_.capacity() * sizeof(std::uint32_t) + source_of_.capacity() * sizeof(SourceIndex);
+}
+
+TokenBuffer::SourceIndex TokenBuffer::AddSource(std::string_view text, std::shared_ptr<const LineIndex> lines) {
+  sources_.push_back(text);
+  line_indexes_.push_back(std::move(lines));
+  return static_cast<SourceIndex>(sources_.size() - 1);
+}
+
+TokenBuffer::SourceIndex TokenBuffer::FindOrAddSource(const TokenBuffer& other, SourceIndex source) {
+  const std::string_view text = other.sources_[source];
+
+  for (SourceIndex known = 0; known < sources_.size(); ++known) {
+    if (sources_[known].data() == text.data() && sources_[known].size() == text.size()) {
+      return known;
+    }
+  }
+
+  return AddSource(text, other.line_indexes_[source]);
+}
+
+} // namespace ovum::compiler::lexer
@@ -0,0 +1,90 @@
+#ifndef LEXER_TOKENBUFFER_HPP_
+#define LEXER_TOKENBUFFER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "LineIndex.hpp"
+#include "TokenKind.hpp"
+#include "TokenView.hpp"
+
+namespace ovum::compiler::lexer {
+
+// Struct-of-arrays token storage: each field lives in its own array, 13 bytes per token in total, and token text is
+// read from the registered sources. Line and column are not stored: they are computed from the offset through the
+// source's LineIndex when asked for. Sources are not owned and must outlive the buffer (see SourceManager).
+class TokenBuffer {
+public:
+  using SourceIndex = std::uint32_t;
+
+  // Also builds the source's line index.
+  SourceIndex AddSource(std::string_view text);
+
+  void Reserve(std::size_t count);
+
+  // The view's line and column are ignored.
+  void Append(const TokenView& view, SourceIndex source);
+
+  // Copies tokens [begin, end) of other, registering the sources they point into.
+  void AppendRange(const TokenBuffer& other, std::size_t begin, std::size_t end);
+
+  // New buffer with the tokens at the given ascending indices, sharing this buffer's sources.
+  [[nodiscard]] TokenBuffer Select(const std::vector<std::size_t>& indices) const;
+
+  void Clear() noexcept;
+
+  [[nodiscard]] std::size_t Size() const noexcept;
+
+  [[nodiscard]] bool IsEmpty() const noexcept;
+
+  [[nodiscard]] TokenKind Kind(std::size_t index) const noexcept;
+
+  [[nodiscard]] std::uint32_t Offset(std::size_t index) const noexcept;
+
+  [[nodiscard]] std::uint32_t Length(std::size_t index) const noexcept;
+
+  // Where the token starts, except that a block comment is placed on its last line, as Lexer reports it.
+  [[nodiscard]] LineColumn Position(std::size_t index) const noexcept;
+
+  [[nodiscard]] std::int32_t Line(std::size_t index) const noexcept;
+
+  [[nodiscard]] std::int32_t Column(std::size_t index) const noexcept;
+
+  [[nodiscard]] SourceIndex SourceOf(std::size_t index) const noexcept;
+
+  [[nodiscard]] std::string_view Source(SourceIndex source) const noexcept;
+
+  [[nodiscard]] std::size_t SourceCount() const noexcept;
+
+  [[nodiscard]] const LineIndex& Lines(SourceIndex source) const noexcept;
+
+  [[nodiscard]] std::string_view Lexeme(std::size_t index) const noexcept;
+
+  // Resolves line and column, so prefer Kind/Offset/Length when positions are not needed.
+  [[nodiscard]] TokenView View(std::size_t index) const noexcept;
+
+  [[nodiscard]] std::span<const TokenKind> Kinds() const noexcept;
+
+  // Bytes held by the per-token arrays, excluding the sources themselves.
+  [[nodiscard]] std::size_t MemoryUsage() const noexcept;
+
+private:
+  SourceIndex AddSource(std::string_view text, std::shared_ptr<const LineIndex> lines);
+
+  SourceIndex FindOrAddSource(const TokenBuffer& other, SourceIndex source);
+
+  std::vector<TokenKind> kinds_;
+  std::vector<std::uint32_t> offsets_;
+  std::vector<std::uint32_t> lengths_;
+  std::vector<SourceIndex> source_of_;
+  std::vector<std::string_view> sources_;
+  std::vector<std::shared_ptr<const LineIndex>> line_indexes_;
+};
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_TOKENBUFFER_HPP_
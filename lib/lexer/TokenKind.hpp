@@ -0,0 +1,29 @@
+#ifndef LEXER_TOKENKIND_HPP_
+#define LEXER_TOKENKIND_HPP_
+
+#include <cstdint>
+
+namespace ovum::compiler::lexer {
+
+enum class TokenKind : std::uint8_t {
+  kIdent,
+  kKeyword,
+  kOperator,
+  kPunct,
+  kNewline,
+  kComment,
+  kEof,
+  kIntLiteral,
+  kFloatLiteral,
+  kStringLiteral,
+  kCharLiteral,
+  kBoolLiteral
+};
+
+[[nodiscard]] constexpr bool IsLiteralKind(TokenKind kind) noexcept {
+  return kind >= TokenKind::kIntLiteral;
+}
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_TOKENKIND_HPP_
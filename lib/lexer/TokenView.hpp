@@ -0,0 +1,22 @@
+#ifndef LEXER_TOKENVIEW_HPP_
+#define LEXER_TOKENVIEW_HPP_
+
+#include <cstdint>
+
+#include "TokenKind.hpp"
+
+namespace ovum::compiler::lexer {
+
+// Lexeme-free token record: the text lives in the source buffer at [offset, offset + length).
+// line and column are 0 when the lexer ran without position tracking; a LineIndex recovers them from offset.
+struct TokenView {
+  TokenKind kind = TokenKind::kEof;
+  uint32_t offset = 0;
+  uint32_t length = 0;
+  int32_t line = 1;
+  int32_t column = 1;
+};
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_TOKENVIEW_HPP_
@@ -0,0 +1,93 @@
+#include "ViewLexer.hpp"
+
+#include <cstdint>
+#include <limits>
+
+#include "Lexer.hpp"
+#include "token_view_scanner.hpp"
+
+namespace ovum::compiler::lexer {
+
+ViewLexer::ViewLexer(std::string_view src, bool keep_comments, bool track_positions) :
+    src_(src), wrapper_(src, keep_comments) {
+  wrapper_.SetTrackPositions(track_positions);
+}
+
+std::expected<std::vector<TokenView>, LexerError> ViewLexer::Tokenize() {
+  if (src_.size() > std::numeric_limits<uint32_t>::max()) {
+    return std::unexpected(LexerError("Source is too large"));
+  }
+
+  std::vector<TokenView> tokens;
+  tokens.reserve(kDefaultTokenReserve);
+
+  while (!wrapper_.IsAtEnd()) {
+    wrapper_.ResetTokenPosition();
+
+    const char ch_read = wrapper_.Advance();
+
+    if (auto scan_result = ScanTokenView(wrapper_, ch_read, tokens); !scan_result) {
+      return std::unexpected(scan_result.error());
+    }
+  }
+
+  tokens.push_back(MakeEofView(wrapper_));
+  return tokens;
+}
+
+std::expected<void, LexerError> ViewLexer::TokenizeInto(TokenBuffer& out) {
+  if (src_.size() > std::numeric_limits<uint32_t>::max()) {
+    return std::unexpected(LexerError("Source is too large"));
+  }
+
+  wrapper_.SetTrackPositions(false);
+
+  const TokenBuffer::SourceIndex source = out.AddSource(src_);
+  std::vector<TokenView> scanned;
+
+  while (!wrapper_.IsAtEnd()) {
+    wrapper_.ResetTokenPosition();
+
+    const char ch_read = wrapper_.Advance();
+    scanned.clear();
+
+    if (auto scan_result = ScanTokenView(wrapper_, ch_read, scanned); !scan_result) {
+      return std::unexpected(scan_result.error());
+    }
+
+    for (const TokenView& view : scanned) {
+      out.Append(view, source);
+    }
+  }
+
+  out.Append(MakeEofView(wrapper_), source);
+  return {};
+}
+
+std::expected<bool, LexerError> ViewLexer::TokenizeNext(std::vector<TokenView>& out) {
+  if (eof_emitted_) {
+    return false;
+  }
+
+  if (src_.size() > std::numeric_limits<uint32_t>::max()) {
+    return std::unexpected(LexerError("Source is too large"));
+  }
+
+  if (wrapper_.IsAtEnd()) {
+    out.push_back(MakeEofView(wrapper_));
+    eof_emitted_ = true;
+    return false;
+  }
+
+  wrapper_.ResetTokenPosition();
+
+  const char ch_read = wrapper_.Advance();
+
+  if (auto scan_result = ScanTokenView(wrapper_, ch_read, out); !scan_result) {
+    return std::unexpected(scan_result.error());
+  }
+
+  return true;
+}
+
+} // namespace ovum::compiler::lexer
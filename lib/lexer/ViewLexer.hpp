@@ -0,0 +1,41 @@
+#ifndef LEXER_VIEWLEXER_HPP_
+#define LEXER_VIEWLEXER_HPP_
+
+#include <cstddef>
+#include <expected>
+#include <string_view>
+#include <vector>
+
+#include "LexerError.hpp"
+#include "SourceCodeWrapper.hpp"
+#include "TokenBuffer.hpp"
+#include "TokenView.hpp"
+
+namespace ovum::compiler::lexer {
+
+// Produces the same token stream as Lexer, but as TokenView records pointing into the source buffer.
+// The source must outlive the returned views. Without track_positions the views only carry offsets, and line and
+// column come from a LineIndex over the source.
+class ViewLexer {
+public:
+  explicit ViewLexer(std::string_view src, bool keep_comments = false, bool track_positions = true);
+
+  std::expected<std::vector<TokenView>, LexerError> Tokenize();
+
+  // Registers the source with out and appends its tokens, EOF included. Positions are never tracked here: the
+  // buffer derives them from offsets.
+  std::expected<void, LexerError> TokenizeInto(TokenBuffer& out);
+
+  // Incremental form of Tokenize: appends the views of the next scanned token (none for whitespace and dropped
+  // comments), and the EOF view once the source is exhausted. Returns false after the EOF view was appended.
+  std::expected<bool, LexerError> TokenizeNext(std::vector<TokenView>& out);
+
+private:
+  std::string_view src_;
+  SourceCodeWrapper wrapper_;
+  bool eof_emitted_ = false;
+};
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_VIEWLEXER_HPP_
@@ -0,0 +1,80 @@
+#ifndef LEXER_CHAR_CLASS_HPP_
+#define LEXER_CHAR_CLASS_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ovum::compiler::lexer {
+
+// What a character can start; mirrors the handler table built by Lexer::MakeDefaultHandlers.
+enum class CharClass : std::uint8_t {
+  kInvalid,
+  kWhitespace,
+  kNewline,
+  kIdentStart,
+  kDigit,
+  kDot,
+  kQuote,
+  kApostrophe,
+  kSlash,
+  kColon,
+  kOperator,
+  kPunct
+};
+
+inline constexpr std::size_t kCharClassTableSize = 256;
+inline constexpr std::string_view kOperatorStartChars = "+-*%<>=!&|^~?";
+inline constexpr std::string_view kPunctChars = ",;(){}[]";
+
+consteval std::array<CharClass, kCharClassTableSize> BuildCharClassTable() {
+  std::array<CharClass, kCharClassTableSize> table{};
+  table.fill(CharClass::kInvalid);
+
+  table[' '] = CharClass::kWhitespace;
+  table['\t'] = CharClass::kWhitespace;
+  table['\r'] = CharClass::kWhitespace;
+  table['\n'] = CharClass::kNewline;
+
+  for (unsigned char ch = 'a'; ch <= 'z'; ++ch) {
+    table[ch] = CharClass::kIdentStart;
+  }
+
+  for (unsigned char ch = 'A'; ch <= 'Z'; ++ch) {
+    table[ch] = CharClass::kIdentStart;
+  }
+
+  table['_'] = CharClass::kIdentStart;
+  table['#'] = CharClass::kIdentStart;
+
+  for (unsigned char ch = '0'; ch <= '9'; ++ch) {
+    table[ch] = CharClass::kDigit;
+  }
+
+  table['.'] = CharClass::kDot;
+  table['"'] = CharClass::kQuote;
+  table['\''] = CharClass::kApostrophe;
+  table['/'] = CharClass::kSlash;
+  table[':'] = CharClass::kColon;
+
+  for (const char ch : kOperatorStartChars) {
+    table[static_cast<unsigned char>(ch)] = CharClass::kOperator;
+  }
+
+  for (const char ch : kPunctChars) {
+    table[static_cast<unsigned char>(ch)] = CharClass::kPunct;
+  }
+
+  return table;
+}
+
+inline constexpr std::array<CharClass, kCharClassTableSize> kCharClassTable = BuildCharClassTable();
+
+constexpr CharClass ClassifyChar(char ch) noexcept {
+  return kCharClassTable[static_cast<unsigned char>(ch)];
+}
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_CHAR_CLASS_HPP_
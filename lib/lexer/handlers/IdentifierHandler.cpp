@@ -1,36 +1,30 @@
 #include "IdentifierHandler.hpp"
 
-#include <cmath>
-#include <limits>
-
 #include <tokens/TokenFactory.hpp>
 
 #include "LexerError.hpp"
+#include "lexeme_recognizer.hpp"
+#include "literal_decoder.hpp"
+#include "scan_kernels.hpp"
 
 namespace ovum::compiler::lexer {
 
 std::expected<OptToken, LexerError> IdentifierHandler::Scan(SourceCodeWrapper& wrapper) {
-  std::string s;
-  s.push_back(wrapper.CurrentChar());
-  wrapper.ConsumeWhile(s, [](char ch) { return std::isalnum(static_cast<unsigned char>(ch)) || ch == '_'; });
-
-  if (s == "Inf" || s == "inf" || s == "Infinity" || s == "infinity") {
-    return std::make_optional(TokenFactory::MakeFloatLiteral(
-        s, std::numeric_limits<double>::infinity(), wrapper.GetLine(), wrapper.GetTokenCol()));
-  }
-
-  if (s == "NaN") {
-    return std::make_optional(
-        TokenFactory::MakeFloatLiteral(s, std::nan(""), wrapper.GetLine(), wrapper.GetTokenCol()));
-  }
+  wrapper.AdvanceInLine(FindIdentifierEnd(wrapper.GetSource(), wrapper.GetOffset()));
+  std::string s = wrapper.GetRawLexeme();
 
-  if (SourceCodeWrapper::IsKeyword(s)) {
-    if (s == "true" || s == "false") {
+  switch (ClassifyWord(s)) {
+    case WordClass::kFloatLiteral: {
+      const auto value = static_cast<double>(DecodeFloatLexeme(s).value_or(0.0L));
+      return std::make_optional(TokenFactory::MakeFloatLiteral(s, value, wrapper.GetLine(), wrapper.GetTokenCol()));
+    }
+    case WordClass::kBoolLiteral:
       return std::make_optional(
           TokenFactory::MakeBoolLiteral(s, s == "true", wrapper.GetLine(), wrapper.GetTokenCol()));
-    }
-
-    return std::make_optional(TokenFactory::MakeKeyword(std::move(s), wrapper.GetLine(), wrapper.GetTokenCol()));
+    case WordClass::kKeyword:
+      return std::make_optional(TokenFactory::MakeKeyword(std::move(s), wrapper.GetLine(), wrapper.GetTokenCol()));
+    case WordClass::kIdentifier:
+      break;
   }
 
   if (s[0] == '#') {
@@ -1,20 +1,16 @@
 #include "NumberHandler.hpp"
 
 #include <cctype>
+#include <optional>
 #include <string>
 
 #include <tokens/TokenFactory.hpp>
 
 #include "lib/lexer/LexerError.hpp"
+#include "lib/lexer/literal_decoder.hpp"
 
 namespace ovum::compiler::lexer {
 
-namespace {
-inline constexpr int kHexAlphaOffset = 10;
-inline constexpr int kHexNibbleBits = 4;
-inline constexpr int kMaxByte = 255;
-} // namespace
-
 inline bool IsDec(char c) noexcept {
   return std::isdigit(static_cast<unsigned char>(c)) != 0;
 }
@@ -52,20 +48,28 @@ inline std::expected<bool, LexerError> ParseExponent(SourceCodeWrapper& w, std::
   return false;
 }
 
-inline std::expected<double, LexerError> ParseDoubleStrict(const std::string& raw) {
-  try {
-    return std::stod(raw);
-  } catch (...) {
-    return std::unexpected(LexerError(std::string("Malformed float literal: ") + raw));
+// Decimal literals must decode; hex and binary ones that overflow are left for the parser to report, as they always
+// were.
+inline std::expected<OptToken, LexerError> MakeNumberToken(SourceCodeWrapper& w, std::string raw, bool is_float) {
+  const std::optional<NumericLiteral> literal = DecodeNumericLexeme(raw, is_float);
+  const bool has_radix_prefix = raw.size() > 2 && raw[0] == '0' && std::isalpha(static_cast<unsigned char>(raw[1]));
+
+  if (!literal && (is_float || !has_radix_prefix)) {
+    return std::unexpected(
+        LexerError(std::string(is_float ? "Malformed float literal: " : "Malformed integer literal: ") + raw));
   }
-}
 
-inline std::expected<long long, LexerError> ParseDecIntStrict(const std::string& raw) {
-  try {
-    return std::stoll(raw);
-  } catch (...) {
-    return std::unexpected(LexerError(std::string("Malformed integer literal: ") + raw));
+  TokenPtr token;
+
+  if (is_float) {
+    const auto value = static_cast<double>(literal->float_value);
+    token = TokenFactory::MakeFloatLiteral(std::move(raw), value, w.GetLine(), w.GetTokenCol());
+  } else {
+    const long long value = literal ? literal->int_value : 0;
+    token = TokenFactory::MakeIntLiteral(std::move(raw), value, w.GetLine(), w.GetTokenCol());
   }
+
+  return std::make_optional(std::move(token));
 }
 
 inline std::expected<void, LexerError> EnsureNoIdentTail(SourceCodeWrapper& w, const char* ctx) {
@@ -106,12 +110,7 @@ std::expected<OptToken, LexerError> NumberHandler::Scan(SourceCodeWrapper& wrapp
     if (!ident_result) {
       return std::unexpected(ident_result.error());
     }
-    auto v_result = ParseDoubleStrict(raw);
-    if (!v_result) {
-      return std::unexpected(v_result.error());
-    }
-
-    return TokenFactory::MakeFloatLiteral(std::move(raw), v_result.value(), wrapper.GetLine(), wrapper.GetTokenCol());
+    return MakeNumberToken(wrapper, std::move(raw), true);
   }
 
   wrapper.RetreatOne();
@@ -135,22 +134,7 @@ std::expected<OptToken, LexerError> NumberHandler::Scan(SourceCodeWrapper& wrapp
       return std::unexpected(ident_result.error());
     }
 
-    long long val = 0;
-
-    for (size_t i = 2; i < raw.size(); ++i) {
-      const char c = raw[i];
-      val <<= kHexNibbleBits;
-
-      if (c >= '0' && c <= '9') {
-        val |= static_cast<long long>(c - '0');
-      } else if (c >= 'a' && c <= 'f') {
-        val |= static_cast<long long>(kHexAlphaOffset + c - 'a');
-      } else {
-        val |= static_cast<long long>(kHexAlphaOffset + c - 'A');
-      }
-    }
-
-    return TokenFactory::MakeIntLiteral(std::move(raw), val, wrapper.GetLine(), wrapper.GetTokenCol());
+    return MakeNumberToken(wrapper, std::move(raw), false);
   }
 
   if (wrapper.Peek() == '0' && (wrapper.Peek(1) == 'b' || wrapper.Peek(1) == 'B')) {
@@ -171,13 +155,8 @@ std::expected<OptToken, LexerError> NumberHandler::Scan(SourceCodeWrapper& wrapp
     if (!ident_result) {
       return std::unexpected(ident_result.error());
     }
-    long long val = 0;
 
-    for (size_t i = 2; i < raw.size(); ++i) {
-      val = (val << 1) | (raw[i] - '0');
-    }
-
-    return TokenFactory::MakeIntLiteral(std::move(raw), val, wrapper.GetLine(), wrapper.GetTokenCol());
+    return MakeNumberToken(wrapper, std::move(raw), false);
   }
 
   wrapper.ConsumeWhile(raw, IsDec);
@@ -201,11 +180,7 @@ std::expected<OptToken, LexerError> NumberHandler::Scan(SourceCodeWrapper& wrapp
     if (!ident_result) {
       return std::unexpected(ident_result.error());
     }
-    auto v_result = ParseDoubleStrict(raw);
-    if (!v_result) {
-      return std::unexpected(v_result.error());
-    }
-    return TokenFactory::MakeFloatLiteral(std::move(raw), v_result.value(), wrapper.GetLine(), wrapper.GetTokenCol());
+    return MakeNumberToken(wrapper, std::move(raw), true);
   }
 
   auto exp_result = ParseExponent(wrapper, raw);
@@ -219,51 +194,26 @@ std::expected<OptToken, LexerError> NumberHandler::Scan(SourceCodeWrapper& wrapp
     if (!ident_result) {
       return std::unexpected(ident_result.error());
     }
-    auto v_result = ParseDoubleStrict(raw);
-    if (!v_result) {
-      return std::unexpected(v_result.error());
-    }
-    return TokenFactory::MakeFloatLiteral(std::move(raw), v_result.value(), wrapper.GetLine(), wrapper.GetTokenCol());
+    return MakeNumberToken(wrapper, std::move(raw), true);
   }
 
   if (!raw.empty() && (raw.back() == 'e' || raw.back() == 'E' || raw.back() == '+' || raw.back() == '-')) {
     return std::unexpected(LexerError(std::string("Malformed float literal: ") + raw));
   }
 
-  // Check for byte literal suffix (b or B) before EnsureNoIdentTail
-  // Store the current position to check for 'b' suffix
+  // Byte literal: the 'b' suffix stays in the lexeme and the decoded value is clamped to [0, 255].
   char next_char = wrapper.Peek();
   if (next_char == 'b' || next_char == 'B') {
-    // Parse the number part without the 'b' suffix
-    auto vi_result = ParseDecIntStrict(raw);
-    if (!vi_result) {
-      return std::unexpected(vi_result.error());
-    }
-    long long value = vi_result.value();
-    // Clamp to byte range [0, 255]
-    if (value < 0) {
-      value = 0;
-    }
-    if (value > kMaxByte) {
-      value = kMaxByte;
-    }
-    // Consume the 'b' suffix
     raw.push_back(wrapper.Advance());
-    // Create byte literal token using MakeIntLiteral with special handling
-    // The parser will check for 'b' suffix in lexeme to determine if it's a byte literal
-    return TokenFactory::MakeIntLiteral(std::move(raw), value, wrapper.GetLine(), wrapper.GetTokenCol());
+    return MakeNumberToken(wrapper, std::move(raw), false);
   }
 
   auto ident_result = EnsureNoIdentTail(wrapper, "integer literal");
   if (!ident_result) {
     return std::unexpected(ident_result.error());
   }
-  auto vi_result = ParseDecIntStrict(raw);
-  if (!vi_result) {
-    return std::unexpected(vi_result.error());
-  }
 
-  return TokenFactory::MakeIntLiteral(std::move(raw), vi_result.value(), wrapper.GetLine(), wrapper.GetTokenCol());
+  return MakeNumberToken(wrapper, std::move(raw), false);
 }
 
 } // namespace ovum::compiler::lexer
@@ -2,20 +2,16 @@
 
 #include <tokens/TokenFactory.hpp>
 
+#include "lib/lexer/lexeme_recognizer.hpp"
+
 namespace ovum::compiler::lexer {
 
 std::expected<OptToken, LexerError> OperatorHandler::Scan(SourceCodeWrapper& wrapper) {
   std::string op;
   op.push_back(wrapper.CurrentChar());
-  char p = wrapper.Peek();
-
-  if (p != '\0') {
-    std::string two = op + p;
 
-    if (SourceCodeWrapper::IsMultiOp(two)) {
-      wrapper.Advance();
-      op = two;
-    }
+  if (IsMultiOpPair(op.front(), wrapper.Peek())) {
+    op.push_back(wrapper.Advance());
   }
 
   return std::make_optional(TokenFactory::MakeOperator(std::move(op), wrapper.GetLine(), wrapper.GetTokenCol()));
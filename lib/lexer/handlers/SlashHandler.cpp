@@ -3,19 +3,17 @@
 #include <tokens/TokenFactory.hpp>
 
 #include "lib/lexer/LexerError.hpp"
+#include "lib/lexer/scan_kernels.hpp"
 
 namespace ovum::compiler::lexer {
 
 std::expected<OptToken, LexerError> SlashHandler::Scan(SourceCodeWrapper& wrapper) {
   if (wrapper.Peek() == '/') {
-    std::string txt;
-
-    while (!wrapper.IsAtEnd() && wrapper.Peek() != '\n') {
-      txt.push_back(wrapper.Advance());
-    }
+    const size_t body_begin = wrapper.GetOffset() + 1;
+    wrapper.AdvanceInLine(FindLineEnd(wrapper.GetSource(), wrapper.GetOffset()));
 
     if (wrapper.IsKeepComments()) {
-      std::string comment = txt.substr(1, txt.size() - 1);
+      std::string comment(wrapper.GetSource().substr(body_begin, wrapper.GetOffset() - body_begin));
       return std::make_optional(
           TokenFactory::MakeComment(std::move(comment), wrapper.GetLine(), wrapper.GetTokenCol()));
     }
@@ -25,19 +23,23 @@ std::expected<OptToken, LexerError> SlashHandler::Scan(SourceCodeWrapper& wrappe
 
   if (wrapper.Peek() == '*') {
     wrapper.Advance();
-    std::string txt;
+    const size_t body_begin = wrapper.GetOffset();
     bool closed = false;
 
     while (!wrapper.IsAtEnd()) {
-      char c = wrapper.Advance();
+      wrapper.AdvanceOver(FindNextStar(wrapper.GetSource(), wrapper.GetOffset()));
 
-      if (c == '*' && wrapper.Peek() == '/') {
+      if (wrapper.IsAtEnd()) {
+        break;
+      }
+
+      wrapper.Advance();
+
+      if (wrapper.Peek() == '/') {
         wrapper.Advance();
         closed = true;
         break;
       }
-
-      txt.push_back(c);
     }
 
     if (!closed) {
@@ -45,6 +47,7 @@ std::expected<OptToken, LexerError> SlashHandler::Scan(SourceCodeWrapper& wrappe
     }
 
     if (wrapper.IsKeepComments()) {
+      std::string txt(wrapper.GetSource().substr(body_begin, wrapper.GetOffset() - body_begin - 2));
       return std::make_optional(TokenFactory::MakeComment(std::move(txt), wrapper.GetLine(), wrapper.GetTokenCol()));
     }
 
@@ -1,10 +1,12 @@
 #include "StringHandler.hpp"
 
+#include <string_view>
 #include <utility>
 
 #include <tokens/TokenFactory.hpp>
 
 #include "lib/lexer/LexerError.hpp"
+#include "lib/lexer/scan_kernels.hpp"
 
 namespace ovum::compiler::lexer {
 
@@ -14,6 +16,17 @@ std::expected<OptToken, LexerError> StringHandler::Scan(SourceCodeWrapper& wrapp
   raw.push_back('"');
 
   while (!wrapper.IsAtEnd()) {
+    const size_t plain_begin = wrapper.GetOffset();
+    const size_t plain_end = FindStringSpecial(wrapper.GetSource(), plain_begin);
+    const std::string_view plain = wrapper.GetSource().substr(plain_begin, plain_end - plain_begin);
+    raw.append(plain);
+    out.append(plain);
+    wrapper.AdvanceInLine(plain_end);
+
+    if (wrapper.IsAtEnd()) {
+      break;
+    }
+
     char c = wrapper.Advance();
     raw.push_back(c);
 
@@ -52,12 +65,8 @@ std::expected<OptToken, LexerError> StringHandler::Scan(SourceCodeWrapper& wrapp
         default:
           return std::unexpected(LexerError(std::string("Unknown escape in string literal: \\") + e));
       }
-    } else {
-      if (c == '\n') {
-        return std::unexpected(LexerError("Unterminated string literal (newline inside)"));
-      }
-
-      out.push_back(c);
+    } else if (c == '\n') {
+      return std::unexpected(LexerError("Unterminated string literal (newline inside)"));
     }
   }
 
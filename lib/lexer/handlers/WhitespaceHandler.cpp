@@ -1,16 +1,11 @@
 #include "WhitespaceHandler.hpp"
 
+#include "lib/lexer/scan_kernels.hpp"
+
 namespace ovum::compiler::lexer {
 
 std::expected<OptToken, LexerError> WhitespaceHandler::Scan(SourceCodeWrapper& wrapper) {
-  while (!wrapper.IsAtEnd()) {
-    if (char p = wrapper.Peek(); p != ' ' && p != '\t' && p != '\r') {
-      break;
-    }
-
-    wrapper.Advance();
-  }
-
+  wrapper.AdvanceInLine(FindWhitespaceEnd(wrapper.GetSource(), wrapper.GetOffset()));
   return std::nullopt;
 }
 
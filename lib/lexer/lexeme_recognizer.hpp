@@ -0,0 +1,135 @@
+#ifndef LEXER_LEXEME_RECOGNIZER_HPP_
+#define LEXER_LEXEME_RECOGNIZER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+namespace ovum::compiler::lexer {
+
+enum class WordClass : std::uint8_t { kIdentifier, kKeyword, kBoolLiteral, kFloatLiteral };
+
+struct WordEntry {
+  std::string_view text;
+  WordClass word_class;
+};
+
+inline constexpr std::array kReservedWords = {
+    WordEntry{"fun", WordClass::kKeyword},        WordEntry{"class", WordClass::kKeyword},
+    WordEntry{"interface", WordClass::kKeyword},  WordEntry{"var", WordClass::kKeyword},
+    WordEntry{"override", WordClass::kKeyword},   WordEntry{"pure", WordClass::kKeyword},
+    WordEntry{"if", WordClass::kKeyword},         WordEntry{"else", WordClass::kKeyword},
+    WordEntry{"continue", WordClass::kKeyword},   WordEntry{"break", WordClass::kKeyword},
+    WordEntry{"for", WordClass::kKeyword},        WordEntry{"while", WordClass::kKeyword},
+    WordEntry{"return", WordClass::kKeyword},     WordEntry{"unsafe", WordClass::kKeyword},
+    WordEntry{"val", WordClass::kKeyword},        WordEntry{"static", WordClass::kKeyword},
+    WordEntry{"public", WordClass::kKeyword},     WordEntry{"private", WordClass::kKeyword},
+    WordEntry{"implements", WordClass::kKeyword}, WordEntry{"as", WordClass::kKeyword},
+    WordEntry{"is", WordClass::kKeyword},         WordEntry{"in", WordClass::kKeyword},
+    WordEntry{"null", WordClass::kKeyword},       WordEntry{"typealias", WordClass::kKeyword},
+    WordEntry{"destructor", WordClass::kKeyword}, WordEntry{"call", WordClass::kKeyword},
+    WordEntry{"#import", WordClass::kKeyword},    WordEntry{"#define", WordClass::kKeyword},
+    WordEntry{"#undef", WordClass::kKeyword},     WordEntry{"#ifdef", WordClass::kKeyword},
+    WordEntry{"#ifndef", WordClass::kKeyword},    WordEntry{"#else", WordClass::kKeyword},
+    WordEntry{"#endif", WordClass::kKeyword},     WordEntry{"this", WordClass::kKeyword},
+    WordEntry{"true", WordClass::kBoolLiteral},   WordEntry{"false", WordClass::kBoolLiteral},
+    WordEntry{"Inf", WordClass::kFloatLiteral},   WordEntry{"inf", WordClass::kFloatLiteral},
+    WordEntry{"Infinity", WordClass::kFloatLiteral}, WordEntry{"infinity", WordClass::kFloatLiteral},
+    WordEntry{"NaN", WordClass::kFloatLiteral},
+};
+
+inline constexpr std::size_t kWordTableSize = 128;
+inline constexpr std::size_t kMinReservedWordLength = 2;
+inline constexpr std::size_t kMaxReservedWordLength = 10;
+inline constexpr std::uint8_t kEmptyWordSlot = 0xFF;
+
+// Multipliers picked so that every reserved word lands in its own slot; BuildWordTable fails to compile otherwise.
+constexpr std::size_t WordHash(std::string_view word) noexcept {
+  constexpr std::size_t kSecondCharFactor = 5;
+  constexpr std::size_t kLastCharFactor = 22;
+  const auto first = static_cast<unsigned char>(word[0]);
+  const auto second = static_cast<unsigned char>(word[1]);
+  const auto last = static_cast<unsigned char>(word.back());
+
+  return (word.size() + 2 * first + kSecondCharFactor * second + kLastCharFactor * last) & (kWordTableSize - 1);
+}
+
+consteval std::array<std::uint8_t, kWordTableSize> BuildWordTable() {
+  std::array<std::uint8_t, kWordTableSize> table{};
+  table.fill(kEmptyWordSlot);
+
+  for (std::size_t i = 0; i < kReservedWords.size(); ++i) {
+    const std::string_view word = kReservedWords[i].text;
+
+    if (word.size() < kMinReservedWordLength || word.size() > kMaxReservedWordLength) {
+      throw std::logic_error("Reserved word length is out of the hashed range");
+    }
+
+    std::uint8_t& slot = table[WordHash(word)];
+
+    if (slot != kEmptyWordSlot) {
+      throw std::logic_error("Reserved word hash collision");
+    }
+
+    slot = static_cast<std::uint8_t>(i);
+  }
+
+  return table;
+}
+
+inline constexpr std::array<std::uint8_t, kWordTableSize> kWordTable = BuildWordTable();
+
+// One table probe and one compare: classifies keywords, bool literals and Inf/NaN spellings.
+constexpr WordClass ClassifyWord(std::string_view word) noexcept {
+  if (word.size() < kMinReservedWordLength || word.size() > kMaxReservedWordLength) {
+    return WordClass::kIdentifier;
+  }
+
+  const std::uint8_t index = kWordTable[WordHash(word)];
+
+  if (index == kEmptyWordSlot || kReservedWords[index].text != word) {
+    return WordClass::kIdentifier;
+  }
+
+  return kReservedWords[index].word_class;
+}
+
+constexpr bool IsMultiOpPair(char first, char second) noexcept {
+  switch (first) {
+    case '*':
+    case '+':
+    case '-':
+    case '/':
+    case '=':
+    case '!':
+      return second == '=';
+    case '<':
+      return second == '=' || second == '<';
+    case '>':
+      return second == '=' || second == '>';
+    case '&':
+      return second == '&';
+    case '|':
+      return second == '|';
+    case '?':
+      return second == ':' || second == '.';
+    case ':':
+      return second == ':' || second == '=';
+    default:
+      return false;
+  }
+}
+
+static_assert(ClassifyWord("interface") == WordClass::kKeyword);
+static_assert(ClassifyWord("#ifndef") == WordClass::kKeyword);
+static_assert(ClassifyWord("false") == WordClass::kBoolLiteral);
+static_assert(ClassifyWord("Infinity") == WordClass::kFloatLiteral);
+static_assert(ClassifyWord("Interface") == WordClass::kIdentifier);
+static_assert(ClassifyWord("x") == WordClass::kIdentifier);
+static_assert(IsMultiOpPair('?', '.') && !IsMultiOpPair('.', '?'));
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_LEXEME_RECOGNIZER_HPP_
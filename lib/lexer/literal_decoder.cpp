@@ -0,0 +1,95 @@
+#include "literal_decoder.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <system_error>
+
+namespace ovum::compiler::lexer {
+
+namespace {
+
+constexpr int kDecimalBase = 10;
+constexpr int kHexBase = 16;
+constexpr int kBinaryBase = 2;
+
+bool HasRadixPrefix(std::string_view lexeme, char lower) noexcept {
+  return lexeme.size() > 2 && lexeme[0] == '0' && (lexeme[1] == lower || lexeme[1] == lower - ('a' - 'A'));
+}
+
+std::optional<long long> FromCharsInteger(std::string_view digits, int base) noexcept {
+  long long value = 0;
+  const char* end = digits.data() + digits.size();
+  const auto [ptr, ec] = std::from_chars(digits.data(), end, value, base);
+
+  if (digits.empty() || ec != std::errc{} || ptr != end) {
+    return std::nullopt;
+  }
+
+  return value;
+}
+
+} // namespace
+
+std::optional<long long> DecodeIntegerLexeme(std::string_view lexeme) noexcept {
+  if (HasRadixPrefix(lexeme, 'x')) {
+    return FromCharsInteger(lexeme.substr(2), kHexBase);
+  }
+
+  if (HasRadixPrefix(lexeme, 'b')) {
+    return FromCharsInteger(lexeme.substr(2), kBinaryBase);
+  }
+
+  return FromCharsInteger(lexeme, kDecimalBase);
+}
+
+std::optional<long double> DecodeFloatLexeme(std::string_view lexeme) noexcept {
+  long double value = 0.0;
+  const char* end = lexeme.data() + lexeme.size();
+  const auto [ptr, ec] = std::from_chars(lexeme.data(), end, value);
+
+  if (lexeme.empty() || ec != std::errc{} || ptr != end) {
+    return std::nullopt;
+  }
+
+  // Tokens carry a double, so the range stays the one the lexer has always accepted; only the precision is wider.
+  if (std::isfinite(value) && std::fabs(value) > std::numeric_limits<double>::max()) {
+    return std::nullopt;
+  }
+
+  return value;
+}
+
+std::optional<NumericLiteral> DecodeNumericLexeme(std::string_view lexeme, bool is_float) noexcept {
+  if (is_float) {
+    const std::optional<long double> value = DecodeFloatLexeme(lexeme);
+
+    if (!value) {
+      return std::nullopt;
+    }
+
+    return NumericLiteral{.kind = NumericLiteralKind::kFloat, .float_value = *value};
+  }
+
+  const bool is_byte = !lexeme.empty() && (lexeme.back() == 'b' || lexeme.back() == 'B') &&
+                       !HasRadixPrefix(lexeme, 'x') && !HasRadixPrefix(lexeme, 'b');
+
+  if (is_byte) {
+    lexeme.remove_suffix(1);
+  }
+
+  const std::optional<long long> value = DecodeIntegerLexeme(lexeme);
+
+  if (!value) {
+    return std::nullopt;
+  }
+
+  if (is_byte) {
+    const long long clamped = *value < 0 ? 0 : (*value > kMaxByteLiteral ? kMaxByteLiteral : *value);
+    return NumericLiteral{.kind = NumericLiteralKind::kByte, .int_value = clamped};
+  }
+
+  return NumericLiteral{.kind = NumericLiteralKind::kInt, .int_value = *value};
+}
+
+} // namespace ovum::compiler::lexer
@@ -0,0 +1,31 @@
+#ifndef LEXER_LITERAL_DECODER_HPP_
+#define LEXER_LITERAL_DECODER_HPP_
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace ovum::compiler::lexer {
+
+inline constexpr long long kMaxByteLiteral = 255;
+
+enum class NumericLiteralKind : std::uint8_t { kInt, kByte, kFloat };
+
+struct NumericLiteral {
+  NumericLiteralKind kind = NumericLiteralKind::kInt;
+  long long int_value = 0; // kInt and kByte; bytes are already clamped to [0, 255]
+  long double float_value = 0.0; // kFloat
+};
+
+// Decimal, 0x hex or 0b binary digits; nullopt if the text is malformed or does not fit in a long long.
+[[nodiscard]] std::optional<long long> DecodeIntegerLexeme(std::string_view lexeme) noexcept;
+
+// Decimal floats plus the Inf/Infinity/NaN spellings the lexer accepts, in the long double precision of FloatLit.
+[[nodiscard]] std::optional<long double> DecodeFloatLexeme(std::string_view lexeme) noexcept;
+
+// Full decoding of a LITERAL:Int or LITERAL:Float lexeme, including the b/B suffix of decimal byte literals.
+[[nodiscard]] std::optional<NumericLiteral> DecodeNumericLexeme(std::string_view lexeme, bool is_float) noexcept;
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_LITERAL_DECODER_HPP_
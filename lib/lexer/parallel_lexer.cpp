@@ -0,0 +1,270 @@
+#include "parallel_lexer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <utility>
+
+#include "ViewLexer.hpp"
+#include "scan_kernels.hpp"
+
+namespace ovum::compiler::lexer {
+
+namespace {
+
+struct ChunkResult {
+  std::vector<TokenView> views;
+  bool failed = false;
+};
+
+// Returns the offset just past a string or character literal opened at pos. An unterminated literal stops at the
+// newline; the lexer reports it, and the parallel path then falls back to serial lexing.
+std::size_t SkipQuoted(std::string_view src, std::size_t pos) noexcept {
+  const char quote = src[pos++];
+
+  while (pos < src.size()) {
+    const char c = src[pos];
+
+    if (c == '\\') {
+      pos += 2;
+      continue;
+    }
+
+    if (c == quote) {
+      return pos + 1;
+    }
+
+    if (c == '\n') {
+      return pos;
+    }
+
+    ++pos;
+  }
+
+  return src.size();
+}
+
+// Chunks to cut src into, or 0 when it should be lexed serially.
+std::size_t ParallelChunkCount(std::string_view src, const ParallelLexOptions& options) noexcept {
+  if (src.size() < options.threshold || src.size() > std::numeric_limits<uint32_t>::max()) {
+    return 0;
+  }
+
+  const std::size_t by_size = src.size() / std::max<std::size_t>(1, options.min_chunk);
+  const std::size_t chunks = std::min(ParallelLexThreadCount(options), by_size);
+
+  return chunks < 2 ? 0 : chunks;
+}
+
+// Lexes every chunk on its own; views keep chunk-relative offsets and lines, and all but the last lose their EOF.
+std::vector<ChunkResult> LexChunks(std::string_view src,
+                                   const std::vector<LexChunkStart>& starts,
+                                   bool keep_comments,
+                                   bool track_positions,
+                                   std::size_t threads) {
+  std::vector<ChunkResult> results(starts.size());
+
+  RunChunksInParallel(starts.size(), threads, [&](std::size_t chunk) {
+    const std::size_t begin = starts[chunk].offset;
+    const std::size_t end = chunk + 1 < starts.size() ? starts[chunk + 1].offset : src.size();
+    ViewLexer lexer(src.substr(begin, end - begin), keep_comments, track_positions);
+    auto views = lexer.Tokenize();
+
+    if (!views) {
+      results[chunk].failed = true;
+      return;
+    }
+
+    results[chunk].views = std::move(views.value());
+
+    if (chunk + 1 < starts.size()) {
+      results[chunk].views.pop_back();
+    }
+  });
+
+  return results;
+}
+
+bool AnyFailed(const std::vector<ChunkResult>& results) noexcept {
+  return std::ranges::any_of(results, [](const ChunkResult& result) { return result.failed; });
+}
+
+} // namespace
+
+std::vector<LexChunkStart> FindLexChunkStarts(std::string_view src, std::size_t chunk_count) {
+  std::vector<LexChunkStart> starts{LexChunkStart{}};
+
+  if (chunk_count < 2 || src.empty()) {
+    return starts;
+  }
+
+  const std::size_t target_size = std::max<std::size_t>(1, src.size() / chunk_count);
+  std::size_t next_target = target_size;
+  int32_t line = 1;
+  std::size_t pos = 0;
+
+  while (pos < src.size() && starts.size() < chunk_count) {
+    const char c = src[pos];
+
+    if (c == '\n') {
+      ++line;
+      ++pos;
+
+      if (pos >= next_target && pos < src.size()) {
+        starts.push_back(LexChunkStart{.offset = pos, .line = line});
+        next_target = pos + target_size;
+      }
+
+      continue;
+    }
+
+    if (c == '"' || c == '\'') {
+      pos = SkipQuoted(src, pos);
+      continue;
+    }
+
+    if (c == '/' && pos + 1 < src.size() && src[pos + 1] == '/') {
+      pos = FindLineEnd(src, pos);
+      continue;
+    }
+
+    if (c == '/' && pos + 1 < src.size() && src[pos + 1] == '*') {
+      const std::size_t close = src.find("*/", pos + 2);
+
+      if (close == std::string_view::npos) {
+        break;
+      }
+
+      line += static_cast<int32_t>(std::count(src.begin() + static_cast<std::ptrdiff_t>(pos),
+                                              src.begin() + static_cast<std::ptrdiff_t>(close),
+                                              '\n'));
+      pos = close + 2;
+      continue;
+    }
+
+    ++pos;
+  }
+
+  return starts;
+}
+
+std::size_t ParallelLexThreadCount(const ParallelLexOptions& options) noexcept {
+  if (options.threads != 0) {
+    return options.threads;
+  }
+
+  return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+std::optional<std::vector<TokenView>> TryTokenizeViewsParallel(std::string_view src,
+                                                               bool keep_comments,
+                                                               const ParallelLexOptions& options) {
+  const std::size_t chunk_count = ParallelChunkCount(src, options);
+
+  if (chunk_count == 0) {
+    return std::nullopt;
+  }
+
+  const std::vector<LexChunkStart> starts = FindLexChunkStarts(src, chunk_count);
+  std::vector<ChunkResult> results = LexChunks(src, starts, keep_comments, true, ParallelLexThreadCount(options));
+
+  if (AnyFailed(results)) {
+    return std::nullopt;
+  }
+
+  std::size_t total = 0;
+
+  for (const ChunkResult& result : results) {
+    total += result.views.size();
+  }
+
+  std::vector<TokenView> views;
+  views.reserve(total);
+
+  for (std::size_t chunk = 0; chunk < results.size(); ++chunk) {
+    const auto base_offset = static_cast<uint32_t>(starts[chunk].offset);
+    const int32_t base_line = starts[chunk].line - 1;
+
+    for (TokenView view : results[chunk].views) {
+      view.offset += base_offset;
+      view.line += base_line;
+      views.push_back(view);
+    }
+  }
+
+  return views;
+}
+
+std::expected<std::vector<TokenView>, LexerError> TokenizeViewsParallel(std::string_view src,
+                                                                        bool keep_comments,
+                                                                        const ParallelLexOptions& options) {
+  if (std::optional<std::vector<TokenView>> views = TryTokenizeViewsParallel(src, keep_comments, options)) {
+    return std::move(*views);
+  }
+
+  return ViewLexer(src, keep_comments).Tokenize();
+}
+
+std::expected<void, LexerError> TokenizeIntoParallel(std::string_view src,
+                                                     TokenBuffer& out,
+                                                     bool keep_comments,
+                                                     const ParallelLexOptions& options) {
+  const std::size_t chunk_count = ParallelChunkCount(src, options);
+
+  if (chunk_count == 0) {
+    return ViewLexer(src, keep_comments).TokenizeInto(out);
+  }
+
+  const std::vector<LexChunkStart> starts = FindLexChunkStarts(src, chunk_count);
+  std::vector<ChunkResult> results = LexChunks(src, starts, keep_comments, false, ParallelLexThreadCount(options));
+
+  if (AnyFailed(results)) {
+    return ViewLexer(src, keep_comments).TokenizeInto(out);
+  }
+
+  std::size_t total = out.Size();
+
+  for (const ChunkResult& result : results) {
+    total += result.views.size();
+  }
+
+  out.Reserve(total);
+  const TokenBuffer::SourceIndex source = out.AddSource(src);
+
+  for (std::size_t chunk = 0; chunk < results.size(); ++chunk) {
+    const auto base_offset = static_cast<uint32_t>(starts[chunk].offset);
+
+    for (TokenView view : results[chunk].views) {
+      view.offset += base_offset;
+      out.Append(view, source);
+    }
+  }
+
+  return {};
+}
+
+void RunChunksInParallel(std::size_t count, std::size_t threads, const std::function<void(std::size_t)>& task) {
+  std::atomic<std::size_t> next{0};
+  auto worker = [&]() {
+    for (std::size_t chunk = next++; chunk < count; chunk = next++) {
+      task(chunk);
+    }
+  };
+
+  const std::size_t used_threads = std::min(threads, count);
+  std::vector<std::thread> workers;
+  workers.reserve(used_threads);
+
+  for (std::size_t i = 1; i < used_threads; ++i) {
+    workers.emplace_back(worker);
+  }
+
+  worker();
+
+  for (std::thread& thread : workers) {
+    thread.join();
+  }
+}
+
+} // namespace ovum::compiler::lexer
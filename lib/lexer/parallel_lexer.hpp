@@ -0,0 +1,64 @@
+#ifndef LEXER_PARALLEL_LEXER_HPP_
+#define LEXER_PARALLEL_LEXER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "LexerError.hpp"
+#include "TokenBuffer.hpp"
+#include "TokenView.hpp"
+
+namespace ovum::compiler::lexer {
+
+// Below this size a source is lexed serially: starting threads would cost more than it saves.
+inline constexpr std::size_t kParallelLexThreshold = std::size_t{1} << 20;
+inline constexpr std::size_t kMinParallelLexChunk = std::size_t{256} << 10;
+
+struct ParallelLexOptions {
+  std::size_t threshold = kParallelLexThreshold;
+  std::size_t min_chunk = kMinParallelLexChunk;
+  std::size_t threads = 0; // 0 picks std::thread::hardware_concurrency()
+};
+
+// Where a chunk starts: right after a newline that is outside any block comment, so lexing can begin there from
+// a fresh state. line is the 1-based line of offset.
+struct LexChunkStart {
+  std::size_t offset = 0;
+  int32_t line = 1;
+};
+
+// Splits src into at most chunk_count chunks of roughly equal size. A quick pass tracks strings, character
+// literals and comments so a chunk never starts inside a block comment; the first chunk always starts at 0.
+[[nodiscard]] std::vector<LexChunkStart> FindLexChunkStarts(std::string_view src, std::size_t chunk_count);
+
+[[nodiscard]] std::size_t ParallelLexThreadCount(const ParallelLexOptions& options) noexcept;
+
+// Views lexed chunk by chunk on several threads and stitched back with corrected offsets and lines; nullopt when src
+// is below the threshold or a chunk fails to lex, and the caller should lex serially instead.
+[[nodiscard]] std::optional<std::vector<TokenView>> TryTokenizeViewsParallel(std::string_view src,
+                                                                             bool keep_comments,
+                                                                             const ParallelLexOptions& options);
+
+// Same views as ViewLexer::Tokenize, lexed chunk by chunk on several threads and stitched back with corrected
+// offsets and lines. Small sources, and sources with a lexer error, are lexed serially, so errors are identical too.
+std::expected<std::vector<TokenView>, LexerError> TokenizeViewsParallel(std::string_view src,
+                                                                        bool keep_comments = false,
+                                                                        const ParallelLexOptions& options = {});
+
+// Parallel counterpart of ViewLexer::TokenizeInto.
+std::expected<void, LexerError> TokenizeIntoParallel(std::string_view src,
+                                                     TokenBuffer& out,
+                                                     bool keep_comments = false,
+                                                     const ParallelLexOptions& options = {});
+
+// Runs task(0) .. task(count - 1), spreading the calls over up to threads threads (the caller included).
+void RunChunksInParallel(std::size_t count, std::size_t threads, const std::function<void(std::size_t)>& task);
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_PARALLEL_LEXER_HPP_
@@ -0,0 +1,332 @@
+#include "scan_kernels.hpp"
+
+#include <atomic>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OVUM_LEXER_HAS_SSE2 1
+#endif
+
+#if defined(OVUM_LEXER_HAS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define OVUM_LEXER_HAS_AVX2 1
+#define OVUM_LEXER_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace ovum::compiler::lexer {
+
+namespace {
+
+constexpr bool IsIdentifierStop(char c) noexcept {
+  const auto u = static_cast<unsigned char>(c);
+  return !((u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || (u >= '0' && u <= '9') || u == '_');
+}
+
+constexpr bool IsWhitespaceStop(char c) noexcept {
+  return c != ' ' && c != '\t' && c != '\r';
+}
+
+constexpr bool IsStringStop(char c) noexcept {
+  return c == '"' || c == '\\' || c == '\n';
+}
+
+constexpr bool IsLineStop(char c) noexcept {
+  return c == '\n';
+}
+
+template<bool (*kStops)(char)>
+std::size_t FindStopScalar(std::string_view src, std::size_t pos) noexcept {
+  while (pos < src.size() && !kStops(src[pos])) {
+    ++pos;
+  }
+
+  return pos;
+}
+
+ScanRun NextStarScalar(std::string_view src, std::size_t pos) noexcept {
+  ScanRun run;
+
+  for (; pos < src.size() && src[pos] != '*'; ++pos) {
+    if (src[pos] == '\n') {
+      ++run.newlines;
+      run.last_newline = pos;
+    }
+  }
+
+  run.end = pos;
+  return run;
+}
+
+// Folds the newlines of one chunk that lie before its first '*' into the run; returns true once a '*' is found.
+inline bool AccumulateStarChunk(ScanRun& run, std::size_t chunk_pos, std::uint32_t star, std::uint32_t newline) {
+  if (star != 0) {
+    newline &= (star & (~star + 1)) - 1;
+  }
+
+  if (newline != 0) {
+    run.newlines += static_cast<std::size_t>(std::popcount(newline));
+    run.last_newline = chunk_pos + static_cast<std::size_t>(std::bit_width(newline)) - 1;
+  }
+
+  if (star != 0) {
+    run.end = chunk_pos + static_cast<std::size_t>(std::countr_zero(star));
+    return true;
+  }
+
+  return false;
+}
+
+ScanRun FinishStarRun(ScanRun run, std::string_view src, std::size_t pos) noexcept {
+  const ScanRun tail = NextStarScalar(src, pos);
+
+  if (tail.newlines != 0) {
+    run.newlines += tail.newlines;
+    run.last_newline = tail.last_newline;
+  }
+
+  run.end = tail.end;
+  return run;
+}
+
+constexpr ScanKernels kScalarKernels{
+    .identifier_end = FindStopScalar<IsIdentifierStop>,
+    .whitespace_end = FindStopScalar<IsWhitespaceStop>,
+    .string_special = FindStopScalar<IsStringStop>,
+    .line_end = FindStopScalar<IsLineStop>,
+    .next_star = NextStarScalar,
+};
+
+#ifdef OVUM_LEXER_HAS_SSE2
+
+constexpr std::size_t kSse2Width = 16;
+
+// Bytes of v within [lo, hi]: wrap-around subtraction followed by an unsigned saturating range check.
+inline __m128i InRangeSse2(__m128i v, char lo, char hi) noexcept {
+  const __m128i shifted = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+  const __m128i over = _mm_subs_epu8(shifted, _mm_set1_epi8(static_cast<char>(hi - lo)));
+  return _mm_cmpeq_epi8(over, _mm_setzero_si128());
+}
+
+inline std::uint32_t MaskSse2(__m128i bytes) noexcept {
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+}
+
+inline __m128i LoadSse2(const char* p) noexcept {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline std::uint32_t IdentifierStopsSse2(const char* p) noexcept {
+  const __m128i v = LoadSse2(p);
+  const __m128i alpha = InRangeSse2(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+  const __m128i digit = InRangeSse2(v, '0', '9');
+  const __m128i underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+  return ~MaskSse2(_mm_or_si128(_mm_or_si128(alpha, digit), underscore)) & 0xFFFFU;
+}
+
+inline std::uint32_t WhitespaceStopsSse2(const char* p) noexcept {
+  const __m128i v = LoadSse2(p);
+  const __m128i space = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+  return ~MaskSse2(_mm_or_si128(space, _mm_cmpeq_epi8(v, _mm_set1_epi8('\r')))) & 0xFFFFU;
+}
+
+inline std::uint32_t StringStopsSse2(const char* p) noexcept {
+  const __m128i v = LoadSse2(p);
+  const __m128i quote = _mm_cmpeq_epi8(v, _mm_set1_epi8('"'));
+  const __m128i backslash = _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'));
+  return MaskSse2(_mm_or_si128(_mm_or_si128(quote, backslash), _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))));
+}
+
+inline std::uint32_t LineStopsSse2(const char* p) noexcept {
+  return MaskSse2(_mm_cmpeq_epi8(LoadSse2(p), _mm_set1_epi8('\n')));
+}
+
+template<std::uint32_t (*kStopMask)(const char*) noexcept, bool (*kStops)(char)>
+std::size_t FindStopSse2(std::string_view src, std::size_t pos) noexcept {
+  while (pos + kSse2Width <= src.size()) {
+    if (const std::uint32_t mask = kStopMask(src.data() + pos); mask != 0) {
+      return pos + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+
+    pos += kSse2Width;
+  }
+
+  return FindStopScalar<kStops>(src, pos);
+}
+
+ScanRun NextStarSse2(std::string_view src, std::size_t pos) noexcept {
+  ScanRun run;
+
+  while (pos + kSse2Width <= src.size()) {
+    const __m128i v = LoadSse2(src.data() + pos);
+    const std::uint32_t star = MaskSse2(_mm_cmpeq_epi8(v, _mm_set1_epi8('*')));
+    const std::uint32_t newline = MaskSse2(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+
+    if (AccumulateStarChunk(run, pos, star, newline)) {
+      return run;
+    }
+
+    pos += kSse2Width;
+  }
+
+  return FinishStarRun(run, src, pos);
+}
+
+constexpr ScanKernels kSse2Kernels{
+    .identifier_end = FindStopSse2<IdentifierStopsSse2, IsIdentifierStop>,
+    .whitespace_end = FindStopSse2<WhitespaceStopsSse2, IsWhitespaceStop>,
+    .string_special = FindStopSse2<StringStopsSse2, IsStringStop>,
+    .line_end = FindStopSse2<LineStopsSse2, IsLineStop>,
+    .next_star = NextStarSse2,
+};
+
+#endif // OVUM_LEXER_HAS_SSE2
+
+#ifdef OVUM_LEXER_HAS_AVX2
+
+constexpr std::size_t kAvx2Width = 32;
+
+OVUM_LEXER_AVX2_TARGET inline __m256i InRangeAvx2(__m256i v, char lo, char hi) noexcept {
+  const __m256i shifted = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+  const __m256i over = _mm256_subs_epu8(shifted, _mm256_set1_epi8(static_cast<char>(hi - lo)));
+  return _mm256_cmpeq_epi8(over, _mm256_setzero_si256());
+}
+
+OVUM_LEXER_AVX2_TARGET inline std::uint32_t MaskAvx2(__m256i bytes) noexcept {
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(bytes));
+}
+
+OVUM_LEXER_AVX2_TARGET inline __m256i LoadAvx2(const char* p) noexcept {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+OVUM_LEXER_AVX2_TARGET inline std::uint32_t IdentifierStopsAvx2(const char* p) noexcept {
+  const __m256i v = LoadAvx2(p);
+  const __m256i alpha = InRangeAvx2(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z');
+  const __m256i digit = InRangeAvx2(v, '0', '9');
+  const __m256i underscore = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+  return ~MaskAvx2(_mm256_or_si256(_mm256_or_si256(alpha, digit), underscore));
+}
+
+OVUM_LEXER_AVX2_TARGET inline std::uint32_t WhitespaceStopsAvx2(const char* p) noexcept {
+  const __m256i v = LoadAvx2(p);
+  const __m256i space =
+      _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t')));
+  return ~MaskAvx2(_mm256_or_si256(space, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))));
+}
+
+OVUM_LEXER_AVX2_TARGET inline std::uint32_t StringStopsAvx2(const char* p) noexcept {
+  const __m256i v = LoadAvx2(p);
+  const __m256i quote = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"'));
+  const __m256i backslash = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'));
+  return MaskAvx2(_mm256_or_si256(_mm256_or_si256(quote, backslash), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'))));
+}
+
+OVUM_LEXER_AVX2_TARGET inline std::uint32_t LineStopsAvx2(const char* p) noexcept {
+  return MaskAvx2(_mm256_cmpeq_epi8(LoadAvx2(p), _mm256_set1_epi8('\n')));
+}
+
+template<std::uint32_t (*kStopMask)(const char*) noexcept, bool (*kStops)(char)>
+OVUM_LEXER_AVX2_TARGET std::size_t FindStopAvx2(std::string_view src, std::size_t pos) noexcept {
+  while (pos + kAvx2Width <= src.size()) {
+    if (const std::uint32_t mask = kStopMask(src.data() + pos); mask != 0) {
+      return pos + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+
+    pos += kAvx2Width;
+  }
+
+  return FindStopScalar<kStops>(src, pos);
+}
+
+OVUM_LEXER_AVX2_TARGET ScanRun NextStarAvx2(std::string_view src, std::size_t pos) noexcept {
+  ScanRun run;
+
+  while (pos + kAvx2Width <= src.size()) {
+    const __m256i v = LoadAvx2(src.data() + pos);
+    const std::uint32_t star = MaskAvx2(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('*')));
+    const std::uint32_t newline = MaskAvx2(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')));
+
+    if (AccumulateStarChunk(run, pos, star, newline)) {
+      return run;
+    }
+
+    pos += kAvx2Width;
+  }
+
+  return FinishStarRun(run, src, pos);
+}
+
+constexpr ScanKernels kAvx2Kernels{
+    .identifier_end = FindStopAvx2<IdentifierStopsAvx2, IsIdentifierStop>,
+    .whitespace_end = FindStopAvx2<WhitespaceStopsAvx2, IsWhitespaceStop>,
+    .string_special = FindStopAvx2<StringStopsAvx2, IsStringStop>,
+    .line_end = FindStopAvx2<LineStopsAvx2, IsLineStop>,
+    .next_star = NextStarAvx2,
+};
+
+#endif // OVUM_LEXER_HAS_AVX2
+
+SimdLevel ClampToSupported(SimdLevel level) noexcept {
+  const SimdLevel detected = DetectSimdLevel();
+  return static_cast<std::uint8_t>(level) > static_cast<std::uint8_t>(detected) ? detected : level;
+}
+
+std::atomic<const ScanKernels*>& ActiveKernelsSlot() noexcept {
+  static std::atomic<const ScanKernels*> slot{&GetScanKernels(DetectSimdLevel())};
+  return slot;
+}
+
+std::atomic<SimdLevel>& ActiveLevelSlot() noexcept {
+  static std::atomic<SimdLevel> slot{DetectSimdLevel()};
+  return slot;
+}
+
+} // namespace
+
+SimdLevel DetectSimdLevel() noexcept {
+#ifdef OVUM_LEXER_HAS_AVX2
+  static const bool kHasAvx2 = __builtin_cpu_supports("avx2") != 0;
+
+  if (kHasAvx2) {
+    return SimdLevel::kAvx2;
+  }
+#endif
+
+#ifdef OVUM_LEXER_HAS_SSE2
+  return SimdLevel::kSse2;
+#else
+  return SimdLevel::kScalar;
+#endif
+}
+
+const ScanKernels& GetScanKernels(SimdLevel level) noexcept {
+  switch (ClampToSupported(level)) {
+#ifdef OVUM_LEXER_HAS_AVX2
+    case SimdLevel::kAvx2:
+      return kAvx2Kernels;
+#endif
+#ifdef OVUM_LEXER_HAS_SSE2
+    case SimdLevel::kSse2:
+      return kSse2Kernels;
+#endif
+    default:
+      return kScalarKernels;
+  }
+}
+
+const ScanKernels& ActiveScanKernels() noexcept {
+  return *ActiveKernelsSlot().load(std::memory_order_relaxed);
+}
+
+SimdLevel ActiveSimdLevel() noexcept {
+  return ActiveLevelSlot().load(std::memory_order_relaxed);
+}
+
+void SetActiveSimdLevel(SimdLevel level) noexcept {
+  const SimdLevel supported = ClampToSupported(level);
+  ActiveLevelSlot().store(supported, std::memory_order_relaxed);
+  ActiveKernelsSlot().store(&GetScanKernels(supported), std::memory_order_relaxed);
+}
+
+} // namespace ovum::compiler::lexer
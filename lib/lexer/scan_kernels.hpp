@@ -0,0 +1,62 @@
+#ifndef LEXER_SCAN_KERNELS_HPP_
+#define LEXER_SCAN_KERNELS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ovum::compiler::lexer {
+
+enum class SimdLevel : std::uint8_t { kScalar, kSse2, kAvx2 };
+
+// Result of a run that may cross lines: last_newline is only meaningful when newlines > 0.
+struct ScanRun {
+  std::size_t end = 0;
+  std::size_t newlines = 0;
+  std::size_t last_newline = 0;
+};
+
+// Every kernel starts at pos and returns the first offset that stops the run, or src.size() if none does.
+struct ScanKernels {
+  std::size_t (*identifier_end)(std::string_view src, std::size_t pos) noexcept;
+  std::size_t (*whitespace_end)(std::string_view src, std::size_t pos) noexcept;
+  std::size_t (*string_special)(std::string_view src, std::size_t pos) noexcept; // '"', '\\' or '\n'
+  std::size_t (*line_end)(std::string_view src, std::size_t pos) noexcept;
+  ScanRun (*next_star)(std::string_view src, std::size_t pos) noexcept; // counts newlines skipped on the way
+};
+
+[[nodiscard]] SimdLevel DetectSimdLevel() noexcept;
+
+// Falls back to the best level below the requested one that this build and CPU support.
+[[nodiscard]] const ScanKernels& GetScanKernels(SimdLevel level) noexcept;
+
+[[nodiscard]] const ScanKernels& ActiveScanKernels() noexcept;
+
+[[nodiscard]] SimdLevel ActiveSimdLevel() noexcept;
+
+// Overrides runtime dispatch, e.g. to benchmark the scalar kernels against the vector ones.
+void SetActiveSimdLevel(SimdLevel level) noexcept;
+
+inline std::size_t FindIdentifierEnd(std::string_view src, std::size_t pos) noexcept {
+  return ActiveScanKernels().identifier_end(src, pos);
+}
+
+inline std::size_t FindWhitespaceEnd(std::string_view src, std::size_t pos) noexcept {
+  return ActiveScanKernels().whitespace_end(src, pos);
+}
+
+inline std::size_t FindStringSpecial(std::string_view src, std::size_t pos) noexcept {
+  return ActiveScanKernels().string_special(src, pos);
+}
+
+inline std::size_t FindLineEnd(std::string_view src, std::size_t pos) noexcept {
+  return ActiveScanKernels().line_end(src, pos);
+}
+
+inline ScanRun FindNextStar(std::string_view src, std::size_t pos) noexcept {
+  return ActiveScanKernels().next_star(src, pos);
+}
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_SCAN_KERNELS_HPP_
@@ -0,0 +1,110 @@
+#include "SourceBuffer.hpp"
+
+#include <array>
+#include <fstream>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ovum::compiler::lexer {
+
+namespace {
+
+constexpr std::size_t kReadChunkSize = 64 * 1024;
+
+std::expected<std::string, LexerError> ReadWholeFile(const std::filesystem::path& path) {
+  std::ifstream file_stream(path, std::ios::binary);
+
+  if (!file_stream.is_open()) {
+    return std::unexpected(LexerError("Cannot open"));
+  }
+
+  std::string content;
+  std::array<char, kReadChunkSize> chunk{};
+
+  while (file_stream.read(chunk.data(), static_cast<std::streamsize>(chunk.size())) || file_stream.gcount() > 0) {
+    content.append(chunk.data(), static_cast<std::size_t>(file_stream.gcount()));
+  }
+
+  if (file_stream.bad()) {
+    return std::unexpected(LexerError("Read error"));
+  }
+
+  return content;
+}
+
+} // namespace
+
+SourceBuffer::SourceBuffer(std::filesystem::path path, std::string content) :
+    path_(std::move(path)), owned_(std::move(content)) {
+}
+
+SourceBuffer::SourceBuffer(std::filesystem::path path, const char* mapped, std::size_t size) :
+    path_(std::move(path)), mapped_(mapped), mapped_size_(size) {
+}
+
+SourceBuffer::~SourceBuffer() {
+#ifndef _WIN32
+  if (mapped_ != nullptr) {
+    munmap(const_cast<char*>(mapped_), mapped_size_); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+  }
+#endif
+}
+
+std::expected<std::unique_ptr<SourceBuffer>, LexerError> SourceBuffer::MapFile(const std::filesystem::path& path) {
+#ifndef _WIN32
+  const int fd = open(path.c_str(), O_RDONLY); // NOLINT(cppcoreguidelines-pro-type-vararg)
+
+  if (fd < 0) {
+    return std::unexpected(LexerError("Cannot open"));
+  }
+
+  struct stat file_stat {};
+
+  if (fstat(fd, &file_stat) == 0 && S_ISREG(file_stat.st_mode) && file_stat.st_size > 0) {
+    const auto size = static_cast<std::size_t>(file_stat.st_size);
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (mapped != MAP_FAILED) {
+      // The lexer walks the file front to back exactly once; let the kernel read ahead aggressively.
+      posix_madvise(mapped, size, POSIX_MADV_SEQUENTIAL);
+
+      return std::unique_ptr<SourceBuffer>(new SourceBuffer(path, static_cast<const char*>(mapped), size));
+    }
+  } else {
+    close(fd);
+  }
+#endif
+
+  std::expected<std::string, LexerError> content_result = ReadWholeFile(path);
+
+  if (!content_result) {
+    return std::unexpected(content_result.error());
+  }
+
+  return std::make_unique<SourceBuffer>(path, std::move(content_result.value()));
+}
+
+std::string_view SourceBuffer::Text() const noexcept {
+  if (mapped_ != nullptr) {
+    return {mapped_, mapped_size_};
+  }
+
+  return owned_;
+}
+
+const std::filesystem::path& SourceBuffer::Path() const noexcept {
+  return path_;
+}
+
+bool SourceBuffer::IsMapped() const noexcept {
+  return mapped_ != nullptr;
+}
+
+} // namespace ovum::compiler::lexer
@@ -0,0 +1,48 @@
+#ifndef LEXER_SOURCEBUFFER_HPP_
+#define LEXER_SOURCEBUFFER_HPP_
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "lib/lexer/LexerError.hpp"
+
+namespace ovum::compiler::lexer {
+
+// Read-only text of one source file. Regular files are mapped, so tokens can view the text without copying it;
+// pipes, devices and empty files are read into an owned string instead. Text() stays valid and at the same address
+// for the buffer's lifetime.
+class SourceBuffer {
+public:
+  SourceBuffer(std::filesystem::path path, std::string content);
+  ~SourceBuffer();
+
+  SourceBuffer(const SourceBuffer&) = delete;
+  SourceBuffer& operator=(const SourceBuffer&) = delete;
+  SourceBuffer(SourceBuffer&&) = delete;
+  SourceBuffer& operator=(SourceBuffer&&) = delete;
+
+  [[nodiscard]] static std::expected<std::unique_ptr<SourceBuffer>, LexerError> MapFile(
+      const std::filesystem::path& path);
+
+  [[nodiscard]] std::string_view Text() const noexcept;
+
+  [[nodiscard]] const std::filesystem::path& Path() const noexcept;
+
+  [[nodiscard]] bool IsMapped() const noexcept;
+
+private:
+  SourceBuffer(std::filesystem::path path, const char* mapped, std::size_t size);
+
+  std::filesystem::path path_;
+  std::string owned_;
+  const char* mapped_ = nullptr;
+  std::size_t mapped_size_ = 0;
+};
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_SOURCEBUFFER_HPP_
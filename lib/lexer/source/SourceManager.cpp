@@ -0,0 +1,55 @@
+#include "SourceManager.hpp"
+
+#include <utility>
+
+namespace ovum::compiler::lexer {
+
+std::expected<const SourceBuffer*, LexerError> SourceManager::Load(const std::filesystem::path& path) {
+  if (const SourceBuffer* existing = Find(path); existing != nullptr) {
+    return existing;
+  }
+
+  std::expected<std::unique_ptr<SourceBuffer>, LexerError> buffer_result = SourceBuffer::MapFile(path);
+
+  if (!buffer_result) {
+    return std::unexpected(buffer_result.error());
+  }
+
+  // The file is mapped without holding the lock, so another thread may have loaded it in the meantime.
+  std::lock_guard lock(mutex_);
+
+  if (auto it = index_by_path_.find(path); it != index_by_path_.end()) {
+    return buffers_[it->second].get();
+  }
+
+  index_by_path_[path] = buffers_.size();
+  buffers_.push_back(std::move(buffer_result.value()));
+
+  return buffers_.back().get();
+}
+
+const SourceBuffer& SourceManager::AddBuffer(std::filesystem::path path, std::string content) {
+  std::lock_guard lock(mutex_);
+  index_by_path_[path] = buffers_.size();
+  buffers_.push_back(std::make_unique<SourceBuffer>(std::move(path), std::move(content)));
+
+  return *buffers_.back();
+}
+
+const SourceBuffer* SourceManager::Find(const std::filesystem::path& path) const {
+  std::lock_guard lock(mutex_);
+  auto it = index_by_path_.find(path);
+
+  if (it == index_by_path_.end()) {
+    return nullptr;
+  }
+
+  return buffers_[it->second].get();
+}
+
+std::size_t SourceManager::Size() const noexcept {
+  std::lock_guard lock(mutex_);
+  return buffers_.size();
+}
+
+} // namespace ovum::compiler::lexer
@@ -0,0 +1,38 @@
+#ifndef LEXER_SOURCEMANAGER_HPP_
+#define LEXER_SOURCEMANAGER_HPP_
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "SourceBuffer.hpp"
+#include "lib/lexer/LexerError.hpp"
+
+namespace ovum::compiler::lexer {
+
+// Owns every source buffer of a compilation, so token views into them stay valid until the manager dies.
+// Load, AddBuffer and Find may be called from several threads.
+class SourceManager {
+public:
+  [[nodiscard]] std::expected<const SourceBuffer*, LexerError> Load(const std::filesystem::path& path);
+
+  const SourceBuffer& AddBuffer(std::filesystem::path path, std::string content);
+
+  [[nodiscard]] const SourceBuffer* Find(const std::filesystem::path& path) const;
+
+  [[nodiscard]] std::size_t Size() const noexcept;
+
+private:
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<SourceBuffer>> buffers_;
+  std::unordered_map<std::filesystem::path, std::size_t> index_by_path_;
+};
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_SOURCEMANAGER_HPP_
@@ -0,0 +1,192 @@
+#include "token_materializer.hpp"
+
+#include <array>
+#include <optional>
+#include <string>
+
+#include <tokens/TokenFactory.hpp>
+
+#include "TokenBuffer.hpp"
+#include "literal_decoder.hpp"
+
+namespace ovum::compiler::lexer {
+
+namespace {
+
+constexpr std::array<TokenKind, 12> kAllTokenKinds{TokenKind::kIdent,
+                                                   TokenKind::kKeyword,
+                                                   TokenKind::kOperator,
+                                                   TokenKind::kPunct,
+                                                   TokenKind::kNewline,
+                                                   TokenKind::kComment,
+                                                   TokenKind::kEof,
+                                                   TokenKind::kIntLiteral,
+                                                   TokenKind::kFloatLiteral,
+                                                   TokenKind::kStringLiteral,
+                                                   TokenKind::kCharLiteral,
+                                                   TokenKind::kBoolLiteral};
+
+char DecodeEscape(char e) noexcept {
+  switch (e) {
+    case 'n':
+      return '\n';
+    case 't':
+      return '\t';
+    case 'r':
+      return '\r';
+    case '0':
+      return '\0';
+    default:
+      return e;
+  }
+}
+
+ovum::TokenPtr MaterializeNumber(const TokenView& view,
+                                 std::string_view lexeme,
+                                 std::optional<NumericLiteral>* number) {
+  const bool is_float = view.kind == TokenKind::kFloatLiteral;
+  const std::optional<NumericLiteral> literal = DecodeNumericLexeme(lexeme, is_float);
+
+  if (number != nullptr) {
+    *number = literal;
+  }
+
+  if (is_float) {
+    const auto value = static_cast<double>(literal ? literal->float_value : 0.0L);
+    return TokenFactory::MakeFloatLiteral(std::string(lexeme), value, view.line, view.column);
+  }
+
+  const long long value = literal ? literal->int_value : 0;
+  return TokenFactory::MakeIntLiteral(std::string(lexeme), value, view.line, view.column);
+}
+
+std::string DecodeStringLiteral(std::string_view raw) {
+  std::string out;
+  out.reserve(raw.size());
+
+  for (size_t i = 1; i + 1 < raw.size(); ++i) {
+    if (raw[i] == '\\') {
+      out.push_back(DecodeEscape(raw[++i]));
+    } else {
+      out.push_back(raw[i]);
+    }
+  }
+
+  return out;
+}
+
+char DecodeCharLiteral(std::string_view raw) noexcept {
+  if (raw[1] == '\\') {
+    return DecodeEscape(raw[2]);
+  }
+
+  return raw[1];
+}
+
+} // namespace
+
+std::string_view TokenKindToString(TokenKind kind) noexcept {
+  switch (kind) {
+    case TokenKind::kIdent:
+      return "IDENT";
+    case TokenKind::kKeyword:
+      return "KEYWORD";
+    case TokenKind::kOperator:
+      return "OPERATOR";
+    case TokenKind::kPunct:
+      return "PUNCT";
+    case TokenKind::kNewline:
+      return "NEWLINE";
+    case TokenKind::kComment:
+      return "COMMENT";
+    case TokenKind::kEof:
+      return "EOF";
+    case TokenKind::kIntLiteral:
+      return "LITERAL:Int";
+    case TokenKind::kFloatLiteral:
+      return "LITERAL:Float";
+    case TokenKind::kStringLiteral:
+      return "LITERAL:String";
+    case TokenKind::kCharLiteral:
+      return "LITERAL:Char";
+    case TokenKind::kBoolLiteral:
+      return "LITERAL:Bool";
+  }
+
+  return "";
+}
+
+std::optional<TokenKind> TokenKindFromString(std::string_view type) noexcept {
+  for (const TokenKind kind : kAllTokenKinds) {
+    if (TokenKindToString(kind) == type) {
+      return kind;
+    }
+  }
+
+  return std::nullopt;
+}
+
+std::string_view ViewLexeme(const TokenView& view, std::string_view src) noexcept {
+  return src.substr(view.offset, view.length);
+}
+
+ovum::TokenPtr MaterializeToken(const TokenView& view, std::string_view src, std::optional<NumericLiteral>* number) {
+  const std::string_view lexeme = ViewLexeme(view, src);
+
+  if (number != nullptr) {
+    number->reset();
+  }
+
+  switch (view.kind) {
+    case TokenKind::kIdent:
+      return TokenFactory::MakeIdent(std::string(lexeme), view.line, view.column);
+    case TokenKind::kKeyword:
+      return TokenFactory::MakeKeyword(std::string(lexeme), view.line, view.column);
+    case TokenKind::kOperator:
+      return TokenFactory::MakeOperator(std::string(lexeme), view.line, view.column);
+    case TokenKind::kPunct:
+      return TokenFactory::MakePunct(lexeme.front(), view.line, view.column);
+    case TokenKind::kNewline:
+      return TokenFactory::MakeNewline(view.line, view.column);
+    case TokenKind::kComment:
+      return TokenFactory::MakeComment(std::string(lexeme), view.line, view.column);
+    case TokenKind::kEof:
+      return TokenFactory::MakeEof(view.line, view.column);
+    case TokenKind::kIntLiteral:
+    case TokenKind::kFloatLiteral:
+      return MaterializeNumber(view, lexeme, number);
+    case TokenKind::kStringLiteral:
+      return TokenFactory::MakeStringLiteral(
+          std::string(lexeme), DecodeStringLiteral(lexeme), view.line, view.column);
+    case TokenKind::kCharLiteral:
+      return TokenFactory::MakeCharLiteral(std::string(lexeme), DecodeCharLiteral(lexeme), view.line, view.column);
+    case TokenKind::kBoolLiteral:
+      return TokenFactory::MakeBoolLiteral(std::string(lexeme), lexeme == "true", view.line, view.column);
+  }
+
+  return nullptr;
+}
+
+std::vector<ovum::TokenPtr> MaterializeTokens(const std::vector<TokenView>& views, std::string_view src) {
+  std::vector<ovum::TokenPtr> tokens;
+  tokens.reserve(views.size());
+
+  for (const TokenView& view : views) {
+    tokens.push_back(MaterializeToken(view, src));
+  }
+
+  return tokens;
+}
+
+std::vector<ovum::TokenPtr> MaterializeTokens(const TokenBuffer& buffer) {
+  std::vector<ovum::TokenPtr> tokens;
+  tokens.reserve(buffer.Size());
+
+  for (std::size_t i = 0; i < buffer.Size(); ++i) {
+    tokens.push_back(MaterializeToken(buffer.View(i), buffer.Source(buffer.SourceOf(i))));
+  }
+
+  return tokens;
+}
+
+} // namespace ovum::compiler::lexer
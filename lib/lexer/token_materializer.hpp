@@ -0,0 +1,40 @@
+#ifndef LEXER_TOKEN_MATERIALIZER_HPP_
+#define LEXER_TOKEN_MATERIALIZER_HPP_
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <tokens/Token.hpp>
+
+#include "TokenKind.hpp"
+#include "TokenView.hpp"
+#include "literal_decoder.hpp"
+
+namespace ovum::compiler::lexer {
+
+// Returns the string type reported by Token::GetStringType() for tokens of this kind.
+[[nodiscard]] std::string_view TokenKindToString(TokenKind kind) noexcept;
+
+// Inverse of TokenKindToString; nullopt for string types the lexer never produces (e.g. "LITERAL:Byte").
+[[nodiscard]] std::optional<TokenKind> TokenKindFromString(std::string_view type) noexcept;
+
+// Text of the token inside its source buffer (newline tokens map to the '\n' itself).
+[[nodiscard]] std::string_view ViewLexeme(const TokenView& view, std::string_view src) noexcept;
+
+class TokenBuffer;
+
+// Builds the heap token the rest of the pipeline expects; literal values are decoded from the source text. When
+// number is given it receives the decoded value of an int or float literal (nullopt for other tokens), so a caller
+// that keeps it next to the token never decodes the lexeme again.
+[[nodiscard]] ovum::TokenPtr MaterializeToken(const TokenView& view,
+                                              std::string_view src,
+                                              std::optional<NumericLiteral>* number = nullptr);
+
+[[nodiscard]] std::vector<ovum::TokenPtr> MaterializeTokens(const std::vector<TokenView>& views, std::string_view src);
+
+[[nodiscard]] std::vector<ovum::TokenPtr> MaterializeTokens(const TokenBuffer& buffer);
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_TOKEN_MATERIALIZER_HPP_
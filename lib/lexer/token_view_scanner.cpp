@@ -0,0 +1,466 @@
+#include "token_view_scanner.hpp"
+
+#include <cctype>
+#include <cstdint>
+#include <string>
+
+#include "char_class.hpp"
+#include "lexeme_recognizer.hpp"
+#include "literal_decoder.hpp"
+#include "scan_kernels.hpp"
+
+namespace ovum::compiler::lexer {
+
+namespace {
+
+inline bool IsDec(char c) noexcept {
+  return std::isdigit(static_cast<unsigned char>(c)) != 0;
+}
+
+inline bool IsHex(char c) noexcept {
+  const auto u = static_cast<unsigned char>(c);
+  return std::isdigit(u) != 0 || (u >= 'a' && u <= 'f') || (u >= 'A' && u <= 'F');
+}
+
+inline bool IsBin(char c) noexcept {
+  return c == '0' || c == '1';
+}
+
+inline bool IsIdentStart(char c) noexcept {
+  const auto u = static_cast<unsigned char>(c);
+  return std::isalpha(u) != 0 || u == '_';
+}
+
+template<typename Predicate>
+inline void SkipWhile(SourceCodeWrapper& w, Predicate pred) {
+  while (!w.IsAtEnd() && pred(w.Peek())) {
+    w.Advance();
+  }
+}
+
+inline std::expected<bool, LexerError> SkipExponent(SourceCodeWrapper& w) {
+  if (w.Peek() == 'e' || w.Peek() == 'E') {
+    w.Advance();
+
+    if (w.Peek() == '+' || w.Peek() == '-') {
+      w.Advance();
+    }
+
+    if (!IsDec(w.Peek())) {
+      return std::unexpected(LexerError("Malformed exponent"));
+    }
+
+    SkipWhile(w, IsDec);
+    return true;
+  }
+
+  return false;
+}
+
+inline std::expected<void, LexerError> EnsureNoIdentTail(SourceCodeWrapper& w, const char* ctx) {
+  if (IsIdentStart(w.Peek())) {
+    return std::unexpected(LexerError(std::string("Unexpected identifier after ") + ctx));
+  }
+
+  return {};
+}
+
+inline std::expected<void, LexerError> EnsureNoSecondDotWithDigits(SourceCodeWrapper& w) {
+  if (w.Peek() == '.' && IsDec(w.Peek(1))) {
+    return std::unexpected(LexerError("Malformed float literal: duplicate decimal point"));
+  }
+
+  return {};
+}
+
+inline std::expected<void, LexerError> ValidateDouble(std::string_view raw) {
+  if (!DecodeFloatLexeme(raw)) {
+    return std::unexpected(LexerError(std::string("Malformed float literal: ") + std::string(raw)));
+  }
+
+  return {};
+}
+
+inline std::expected<void, LexerError> ValidateDecInt(std::string_view raw) {
+  if (!DecodeIntegerLexeme(raw)) {
+    return std::unexpected(LexerError(std::string("Malformed integer literal: ") + std::string(raw)));
+  }
+
+  return {};
+}
+
+TokenView MakeView(const SourceCodeWrapper& w, TokenKind kind, size_t offset, size_t length) noexcept {
+  const bool tracked = w.IsTrackingPositions();
+
+  return TokenView{.kind = kind,
+                   .offset = static_cast<uint32_t>(offset),
+                   .length = static_cast<uint32_t>(length),
+                   .line = tracked ? w.GetLine() : 0,
+                   .column = tracked ? w.GetTokenCol() : 0};
+}
+
+TokenView MakeTokenView(const SourceCodeWrapper& w, TokenKind kind) noexcept {
+  const size_t start = w.GetTokenStart();
+  return MakeView(w, kind, start, w.GetOffset() - start);
+}
+
+std::expected<void, LexerError> ScanIdentifier(SourceCodeWrapper& w, std::vector<TokenView>& out) {
+  w.AdvanceInLine(FindIdentifierEnd(w.GetSource(), w.GetOffset()));
+
+  const size_t start = w.GetTokenStart();
+  const std::string_view s = w.GetSource().substr(start, w.GetOffset() - start);
+
+  switch (ClassifyWord(s)) {
+    case WordClass::kFloatLiteral:
+      out.push_back(MakeTokenView(w, TokenKind::kFloatLiteral));
+      return {};
+    case WordClass::kBoolLiteral:
+      out.push_back(MakeTokenView(w, TokenKind::kBoolLiteral));
+      return {};
+    case WordClass::kKeyword:
+      out.push_back(MakeTokenView(w, TokenKind::kKeyword));
+      return {};
+    case WordClass::kIdentifier:
+      break;
+  }
+
+  if (s[0] == '#') {
+    return std::unexpected(LexerError(std::string("Not a keyword, started with #: ") + std::string(s)));
+  }
+
+  out.push_back(MakeTokenView(w, TokenKind::kIdent));
+  return {};
+}
+
+std::expected<void, LexerError> ScanNumber(SourceCodeWrapper& w, std::vector<TokenView>& out) {
+  const size_t start = w.GetTokenStart();
+  auto raw = [&w, start]() { return w.GetSource().substr(start, w.GetOffset() - start); };
+
+  if (w.CurrentChar() == '.') {
+    SkipWhile(w, IsDec);
+
+    if (auto exp_result = SkipExponent(w); !exp_result) {
+      return std::unexpected(exp_result.error());
+    }
+
+    if (auto dot_result = EnsureNoSecondDotWithDigits(w); !dot_result) {
+      return dot_result;
+    }
+
+    if (auto ident_result = EnsureNoIdentTail(w, "number"); !ident_result) {
+      return ident_result;
+    }
+
+    if (auto v_result = ValidateDouble(raw()); !v_result) {
+      return v_result;
+    }
+
+    out.push_back(MakeTokenView(w, TokenKind::kFloatLiteral));
+    return {};
+  }
+
+  w.RetreatOne();
+
+  if (w.Peek() == '0' && (w.Peek(1) == 'x' || w.Peek(1) == 'X')) {
+    w.Advance();
+    w.Advance();
+
+    if (!IsHex(w.Peek())) {
+      return std::unexpected(LexerError("Malformed hex literal: expected hex digit after 0x"));
+    }
+
+    SkipWhile(w, IsHex);
+
+    if (w.Peek() == '.') {
+      return std::unexpected(LexerError("Hex literal cannot have decimal point"));
+    }
+
+    if (auto ident_result = EnsureNoIdentTail(w, "hex literal"); !ident_result) {
+      return ident_result;
+    }
+
+    out.push_back(MakeTokenView(w, TokenKind::kIntLiteral));
+    return {};
+  }
+
+  if (w.Peek() == '0' && (w.Peek(1) == 'b' || w.Peek(1) == 'B')) {
+    w.Advance();
+    w.Advance();
+
+    if (!IsBin(w.Peek())) {
+      return std::unexpected(LexerError("Malformed binary literal: expected binary digit after 0b"));
+    }
+
+    SkipWhile(w, IsBin);
+
+    if (w.Peek() == '.') {
+      return std::unexpected(LexerError("Binary literal cannot have decimal point"));
+    }
+
+    if (auto ident_result = EnsureNoIdentTail(w, "binary literal"); !ident_result) {
+      return ident_result;
+    }
+
+    out.push_back(MakeTokenView(w, TokenKind::kIntLiteral));
+    return {};
+  }
+
+  SkipWhile(w, IsDec);
+
+  if (w.Peek() == '.') {
+    w.Advance();
+    SkipWhile(w, IsDec);
+
+    if (auto exp_result = SkipExponent(w); !exp_result) {
+      return std::unexpected(exp_result.error());
+    }
+
+    if (auto dot_result = EnsureNoSecondDotWithDigits(w); !dot_result) {
+      return dot_result;
+    }
+
+    if (auto ident_result = EnsureNoIdentTail(w, "number"); !ident_result) {
+      return ident_result;
+    }
+
+    if (auto v_result = ValidateDouble(raw()); !v_result) {
+      return v_result;
+    }
+
+    out.push_back(MakeTokenView(w, TokenKind::kFloatLiteral));
+    return {};
+  }
+
+  auto exp_result = SkipExponent(w);
+
+  if (!exp_result) {
+    return std::unexpected(exp_result.error());
+  }
+
+  if (exp_result.value()) {
+    if (auto ident_result = EnsureNoIdentTail(w, "number"); !ident_result) {
+      return ident_result;
+    }
+
+    if (auto v_result = ValidateDouble(raw()); !v_result) {
+      return v_result;
+    }
+
+    out.push_back(MakeTokenView(w, TokenKind::kFloatLiteral));
+    return {};
+  }
+
+  // Byte literal: the 'b' suffix stays in the lexeme, the parser relies on it.
+  if (w.Peek() == 'b' || w.Peek() == 'B') {
+    if (auto vi_result = ValidateDecInt(raw()); !vi_result) {
+      return vi_result;
+    }
+
+    w.Advance();
+    out.push_back(MakeTokenView(w, TokenKind::kIntLiteral));
+    return {};
+  }
+
+  if (auto ident_result = EnsureNoIdentTail(w, "integer literal"); !ident_result) {
+    return ident_result;
+  }
+
+  if (auto vi_result = ValidateDecInt(raw()); !vi_result) {
+    return vi_result;
+  }
+
+  out.push_back(MakeTokenView(w, TokenKind::kIntLiteral));
+  return {};
+}
+
+std::expected<void, LexerError> ScanString(SourceCodeWrapper& w, std::vector<TokenView>& out) {
+  while (!w.IsAtEnd()) {
+    w.AdvanceInLine(FindStringSpecial(w.GetSource(), w.GetOffset()));
+
+    if (w.IsAtEnd()) {
+      break;
+    }
+
+    const char c = w.Advance();
+
+    if (c == '"') {
+      out.push_back(MakeTokenView(w, TokenKind::kStringLiteral));
+      return {};
+    }
+
+    if (c == '\\') {
+      if (w.IsAtEnd()) {
+        return std::unexpected(LexerError("Unterminated string literal (backslash at EOF)"));
+      }
+
+      const char e = w.Advance();
+
+      switch (e) {
+        case 'n':
+        case 't':
+        case 'r':
+        case '\\':
+        case '"':
+        case '0':
+          break;
+        default:
+          return std::unexpected(LexerError(std::string("Unknown escape in string literal: \\") + e));
+      }
+    } else if (c == '\n') {
+      return std::unexpected(LexerError("Unterminated string literal (newline inside)"));
+    }
+  }
+
+  return std::unexpected(LexerError("Unterminated string literal (EOF reached)"));
+}
+
+std::expected<void, LexerError> ScanChar(SourceCodeWrapper& w, std::vector<TokenView>& out) {
+  if (w.Peek() == '\\') {
+    w.Advance();
+    const char e = w.Advance();
+
+    switch (e) {
+      case 'n':
+      case 't':
+      case '\\':
+      case '\'':
+      case '0':
+        break;
+      default:
+        return std::unexpected(LexerError(std::string("Unknown escape in char literal: \\") + e));
+    }
+  } else {
+    w.Advance();
+  }
+
+  if (w.IsAtEnd()) {
+    return std::unexpected(LexerError("Unterminated char literal"));
+  }
+
+  if (w.Peek() == '\n') {
+    return std::unexpected(LexerError("Newline in char literal"));
+  }
+
+  if (w.Peek() != '\'') {
+    return std::unexpected(LexerError("Too many characters in char literal"));
+  }
+
+  w.Advance();
+  out.push_back(MakeTokenView(w, TokenKind::kCharLiteral));
+  return {};
+}
+
+std::expected<void, LexerError> ScanSlash(SourceCodeWrapper& w, std::vector<TokenView>& out) {
+  const size_t start = w.GetTokenStart();
+
+  if (w.Peek() == '/') {
+    w.AdvanceInLine(FindLineEnd(w.GetSource(), w.GetOffset()));
+
+    if (w.IsKeepComments()) {
+      out.push_back(MakeView(w, TokenKind::kComment, start + 2, w.GetOffset() - start - 2));
+    }
+
+    return {};
+  }
+
+  if (w.Peek() == '*') {
+    w.Advance();
+
+    while (!w.IsAtEnd()) {
+      w.AdvanceOver(FindNextStar(w.GetSource(), w.GetOffset()));
+
+      if (w.IsAtEnd()) {
+        break;
+      }
+
+      w.Advance();
+
+      if (w.Peek() == '/') {
+        w.Advance();
+
+        if (w.IsKeepComments()) {
+          out.push_back(MakeView(w, TokenKind::kComment, start + 2, w.GetOffset() - start - 4));
+        }
+
+        return {};
+      }
+    }
+
+    return std::unexpected(LexerError("Unterminated block comment"));
+  }
+
+  out.push_back(MakeTokenView(w, TokenKind::kOperator));
+  return {};
+}
+
+void ScanOperator(SourceCodeWrapper& w, TokenKind single_kind, std::vector<TokenView>& out) {
+  if (IsMultiOpPair(w.CurrentChar(), w.Peek())) {
+    w.Advance();
+    out.push_back(MakeTokenView(w, TokenKind::kOperator));
+    return;
+  }
+
+  out.push_back(MakeTokenView(w, single_kind));
+}
+
+} // namespace
+
+std::expected<void, LexerError> ScanTokenView(SourceCodeWrapper& w, char first, std::vector<TokenView>& out) {
+  switch (ClassifyChar(first)) {
+    case CharClass::kWhitespace:
+      w.AdvanceInLine(FindWhitespaceEnd(w.GetSource(), w.GetOffset()));
+      return {};
+    case CharClass::kNewline: {
+      TokenView newline = MakeTokenView(w, TokenKind::kNewline);
+
+      if (w.IsTrackingPositions()) {
+        newline.line = w.GetLine() - 1;
+      }
+
+      out.push_back(newline);
+      return {};
+    }
+    case CharClass::kIdentStart:
+      return ScanIdentifier(w, out);
+    case CharClass::kDigit:
+      return ScanNumber(w, out);
+    case CharClass::kDot:
+      if (IsDec(w.Peek())) {
+        return ScanNumber(w, out);
+      }
+
+      ScanOperator(w, TokenKind::kOperator, out);
+      return {};
+    case CharClass::kQuote:
+      return ScanString(w, out);
+    case CharClass::kApostrophe:
+      return ScanChar(w, out);
+    case CharClass::kSlash:
+      return ScanSlash(w, out);
+    case CharClass::kColon:
+      ScanOperator(w, TokenKind::kPunct, out);
+      return {};
+    case CharClass::kOperator:
+      ScanOperator(w, TokenKind::kOperator, out);
+      return {};
+    case CharClass::kPunct:
+      out.push_back(MakeTokenView(w, TokenKind::kPunct));
+      return {};
+    case CharClass::kInvalid:
+      break;
+  }
+
+  return std::unexpected(LexerError(std::string("Unexpected character: ") + first));
+}
+
+TokenView MakeEofView(const SourceCodeWrapper& w) noexcept {
+  TokenView eof = MakeView(w, TokenKind::kEof, w.GetSource().size(), 0);
+
+  if (w.IsTrackingPositions()) {
+    eof.column = w.GetCol();
+  }
+
+  return eof;
+}
+
+} // namespace ovum::compiler::lexer
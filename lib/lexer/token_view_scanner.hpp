@@ -0,0 +1,21 @@
+#ifndef LEXER_TOKEN_VIEW_SCANNER_HPP_
+#define LEXER_TOKEN_VIEW_SCANNER_HPP_
+
+#include <expected>
+#include <vector>
+
+#include "LexerError.hpp"
+#include "SourceCodeWrapper.hpp"
+#include "TokenView.hpp"
+
+namespace ovum::compiler::lexer {
+
+// Scans the token whose first character was just consumed from the wrapper, dispatching on its CharClass.
+// Whitespace and dropped comments append nothing; every other token appends exactly one view.
+std::expected<void, LexerError> ScanTokenView(SourceCodeWrapper& w, char first, std::vector<TokenView>& out);
+
+[[nodiscard]] TokenView MakeEofView(const SourceCodeWrapper& w) noexcept;
+
+} // namespace ovum::compiler::lexer
+
+#endif // LEXER_TOKEN_VIEW_SCANNER_HPP_
@@ -1,18 +1,69 @@
 #include "ParserFsm.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <string_view>
 #include <utility>
 
 #include "context/ContextParser.hpp"
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
+#include "lib/parser/ast/nodes/stmts/Block.hpp"
 #include "lib/parser/diagnostics/IDiagnosticSink.hpp"
 #include "lib/parser/states/base/IState.hpp"
+#include "lib/parser/states/base/StateBase.hpp"
 #include "lib/parser/states/base/StateError.hpp"
 #include "lib/parser/states/base/StateRegistry.hpp"
 #include "lib/parser/tokens/token_streams/ITokenStream.hpp"
+#include "lib/parser/tokens/token_streams/TokenBufferStream.hpp"
 #include "recovery/SimpleRecovery.hpp"
 
 namespace ovum::compiler::parser {
 
+namespace {
+
+// Parses skipped bodies out of the buffer they were skipped in, with a parser of its own. Its factory keeps the arena
+// the bodies are allocated from, so they stay valid for as long as a declaration refers to this source.
+class TokenBufferBodySource : public IDeferredBodySource {
+public:
+  TokenBufferBodySource(const lexer::TokenBuffer& tokens, IDiagnosticSink& diags, ParserComponents components) :
+      tokens_(tokens), diags_(diags),
+      parser_(std::move(components.expr), std::move(components.type), components.factory) {
+    // Bodies are not part of a module, so their arena is started here.
+    (void) components.factory->StartArena();
+  }
+
+  [[nodiscard]] std::optional<std::size_t> FindBodyEnd(std::size_t open) const override {
+    std::size_t depth = 0;
+
+    for (std::size_t i = open; i + 1 < tokens_.Size(); ++i) {
+      if (tokens_.Kind(i) != lexer::TokenKind::kPunct) {
+        continue;
+      }
+
+      if (const std::string_view lexeme = tokens_.Lexeme(i); lexeme == "{") {
+        ++depth;
+      } else if (lexeme == "}" && depth != 0 && --depth == 0) {
+        return i + 1;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  std::unique_ptr<Block> ParseBody(std::size_t begin, std::size_t end) override {
+    TokenBufferStream stream(tokens_, begin, end);
+    return parser_.ParseBody(stream, diags_);
+  }
+
+private:
+  const lexer::TokenBuffer& tokens_;
+  IDiagnosticSink& diags_;
+  ParserFsm parser_;
+};
+
+} // namespace
+
 ParserFsm::ParserFsm(std::unique_ptr<IExpressionParser> expr,
                      std::unique_ptr<ITypeParser> typep,
                      std::shared_ptr<IAstFactory> factory) :
@@ -20,16 +71,102 @@ ParserFsm::ParserFsm(std::unique_ptr<IExpressionParser> expr,
 }
 
 std::unique_ptr<Module> ParserFsm::Parse(ITokenStream& ts, IDiagnosticSink& diags) {
+  return ParseModule(ts, diags, nullptr);
+}
+
+std::unique_ptr<Module> ParserFsm::Parse(const lexer::TokenBuffer& tokens, IDiagnosticSink& diags) {
+  if (make_body_components_) {
+    TokenBufferStream stream(tokens);
+    return ParseModule(stream, diags, std::make_shared<TokenBufferBodySource>(tokens, diags, make_body_components_()));
+  }
+
+  if (make_components_) {
+    std::optional<std::unique_ptr<Module>> module =
+        TryParseParallel(tokens, factory_.get(), diags, make_components_, parallel_options_);
+
+    if (module.has_value()) {
+      return std::move(*module);
+    }
+  }
+
+  TokenBufferStream stream(tokens);
+  return Parse(stream, diags);
+}
+
+void ParserFsm::EnableParallelParse(ParserComponentsFactory make_components, ParallelParseOptions options) {
+  make_components_ = std::move(make_components);
+  parallel_options_ = options;
+}
+
+void ParserFsm::EnableLazyBodies(ParserComponentsFactory make_components) {
+  make_body_components_ = std::move(make_components);
+}
+
+std::unique_ptr<Block> ParserFsm::ParseBody(ITokenStream& ts, IDiagnosticSink& diags) {
+  if (ts.IsEof() || ts.Peek().GetLexeme() != "{") {
+    diags.Error("P0001", "expected '{' to open a body");
+    return nullptr;
+  }
+
+  const Token& open = ts.Peek();
+  std::unique_ptr<Block> block =
+      factory_ != nullptr ? factory_->MakeBlock({}, StateBase::SpanFrom(open)) : std::make_unique<Block>();
+  (void) ts.Consume();
+
   ContextParser context;
+  Configure(context, diags);
+  context.PushNode(std::move(block));
+  context.PushState(StateRegistry::Block());
+  Run(context, ts, diags);
+
+  // Error recovery may leave the statement it gave up on above the block.
+  while (context.NodeStack().size() > 1) {
+    (void) context.PopNode();
+  }
+
+  std::unique_ptr<AstNode> root = context.PopNode();
+
+  if (auto* as_block = DynCast<Block>(root.get()); as_block != nullptr) {
+    [[maybe_unused]] auto* realized = root.release();
+    return std::unique_ptr<Block>(as_block);
+  }
+
+  return nullptr;
+}
+
+std::unique_ptr<Module> ParserFsm::ParseModule(ITokenStream& ts,
+                                               IDiagnosticSink& diags,
+                                               std::shared_ptr<IDeferredBodySource> deferred_bodies) {
+  ContextParser context;
+  Configure(context, diags);
+  context.SetDeferredBodies(std::move(deferred_bodies));
+  context.PushState(StateRegistry::Module());
+  Run(context, ts, diags);
+
+  std::unique_ptr<AstNode> root = context.PopNode();
+
+  if (!root) {
+    return std::make_unique<Module>();
+  }
+
+  if (auto* as_module = DynCast<Module>(root.get()); as_module != nullptr) {
+    [[maybe_unused]] auto* realized = root.release();
+    return std::unique_ptr<Module>(as_module);
+  }
+
+  return std::make_unique<Module>();
+}
+
+void ParserFsm::Configure(ContextParser& context, IDiagnosticSink& diags) const {
   context.SetDiagnostics(&diags);
   context.SetExpr(expr_parser_.get());
   context.SetTypeParser(type_parser_.get());
   context.SetFactory(factory_.get());
+}
 
+void ParserFsm::Run(ContextParser& context, ITokenStream& ts, IDiagnosticSink& diags) {
   SimpleRecovery recovery;
 
-  context.PushState(StateRegistry::Module());
-
   while (const IState* state = context.CurrentState()) {
     auto step = state->TryStep(context, ts);
 
@@ -45,19 +182,6 @@ std::unique_ptr<Module> ParserFsm::Parse(ITokenStream& ts, IDiagnosticSink& diag
       context.PopState();
     }
   }
-
-  std::unique_ptr<AstNode> root = context.PopNode();
-
-  if (!root) {
-    return std::make_unique<Module>();
-  }
-
-  if (auto* as_module = dynamic_cast<Module*>(root.get()); as_module != nullptr) {
-    [[maybe_unused]] auto* realized = root.release();
-    return std::unique_ptr<Module>(as_module);
-  }
-
-  return std::make_unique<Module>();
 }
 
 } // namespace ovum::compiler::parser
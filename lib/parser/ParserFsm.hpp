@@ -5,11 +5,16 @@
 
 #include "IParser.hpp"
 #include "ast/IAstFactory.hpp"
+#include "ast/LazyBody.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+#include "parallel_parser.hpp"
 #include "pratt/IExpressionParser.hpp"
 #include "type_parser/ITypeParser.hpp"
 
 namespace ovum::compiler::parser {
 
+class ContextParser;
+
 class ParserFsm : public IParser { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
   ParserFsm(std::unique_ptr<IExpressionParser> expr,
@@ -20,10 +25,35 @@ public:
 
   std::unique_ptr<Module> Parse(ITokenStream& ts, IDiagnosticSink& diags) override;
 
+  // Parses straight from the preprocessor's struct-of-arrays output through a TokenBufferStream.
+  std::unique_ptr<Module> Parse(const lexer::TokenBuffer& tokens, IDiagnosticSink& diags);
+
+  // Lets the TokenBuffer overload split large modules at top-level declarations and parse the pieces on worker
+  // threads, each with components from make_components. Falls back to a serial parse whenever a piece has errors.
+  void EnableParallelParse(ParserComponentsFactory make_components, ParallelParseOptions options = {});
+
+  // Makes the TokenBuffer overload skip function, method and call bodies in braces by brace matching and record their
+  // token ranges; each body is parsed, with components from make_components, when a pass first asks for it. The
+  // tokens and diagnostic sink given to Parse must then outlive the module, and syntax errors inside a body are
+  // reported when it is first accessed. Takes precedence over parallel parsing.
+  void EnableLazyBodies(ParserComponentsFactory make_components);
+
+  // Parses one braced body starting at the next token of ts.
+  std::unique_ptr<Block> ParseBody(ITokenStream& ts, IDiagnosticSink& diags);
+
 private:
+  std::unique_ptr<Module> ParseModule(ITokenStream& ts,
+                                      IDiagnosticSink& diags,
+                                      std::shared_ptr<IDeferredBodySource> deferred_bodies);
+  void Configure(ContextParser& context, IDiagnosticSink& diags) const;
+  static void Run(ContextParser& context, ITokenStream& ts, IDiagnosticSink& diags);
+
   std::unique_ptr<IExpressionParser> expr_parser_;
   std::unique_ptr<ITypeParser> type_parser_;
   std::shared_ptr<IAstFactory> factory_;
+  ParserComponentsFactory make_components_;
+  ParallelParseOptions parallel_options_;
+  ParserComponentsFactory make_body_components_;
 };
 
 } // namespace ovum::compiler::parser
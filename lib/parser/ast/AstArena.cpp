@@ -0,0 +1,75 @@
+#include "AstArena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace ovum::compiler::parser {
+
+namespace {
+
+constexpr std::size_t kFirstBlockSize = 64U << 10U;
+constexpr std::size_t kMaxBlockSize = 1U << 20U;
+
+thread_local AstArena* current_arena = nullptr;
+
+} // namespace
+
+AstArena::Scope::Scope(AstArena* arena) noexcept : previous_(current_arena) {
+  current_arena = arena;
+}
+
+AstArena::Scope::~Scope() {
+  current_arena = previous_;
+}
+
+void* AstArena::Allocate(std::size_t size, std::size_t alignment) {
+  auto aligned = [alignment](std::byte* pointer) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto address = reinterpret_cast<std::uintptr_t>(pointer);
+    return pointer + ((alignment - address % alignment) % alignment);
+  };
+
+  std::byte* start = cursor_ == nullptr ? nullptr : aligned(cursor_);
+
+  if (start == nullptr || static_cast<std::size_t>(end_ - start) < size) {
+    AddBlock(size + alignment);
+    start = aligned(cursor_);
+  }
+
+  cursor_ = start + size;
+  ++allocations_;
+  bytes_ += size;
+
+  return start;
+}
+
+AstArena* AstArena::Current() noexcept {
+  return current_arena;
+}
+
+std::size_t AstArena::AllocationCount() const noexcept {
+  return allocations_;
+}
+
+std::size_t AstArena::BlockCount() const noexcept {
+  return blocks_.size();
+}
+
+std::size_t AstArena::BytesAllocated() const noexcept {
+  return bytes_;
+}
+
+void AstArena::AddBlock(std::size_t min_size) {
+  if (next_block_size_ == 0) {
+    next_block_size_ = kFirstBlockSize;
+  }
+
+  // Blocks double up to kMaxBlockSize; an oversized node gets a block of its own.
+  const std::size_t size = std::max(next_block_size_, min_size);
+  next_block_size_ = std::min(next_block_size_ * 2, kMaxBlockSize);
+  blocks_.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+  cursor_ = blocks_.back().get();
+  end_ = cursor_ + size;
+}
+
+} // namespace ovum::compiler::parser
@@ -0,0 +1,57 @@
+#ifndef PARSER_ASTARENA_HPP_
+#define PARSER_ASTARENA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ovum::compiler::parser {
+
+// Bump allocator for AST nodes. While a Scope is open on a thread, every AstNode created there takes its memory
+// from the arena; deleting such a node still runs its destructor but returns nothing, and the memory goes back in
+// a few large blocks when the arena dies. Nodes must not outlive their arena (a Module keeps its own alive). One
+// arena is filled from one thread at a time.
+class AstArena {
+public:
+  // Makes arena the current one on this thread until destroyed; a null arena restores heap allocation.
+  class Scope {
+  public:
+    explicit Scope(AstArena* arena) noexcept;
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    AstArena* previous_;
+  };
+
+  AstArena() = default;
+  AstArena(const AstArena&) = delete;
+  AstArena& operator=(const AstArena&) = delete;
+
+  [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment);
+
+  // The arena of the innermost open Scope on this thread, or nullptr.
+  [[nodiscard]] static AstArena* Current() noexcept;
+
+  [[nodiscard]] std::size_t AllocationCount() const noexcept;
+
+  [[nodiscard]] std::size_t BlockCount() const noexcept;
+
+  [[nodiscard]] std::size_t BytesAllocated() const noexcept;
+
+private:
+  void AddBlock(std::size_t min_size);
+
+  std::vector<std::unique_ptr<std::byte[]>> blocks_;
+  std::byte* cursor_ = nullptr;
+  std::byte* end_ = nullptr;
+  std::size_t next_block_size_ = 0;
+  std::size_t allocations_ = 0;
+  std::size_t bytes_ = 0;
+};
+
+} // namespace ovum::compiler::parser
+
+#endif // PARSER_ASTARENA_HPP_
@@ -6,15 +6,42 @@
 
 namespace ovum::compiler::parser {
 
+BuilderAstFactory::BuilderAstFactory(AstAllocation allocation) : allocation_(allocation) {
+}
+
+AstArena* BuilderAstFactory::Arena() const noexcept {
+  return arena_.get();
+}
+
+std::shared_ptr<AstArena> BuilderAstFactory::StartArena() {
+  if (allocation_ == AstAllocation::kArena) {
+    arena_ = std::make_shared<AstArena>();
+  }
+
+  return arena_;
+}
+
 // Decls / Module
 
 std::unique_ptr<Module> BuilderAstFactory::MakeModule(std::string name,
                                                       SourceId source_id,
                                                       std::vector<std::unique_ptr<Decl>> decls,
                                                       SourceSpan span) {
+  const bool adopts_decls = !decls.empty();
   auto b = ParserBuilder::Make<Module>();
   b.WithName(std::move(name)).WithSource(source_id).WithDecls(std::move(decls)).WithSpan(span);
-  return b.Build();
+  std::unique_ptr<Module> module = b.Build();
+
+  // Each module starts an arena of its own, so its nodes are released together with it.
+  if (allocation_ == AstAllocation::kArena) {
+    if (adopts_decls && arena_ != nullptr) {
+      module->RetainArena(arena_);
+    }
+
+    module->RetainArena(StartArena());
+  }
+
+  return module;
 }
 
 std::unique_ptr<FunctionDecl> BuilderAstFactory::MakeFunction(bool is_pure,
@@ -23,6 +50,7 @@ std::unique_ptr<FunctionDecl> BuilderAstFactory::MakeFunction(bool is_pure,
                                                               std::unique_ptr<TypeReference> return_type,
                                                               std::unique_ptr<Block> body,
                                                               SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<FunctionDecl>();
   b.WithPure(is_pure)
       .WithName(std::move(name))
@@ -37,6 +65,7 @@ std::unique_ptr<ClassDecl> BuilderAstFactory::MakeClass(std::string name,
                                                         std::vector<TypeReference> implements,
                                                         std::vector<std::unique_ptr<Decl>> members,
                                                         SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<ClassDecl>();
   b.WithName(std::move(name)).WithImplements(std::move(implements)).WithMembers(std::move(members)).WithSpan(span);
   return b.Build();
@@ -45,6 +74,7 @@ std::unique_ptr<ClassDecl> BuilderAstFactory::MakeClass(std::string name,
 std::unique_ptr<InterfaceDecl> BuilderAstFactory::MakeInterface(std::string name,
                                                                 std::vector<std::unique_ptr<InterfaceMethod>> methods,
                                                                 SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<InterfaceDecl>();
   b.WithName(std::move(name)).WithMethods(std::move(methods)).WithSpan(span);
   return b.Build();
@@ -54,6 +84,7 @@ std::unique_ptr<InterfaceMethod> BuilderAstFactory::MakeInterfaceMethod(std::str
                                                                         std::vector<Param> params,
                                                                         std::unique_ptr<TypeReference> return_type,
                                                                         SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<InterfaceMethod>();
   b.WithName(std::move(name)).WithParams(std::move(params)).WithReturnType(std::move(return_type)).WithSpan(span);
   return b.Build();
@@ -62,6 +93,7 @@ std::unique_ptr<InterfaceMethod> BuilderAstFactory::MakeInterfaceMethod(std::str
 std::unique_ptr<TypeAliasDecl> BuilderAstFactory::MakeTypeAlias(std::string name,
                                                                 TypeReference aliased_type,
                                                                 SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<TypeAliasDecl>();
   b.WithName(std::move(name)).WithAliasedType(std::move(aliased_type)).WithSpan(span);
   return b.Build();
@@ -69,6 +101,7 @@ std::unique_ptr<TypeAliasDecl> BuilderAstFactory::MakeTypeAlias(std::string name
 
 std::unique_ptr<GlobalVarDecl> BuilderAstFactory::MakeGlobalVar(
     bool is_var, std::string name, TypeReference type, std::unique_ptr<Expr> init, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<GlobalVarDecl>();
   b.WithIsVar(is_var).WithName(std::move(name)).WithType(std::move(type)).WithInit(std::move(init)).WithSpan(span);
   return b.Build();
@@ -78,6 +111,7 @@ std::unique_ptr<GlobalVarDecl> BuilderAstFactory::MakeGlobalVar(
 
 std::unique_ptr<FieldDecl> BuilderAstFactory::MakeField(
     bool is_public, bool is_var, std::string name, TypeReference type, std::unique_ptr<Expr> init, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<FieldDecl>();
   b.WithIsPublic(is_public)
       .WithIsVar(is_var)
@@ -90,6 +124,7 @@ std::unique_ptr<FieldDecl> BuilderAstFactory::MakeField(
 
 std::unique_ptr<StaticFieldDecl> BuilderAstFactory::MakeStaticField(
     bool is_public, bool is_var, std::string name, TypeReference type, std::unique_ptr<Expr> init, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<StaticFieldDecl>();
   b.WithIsPublic(is_public)
       .WithIsVar(is_var)
@@ -109,6 +144,7 @@ std::unique_ptr<MethodDecl> BuilderAstFactory::MakeMethod(bool is_public,
                                                           std::unique_ptr<TypeReference> ret_type,
                                                           std::unique_ptr<Block> body,
                                                           SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<MethodDecl>();
   b.WithIsPublic(is_public)
       .WithIsOverride(is_override)
@@ -127,6 +163,7 @@ std::unique_ptr<CallDecl> BuilderAstFactory::MakeCallDecl(bool is_public,
                                                           std::unique_ptr<TypeReference> ret_type,
                                                           std::unique_ptr<Block> body,
                                                           SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<CallDecl>();
   b.WithIsPublic(is_public)
       .WithParams(std::move(params))
@@ -139,6 +176,7 @@ std::unique_ptr<CallDecl> BuilderAstFactory::MakeCallDecl(bool is_public,
 std::unique_ptr<DestructorDecl> BuilderAstFactory::MakeDestructor(bool is_public,
                                                                   std::unique_ptr<Block> body,
                                                                   SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<DestructorDecl>();
   b.WithIsPublic(is_public).WithBody(std::move(body)).WithSpan(span);
   return b.Build();
@@ -147,6 +185,7 @@ std::unique_ptr<DestructorDecl> BuilderAstFactory::MakeDestructor(bool is_public
 // Statements
 
 std::unique_ptr<Block> BuilderAstFactory::MakeBlock(std::vector<std::unique_ptr<Stmt>> stmts, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<Block>();
   b.WithStatements(std::move(stmts)).WithSpan(span);
   return b.Build();
@@ -154,18 +193,21 @@ std::unique_ptr<Block> BuilderAstFactory::MakeBlock(std::vector<std::unique_ptr<
 
 std::unique_ptr<VarDeclStmt> BuilderAstFactory::MakeVarDeclStmt(
     bool is_var, std::string name, TypeReference type, std::unique_ptr<Expr> init, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<VarDeclStmt>();
   b.WithIsVar(is_var).WithName(std::move(name)).WithType(std::move(type)).WithInit(std::move(init)).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<ExprStmt> BuilderAstFactory::MakeExprStmt(std::unique_ptr<Expr> expr, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<ExprStmt>();
   b.WithExpr(std::move(expr)).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<ReturnStmt> BuilderAstFactory::MakeReturnStmt(std::unique_ptr<Expr> value, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<ReturnStmt>();
   if (value != nullptr) {
     b.WithValue(std::move(value));
@@ -175,12 +217,14 @@ std::unique_ptr<ReturnStmt> BuilderAstFactory::MakeReturnStmt(std::unique_ptr<Ex
 }
 
 std::unique_ptr<BreakStmt> BuilderAstFactory::MakeBreakStmt(SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<BreakStmt>();
   b.WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<ContinueStmt> BuilderAstFactory::MakeContinueStmt(SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<ContinueStmt>();
   b.WithSpan(span);
   return b.Build();
@@ -189,6 +233,7 @@ std::unique_ptr<ContinueStmt> BuilderAstFactory::MakeContinueStmt(SourceSpan spa
 std::unique_ptr<IfStmt> BuilderAstFactory::MakeIfStmt(std::vector<Branch> branches,
                                                       std::unique_ptr<Block> else_block,
                                                       SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<IfStmt>();
   b.WithBranches(std::move(branches)).WithElse(std::move(else_block)).WithSpan(span);
   return b.Build();
@@ -197,6 +242,7 @@ std::unique_ptr<IfStmt> BuilderAstFactory::MakeIfStmt(std::vector<Branch> branch
 std::unique_ptr<WhileStmt> BuilderAstFactory::MakeWhileStmt(std::unique_ptr<Expr> cond,
                                                             std::unique_ptr<Block> body,
                                                             SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<WhileStmt>();
   b.WithCondition(std::move(cond)).WithBody(std::move(body)).WithSpan(span);
   return b.Build();
@@ -206,6 +252,7 @@ std::unique_ptr<ForStmt> BuilderAstFactory::MakeForStmt(std::string iter_name,
                                                         std::unique_ptr<Expr> iter_expr,
                                                         std::unique_ptr<Block> body,
                                                         SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<ForStmt>();
   b.WithIteratorName(std::move(iter_name))
       .WithIteratorExpr(std::move(iter_expr))
@@ -215,6 +262,7 @@ std::unique_ptr<ForStmt> BuilderAstFactory::MakeForStmt(std::string iter_name,
 }
 
 std::unique_ptr<UnsafeBlock> BuilderAstFactory::MakeUnsafeBlock(std::unique_ptr<Block> body, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<UnsafeBlock>();
   b.WithBody(std::move(body)).WithSpan(span);
   return b.Build();
@@ -226,6 +274,7 @@ std::unique_ptr<Binary> BuilderAstFactory::MakeBinary(const IBinaryOpTag& op,
                                                       std::unique_ptr<Expr> lhs,
                                                       std::unique_ptr<Expr> rhs,
                                                       SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<Binary>();
   b.WithOp(op).WithLhs(std::move(lhs)).WithRhs(std::move(rhs)).WithSpan(span);
   return b.Build();
@@ -234,6 +283,7 @@ std::unique_ptr<Binary> BuilderAstFactory::MakeBinary(const IBinaryOpTag& op,
 std::unique_ptr<Unary> BuilderAstFactory::MakeUnary(const IUnaryOpTag& op,
                                                     std::unique_ptr<Expr> operand,
                                                     SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<Unary>();
   b.WithOp(op).WithOperand(std::move(operand)).WithSpan(span);
   return b.Build();
@@ -243,6 +293,7 @@ std::unique_ptr<Assign> BuilderAstFactory::MakeAssign(const IAssignOpTag& op,
                                                       std::unique_ptr<Expr> target,
                                                       std::unique_ptr<Expr> value,
                                                       SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<Assign>();
   b.WithKind(op).WithTarget(std::move(target)).WithValue(std::move(value)).WithSpan(span);
   return b.Build();
@@ -251,6 +302,7 @@ std::unique_ptr<Assign> BuilderAstFactory::MakeAssign(const IAssignOpTag& op,
 std::unique_ptr<Call> BuilderAstFactory::MakeCall(std::unique_ptr<Expr> callee,
                                                   std::vector<std::unique_ptr<Expr>> args,
                                                   SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<Call>();
   b.WithCallee(std::move(callee)).WithArgs(std::move(args)).WithSpan(span);
   return b.Build();
@@ -259,6 +311,7 @@ std::unique_ptr<Call> BuilderAstFactory::MakeCall(std::unique_ptr<Expr> callee,
 std::unique_ptr<FieldAccess> BuilderAstFactory::MakeFieldAccess(std::unique_ptr<Expr> object,
                                                                 std::string name,
                                                                 SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<FieldAccess>();
   b.WithObject(std::move(object)).WithName(std::move(name)).WithSpan(span);
   return b.Build();
@@ -267,6 +320,7 @@ std::unique_ptr<FieldAccess> BuilderAstFactory::MakeFieldAccess(std::unique_ptr<
 std::unique_ptr<IndexAccess> BuilderAstFactory::MakeIndexAccess(std::unique_ptr<Expr> object,
                                                                 std::unique_ptr<Expr> index,
                                                                 SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<IndexAccess>();
   b.WithObject(std::move(object)).WithIndex(std::move(index)).WithSpan(span);
   return b.Build();
@@ -275,6 +329,7 @@ std::unique_ptr<IndexAccess> BuilderAstFactory::MakeIndexAccess(std::unique_ptr<
 std::unique_ptr<NamespaceRef> BuilderAstFactory::MakeNamespaceRef(std::unique_ptr<Expr> ns,
                                                                   std::string name,
                                                                   SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<NamespaceRef>();
   b.WithNamespace(std::move(ns)).WithName(std::move(name)).WithSpan(span);
   return b.Build();
@@ -285,6 +340,7 @@ std::unique_ptr<SafeCall> BuilderAstFactory::MakeSafeCall(std::unique_ptr<Expr>
                                                           std::vector<std::unique_ptr<Expr>> args,
                                                           std::optional<TypeReference> inferred_type,
                                                           SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<SafeCall>();
   b.WithObject(std::move(object))
       .WithMethod(std::move(method))
@@ -297,12 +353,14 @@ std::unique_ptr<SafeCall> BuilderAstFactory::MakeSafeCall(std::unique_ptr<Expr>
 std::unique_ptr<Elvis> BuilderAstFactory::MakeElvis(std::unique_ptr<Expr> lhs,
                                                     std::unique_ptr<Expr> rhs,
                                                     SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<Elvis>();
   b.WithLhs(std::move(lhs)).WithRhs(std::move(rhs)).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<CastAs> BuilderAstFactory::MakeCastAs(std::unique_ptr<Expr> expr, TypeReference type, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<CastAs>();
   b.WithExpr(std::move(expr)).WithType(std::move(type)).WithSpan(span);
   return b.Build();
@@ -311,60 +369,70 @@ std::unique_ptr<CastAs> BuilderAstFactory::MakeCastAs(std::unique_ptr<Expr> expr
 std::unique_ptr<TypeTestIs> BuilderAstFactory::MakeTypeTestIs(std::unique_ptr<Expr> expr,
                                                               TypeReference type,
                                                               SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<TypeTestIs>();
   b.WithExpr(std::move(expr)).WithType(std::move(type)).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<IdentRef> BuilderAstFactory::MakeIdent(std::string name, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<IdentRef>();
   b.WithName(std::move(name)).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<IntLit> BuilderAstFactory::MakeInt(long long v, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<IntLit>();
   b.WithValue(v).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<FloatLit> BuilderAstFactory::MakeFloat(long double v, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<FloatLit>();
   b.WithValue(v).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<StringLit> BuilderAstFactory::MakeString(std::string v, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<StringLit>();
   b.WithValue(std::move(v)).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<CharLit> BuilderAstFactory::MakeChar(char v, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<CharLit>();
   b.WithValue(v).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<BoolLit> BuilderAstFactory::MakeBool(bool v, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<BoolLit>();
   b.WithValue(v).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<ByteLit> BuilderAstFactory::MakeByte(uint8_t v, SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<ByteLit>();
   b.WithValue(v).WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<NullLit> BuilderAstFactory::MakeNull(SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<NullLit>();
   b.WithSpan(span);
   return b.Build();
 }
 
 std::unique_ptr<ThisExpr> BuilderAstFactory::MakeThisExpr(SourceSpan span) {
+  AstArena::Scope scope(arena_.get());
   auto b = ParserBuilder::Make<ThisExpr>();
   b.WithSpan(span);
   return b.Build();
@@ -1,19 +1,35 @@
 #ifndef PARSER_BUILDERASTFACTORY_HPP_
 #define PARSER_BUILDERASTFACTORY_HPP_
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "AstArena.hpp"
 #include "IAstFactory.hpp"
 
 namespace ovum::compiler::parser {
 
+// Where the nodes of a parsed module live. kArena is the default; kHeap allocates every node on its own, which
+// keeps each node visible to leak and address checkers.
+enum class AstAllocation : uint8_t { kArena, kHeap };
+
+// In kArena mode every MakeModule starts a new AstArena that the module keeps alive, and the nodes made after it
+// are allocated there until the next MakeModule.
 class BuilderAstFactory : public IAstFactory { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
+  explicit BuilderAstFactory(AstAllocation allocation = AstAllocation::kArena);
+
   ~BuilderAstFactory() override = default;
 
+  // Arena of the module made last, or of the last StartArena; nullptr in kHeap mode or before either.
+  [[nodiscard]] AstArena* Arena() const noexcept;
+
+  // Same arena MakeModule starts; the factory keeps it alive until the next one starts. nullptr in kHeap mode.
+  std::shared_ptr<AstArena> StartArena() override;
+
   // Module / Decls
   std::unique_ptr<Module> MakeModule(std::string name,
                                      SourceId source_id,
@@ -155,6 +171,10 @@ public:
   std::unique_ptr<ByteLit> MakeByte(uint8_t v, SourceSpan span) override;
   std::unique_ptr<NullLit> MakeNull(SourceSpan span) override;
   std::unique_ptr<ThisExpr> MakeThisExpr(SourceSpan span) override;
+
+private:
+  AstAllocation allocation_;
+  std::shared_ptr<AstArena> arena_;
 };
 
 } // namespace ovum::compiler::parser
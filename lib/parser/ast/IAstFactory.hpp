@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 
+#include "AstArena.hpp"
 #include "nodes/class_members/CallDecl.hpp"
 #include "nodes/class_members/DestructorDecl.hpp"
 #include "nodes/class_members/FieldDecl.hpp"
@@ -61,6 +62,12 @@ class IAstFactory { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
   virtual ~IAstFactory() = default;
 
+  // Starts a new arena for the nodes made after this call, for callers that build nodes outside a module (such as
+  // deferred function bodies). Factories that do not allocate from arenas return nullptr.
+  virtual std::shared_ptr<AstArena> StartArena() {
+    return nullptr;
+  }
+
   // Module / Decls
   virtual std::unique_ptr<Module> MakeModule(std::string name,
                                              SourceId source_id,
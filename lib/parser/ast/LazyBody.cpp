@@ -0,0 +1,48 @@
+#include "LazyBody.hpp"
+
+#include <utility>
+
+namespace ovum::compiler::parser {
+
+const Block* LazyBody::Get() const {
+  Materialize();
+  return block_.get();
+}
+
+Block* LazyBody::GetMutable() {
+  Materialize();
+  return block_.get();
+}
+
+void LazyBody::Set(std::unique_ptr<Block> block) {
+  deferred_ = false;
+  block_ = std::move(block);
+}
+
+std::unique_ptr<Block> LazyBody::Release() {
+  Materialize();
+  return std::move(block_);
+}
+
+void LazyBody::Defer(std::shared_ptr<IDeferredBodySource> source, std::size_t begin, std::size_t end) {
+  block_.reset();
+  source_ = std::move(source);
+  begin_ = begin;
+  end_ = end;
+  deferred_ = true;
+}
+
+bool LazyBody::IsDeferred() const noexcept {
+  return deferred_;
+}
+
+void LazyBody::Materialize() const {
+  if (!deferred_) {
+    return;
+  }
+
+  block_ = source_->ParseBody(begin_, end_);
+  deferred_ = false;
+}
+
+} // namespace ovum::compiler::parser
@@ -0,0 +1,56 @@
+#ifndef PARSER_LAZYBODY_HPP_
+#define PARSER_LAZYBODY_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+#include "lib/parser/ast/nodes/stmts/Block.hpp"
+
+namespace ovum::compiler::parser {
+
+// Where a parser that skipped function bodies can find them again. Positions are token indices of the stream the
+// declarations were parsed from.
+class IDeferredBodySource { // NOLINT(cppcoreguidelines-special-member-functions)
+public:
+  virtual ~IDeferredBodySource() = default;
+
+  // One past the '}' matching the '{' at open; nullopt when the braces do not balance before the end of file.
+  [[nodiscard]] virtual std::optional<std::size_t> FindBodyEnd(std::size_t open) const = 0;
+
+  // Parses the body spanning [begin, end), braces included.
+  virtual std::unique_ptr<Block> ParseBody(std::size_t begin, std::size_t end) = 0;
+};
+
+// The body of a function, method or call: either a parsed block or a token range that is parsed the first time the
+// block is asked for. Materialising mutates a const node, so a module with deferred bodies must not be read from
+// several threads at once.
+class LazyBody {
+public:
+  LazyBody() = default;
+  LazyBody(const LazyBody&) = delete;
+  LazyBody& operator=(const LazyBody&) = delete;
+
+  [[nodiscard]] const Block* Get() const;
+  Block* GetMutable();
+  void Set(std::unique_ptr<Block> block);
+  std::unique_ptr<Block> Release();
+
+  // Drops any block; [begin, end) of source is parsed on first access.
+  void Defer(std::shared_ptr<IDeferredBodySource> source, std::size_t begin, std::size_t end);
+  [[nodiscard]] bool IsDeferred() const noexcept;
+
+private:
+  void Materialize() const;
+
+  // Declared first so it outlives the block: the source may own the memory the block was parsed into.
+  std::shared_ptr<IDeferredBodySource> source_;
+  std::size_t begin_ = 0;
+  std::size_t end_ = 0;
+  mutable bool deferred_ = false;
+  mutable std::unique_ptr<Block> block_;
+};
+
+} // namespace ovum::compiler::parser
+
+#endif // PARSER_LAZYBODY_HPP_
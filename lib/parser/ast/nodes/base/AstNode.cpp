@@ -1,8 +1,41 @@
 #include <algorithm>
+#include <cstddef>
+#include <new>
 
 #include "AstNode.hpp"
+#include "lib/parser/ast/AstArena.hpp"
 
 namespace ovum::compiler::parser {
+
+namespace {
+
+// Every node is preceded by the arena it came from, or nullptr when it came from the heap.
+constexpr std::size_t kOwnerHeaderSize = alignof(std::max_align_t);
+
+static_assert(kOwnerHeaderSize >= sizeof(AstArena*));
+
+} // namespace
+
+void* AstNode::operator new(std::size_t size) {
+  AstArena* arena = AstArena::Current();
+  void* block = arena != nullptr ? arena->Allocate(kOwnerHeaderSize + size, alignof(std::max_align_t))
+                                 : ::operator new(kOwnerHeaderSize + size);
+  *static_cast<AstArena**>(block) = arena;
+
+  return static_cast<std::byte*>(block) + kOwnerHeaderSize;
+}
+
+void AstNode::operator delete(void* pointer) noexcept {
+  if (pointer == nullptr) {
+    return;
+  }
+
+  void* block = static_cast<std::byte*>(pointer) - kOwnerHeaderSize;
+
+  if (*static_cast<AstArena**>(block) == nullptr) {
+    ::operator delete(block);
+  }
+}
 const SourceSpan& AstNode::Span() const noexcept {
   return span_;
 }
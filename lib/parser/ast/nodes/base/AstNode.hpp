@@ -1,6 +1,9 @@
 #ifndef PARSER_ASTNODE_HPP_
 #define PARSER_ASTNODE_HPP_
 
+#include <cstddef>
+
+#include "NodeKind.hpp"
 #include "lib/parser/tokens/SourceSpan.hpp"
 
 namespace ovum::compiler::parser {
@@ -11,6 +14,16 @@ class AstNode { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
   virtual ~AstNode() = default;
 
+  // Nodes created while an AstArena::Scope is open take their memory from that arena, and deleting them gives
+  // nothing back; the arena releases it in bulk. Elsewhere nodes live on the heap as usual.
+  static void* operator new(std::size_t size);
+  static void operator delete(void* pointer) noexcept;
+
+  // Set once by the concrete node; see NodeCasting.hpp for the checked casts built on it.
+  [[nodiscard]] NodeKind Kind() const noexcept {
+    return kind_;
+  }
+
   [[nodiscard]] const SourceSpan& Span() const noexcept;
   void SetSpan(SourceSpan span);
   void SetSpanParts(SourceId id, TokenPosition begin, TokenPosition end);
@@ -18,8 +31,13 @@ public:
 
   virtual void Accept(AstVisitor& visitor) = 0;
 
+protected:
+  explicit AstNode(NodeKind kind) noexcept : kind_(kind) {
+  }
+
 private:
   SourceSpan span_{};
+  NodeKind kind_;
 };
 
 } // namespace ovum::compiler::parser
@@ -5,7 +5,16 @@
 
 namespace ovum::compiler::parser {
 
-class Decl : public AstNode {};
+class Decl : public AstNode {
+public:
+  [[nodiscard]] static constexpr bool ClassOf(NodeKind kind) noexcept {
+    return kind >= NodeKind::kFirstDecl && kind <= NodeKind::kLastDecl;
+  }
+
+protected:
+  explicit Decl(NodeKind kind) noexcept : AstNode(kind) {
+  }
+};
 
 } // namespace ovum::compiler::parser
 
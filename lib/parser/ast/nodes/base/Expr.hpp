@@ -5,7 +5,16 @@
 
 namespace ovum::compiler::parser {
 
-class Expr : public AstNode {};
+class Expr : public AstNode {
+public:
+  [[nodiscard]] static constexpr bool ClassOf(NodeKind kind) noexcept {
+    return kind >= NodeKind::kFirstExpr && kind <= NodeKind::kLastExpr;
+  }
+
+protected:
+  explicit Expr(NodeKind kind) noexcept : AstNode(kind) {
+  }
+};
 
 } // namespace ovum::compiler::parser
 
@@ -0,0 +1,68 @@
+#ifndef PARSER_NODECASTING_HPP_
+#define PARSER_NODECASTING_HPP_
+
+#include <cassert>
+#include <type_traits>
+
+#include "AstNode.hpp"
+#include "NodeKind.hpp"
+
+namespace ovum::compiler::parser {
+
+// Kind-tag checked casts in the style of LLVM's isa/cast/dyn_cast. A concrete node type T answers by comparing the
+// node's kind with T::kKind, and an abstract base by T::ClassOf(kind); neither touches RTTI. The result keeps the
+// constness of the argument.
+
+template<typename T>
+[[nodiscard]] constexpr bool IsKindOf(NodeKind kind) noexcept {
+  if constexpr (std::is_same_v<T, AstNode>) {
+    return true;
+  } else if constexpr (requires { T::kKind; }) {
+    return kind == T::kKind;
+  } else {
+    return T::ClassOf(kind);
+  }
+}
+
+template<typename T>
+[[nodiscard]] bool Isa(const AstNode& node) noexcept {
+  return IsKindOf<T>(node.Kind());
+}
+
+template<typename T>
+[[nodiscard]] bool Isa(const AstNode* node) noexcept {
+  return node != nullptr && IsKindOf<T>(node->Kind());
+}
+
+// The node must be a T.
+template<typename T, typename From>
+[[nodiscard]] auto& Cast(From& node) noexcept {
+  assert(Isa<T>(node));
+
+  if constexpr (std::is_const_v<From>) {
+    return static_cast<const T&>(node);
+  } else {
+    return static_cast<T&>(node);
+  }
+}
+
+template<typename T, typename From>
+[[nodiscard]] auto* Cast(From* node) noexcept {
+  assert(node == nullptr || Isa<T>(*node));
+
+  if constexpr (std::is_const_v<From>) {
+    return static_cast<const T*>(node);
+  } else {
+    return static_cast<T*>(node);
+  }
+}
+
+// nullptr when node is null or not a T.
+template<typename T, typename From>
+[[nodiscard]] auto* DynCast(From* node) noexcept {
+  return Isa<T>(node) ? Cast<T>(node) : nullptr;
+}
+
+} // namespace ovum::compiler::parser
+
+#endif // PARSER_NODECASTING_HPP_
@@ -0,0 +1,67 @@
+#ifndef PARSER_NODEKIND_HPP_
+#define PARSER_NODEKIND_HPP_
+
+#include <cstdint>
+
+namespace ovum::compiler::parser {
+
+// Concrete node types. Declarations, statements and expressions each occupy one contiguous range, so membership in
+// Decl, Stmt or Expr is a range check.
+enum class NodeKind : uint8_t {
+  kModule,
+
+  kFunctionDecl,
+  kClassDecl,
+  kInterfaceDecl,
+  kInterfaceMethod,
+  kTypeAliasDecl,
+  kGlobalVarDecl,
+  kFieldDecl,
+  kStaticFieldDecl,
+  kMethodDecl,
+  kCallDecl,
+  kDestructorDecl,
+
+  kBlock,
+  kUnsafeBlock,
+  kVarDeclStmt,
+  kExprStmt,
+  kReturnStmt,
+  kBreakStmt,
+  kContinueStmt,
+  kIfStmt,
+  kWhileStmt,
+  kForStmt,
+
+  kBinary,
+  kUnary,
+  kAssign,
+  kCall,
+  kSafeCall,
+  kFieldAccess,
+  kIndexAccess,
+  kNamespaceRef,
+  kElvis,
+  kCastAs,
+  kTypeTestIs,
+  kIdentRef,
+  kThisExpr,
+  kIntLit,
+  kFloatLit,
+  kByteLit,
+  kCharLit,
+  kBoolLit,
+  kStringLit,
+  kNullLit,
+
+  kFirstDecl = kFunctionDecl,
+  kLastDecl = kDestructorDecl,
+  kFirstStmt = kBlock,
+  kLastStmt = kForStmt,
+  kFirstExpr = kBinary,
+  kLastExpr = kNullLit,
+};
+
+} // namespace ovum::compiler::parser
+
+#endif // PARSER_NODEKIND_HPP_
@@ -5,7 +5,16 @@
 
 namespace ovum::compiler::parser {
 
-class Stmt : public AstNode {};
+class Stmt : public AstNode {
+public:
+  [[nodiscard]] static constexpr bool ClassOf(NodeKind kind) noexcept {
+    return kind >= NodeKind::kFirstStmt && kind <= NodeKind::kLastStmt;
+  }
+
+protected:
+  explicit Stmt(NodeKind kind) noexcept : AstNode(kind) {
+  }
+};
 
 } // namespace ovum::compiler::parser
 
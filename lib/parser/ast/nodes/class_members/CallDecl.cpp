@@ -46,20 +46,28 @@ std::unique_ptr<TypeReference> CallDecl::ReleaseReturnType() {
   return std::move(ret_type_);
 }
 
-const Block* CallDecl::Body() const noexcept {
-  return body_.get();
+const Block* CallDecl::Body() const {
+  return body_.Get();
 }
 
-Block* CallDecl::MutableBody() noexcept {
-  return body_.get();
+Block* CallDecl::MutableBody() {
+  return body_.GetMutable();
 }
 
 void CallDecl::SetBody(std::unique_ptr<Block> block) {
-  body_ = std::move(block);
+  body_.Set(std::move(block));
 }
 
 std::unique_ptr<Block> CallDecl::ReleaseBody() {
-  return std::move(body_);
+  return body_.Release();
+}
+
+void CallDecl::DeferBody(std::shared_ptr<IDeferredBodySource> source, std::size_t begin, std::size_t end) {
+  body_.Defer(std::move(source), begin, end);
+}
+
+bool CallDecl::HasDeferredBody() const noexcept {
+  return body_.IsDeferred();
 }
 
 } // namespace ovum::compiler::parser
@@ -1,9 +1,11 @@
 #ifndef PARSER_CALLDECL_HPP_
 #define PARSER_CALLDECL_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
+#include "lib/parser/ast/LazyBody.hpp"
 #include "lib/parser/ast/nodes/base/Decl.hpp"
 #include "lib/parser/ast/nodes/stmts/Block.hpp"
 #include "lib/parser/types/Param.hpp"
@@ -13,6 +15,11 @@ namespace ovum::compiler::parser {
 
 class CallDecl : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kCallDecl;
+
+  CallDecl() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] bool IsPublic() const noexcept;
@@ -27,16 +34,19 @@ public:
   void SetReturnType(std::unique_ptr<TypeReference> type);
   std::unique_ptr<TypeReference> ReleaseReturnType();
 
-  [[nodiscard]] const Block* Body() const noexcept;
-  Block* MutableBody() noexcept;
+  // A deferred body is parsed here, on first access.
+  [[nodiscard]] const Block* Body() const;
+  Block* MutableBody();
   void SetBody(std::unique_ptr<Block> block);
   std::unique_ptr<Block> ReleaseBody();
+  void DeferBody(std::shared_ptr<IDeferredBodySource> source, std::size_t begin, std::size_t end);
+  [[nodiscard]] bool HasDeferredBody() const noexcept;
 
 private:
   bool is_public_ = true;
   std::vector<Param> params_;
   std::unique_ptr<TypeReference> ret_type_;
-  std::unique_ptr<Block> body_;
+  LazyBody body_;
 };
 
 } // namespace ovum::compiler::parser
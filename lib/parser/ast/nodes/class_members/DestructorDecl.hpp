@@ -10,6 +10,11 @@ namespace ovum::compiler::parser {
 
 class DestructorDecl : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kDestructorDecl;
+
+  DestructorDecl() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] bool IsPublic() const noexcept;
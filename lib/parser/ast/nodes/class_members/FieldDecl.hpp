@@ -12,6 +12,11 @@ namespace ovum::compiler::parser {
 
 class FieldDecl : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kFieldDecl;
+
+  FieldDecl() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] bool IsPublic() const noexcept;
@@ -78,20 +78,28 @@ std::unique_ptr<TypeReference> MethodDecl::ReleaseReturnType() {
   return std::move(ret_type_);
 }
 
-const Block* MethodDecl::Body() const noexcept {
-  return body_.get();
+const Block* MethodDecl::Body() const {
+  return body_.Get();
 }
 
-Block* MethodDecl::MutableBody() noexcept {
-  return body_.get();
+Block* MethodDecl::MutableBody() {
+  return body_.GetMutable();
 }
 
 void MethodDecl::SetBody(std::unique_ptr<Block> block) {
-  body_ = std::move(block);
+  body_.Set(std::move(block));
 }
 
 std::unique_ptr<Block> MethodDecl::ReleaseBody() {
-  return std::move(body_);
+  return body_.Release();
+}
+
+void MethodDecl::DeferBody(std::shared_ptr<IDeferredBodySource> source, std::size_t begin, std::size_t end) {
+  body_.Defer(std::move(source), begin, end);
+}
+
+bool MethodDecl::HasDeferredBody() const noexcept {
+  return body_.IsDeferred();
 }
 
 } // namespace ovum::compiler::parser
@@ -1,10 +1,12 @@
 #ifndef PARSER_METHODDECL_HPP_
 #define PARSER_METHODDECL_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "lib/parser/ast/LazyBody.hpp"
 #include "lib/parser/ast/nodes/base/Decl.hpp"
 #include "lib/parser/ast/nodes/stmts/Block.hpp"
 #include "lib/parser/types/Param.hpp"
@@ -14,6 +16,11 @@ namespace ovum::compiler::parser {
 
 class MethodDecl : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kMethodDecl;
+
+  MethodDecl() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] bool IsPublic() const noexcept;
@@ -40,10 +47,13 @@ public:
   void SetReturnType(std::unique_ptr<TypeReference> type);
   std::unique_ptr<TypeReference> ReleaseReturnType();
 
-  [[nodiscard]] const Block* Body() const noexcept;
-  Block* MutableBody() noexcept;
+  // A deferred body is parsed here, on first access.
+  [[nodiscard]] const Block* Body() const;
+  Block* MutableBody();
   void SetBody(std::unique_ptr<Block> block);
   std::unique_ptr<Block> ReleaseBody();
+  void DeferBody(std::shared_ptr<IDeferredBodySource> source, std::size_t begin, std::size_t end);
+  [[nodiscard]] bool HasDeferredBody() const noexcept;
 
 private:
   bool is_public_ = true;
@@ -54,7 +64,7 @@ private:
   std::string name_;
   std::vector<Param> params_;
   std::unique_ptr<TypeReference> ret_type_;
-  std::unique_ptr<Block> body_; // optional
+  LazyBody body_;               // optional
 };
 
 } // namespace ovum::compiler::parser
@@ -12,6 +12,11 @@ namespace ovum::compiler::parser {
 
 class StaticFieldDecl : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kStaticFieldDecl;
+
+  StaticFieldDecl() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] bool IsPublic() const noexcept;
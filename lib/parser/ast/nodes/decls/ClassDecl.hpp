@@ -12,6 +12,11 @@ namespace ovum::compiler::parser {
 
 class ClassDecl : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kClassDecl;
+
+  ClassDecl() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const std::string& Name() const noexcept;
@@ -51,20 +51,28 @@ std::unique_ptr<TypeReference> FunctionDecl::ReleaseReturnType() {
   return std::move(return_type_);
 }
 
-const Block* FunctionDecl::Body() const noexcept {
-  return body_.get();
+const Block* FunctionDecl::Body() const {
+  return body_.Get();
 }
 
-Block* FunctionDecl::MutableBody() noexcept {
-  return body_.get();
+Block* FunctionDecl::MutableBody() {
+  return body_.GetMutable();
 }
 
 void FunctionDecl::SetBody(std::unique_ptr<Block> block) {
-  body_ = std::move(block);
+  body_.Set(std::move(block));
 }
 
 std::unique_ptr<Block> FunctionDecl::ReleaseBody() {
-  return std::move(body_);
+  return body_.Release();
+}
+
+void FunctionDecl::DeferBody(std::shared_ptr<IDeferredBodySource> source, std::size_t begin, std::size_t end) {
+  body_.Defer(std::move(source), begin, end);
+}
+
+bool FunctionDecl::HasDeferredBody() const noexcept {
+  return body_.IsDeferred();
 }
 
 } // namespace ovum::compiler::parser
@@ -1,10 +1,12 @@
 #ifndef PARSER_FUNCTIONDECL_HPP_
 #define PARSER_FUNCTIONDECL_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "lib/parser/ast/LazyBody.hpp"
 #include "lib/parser/ast/nodes/base/Decl.hpp"
 #include "lib/parser/ast/nodes/stmts/Block.hpp"
 #include "lib/parser/types/Param.hpp"
@@ -15,6 +17,11 @@ class TypeReference;
 
 class FunctionDecl : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kFunctionDecl;
+
+  FunctionDecl() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] bool IsPure() const noexcept;
@@ -32,17 +39,20 @@ public:
   void SetReturnType(std::unique_ptr<TypeReference> type);
   std::unique_ptr<TypeReference> ReleaseReturnType();
 
-  [[nodiscard]] const Block* Body() const noexcept;
-  Block* MutableBody() noexcept;
+  // A deferred body is parsed here, on first access.
+  [[nodiscard]] const Block* Body() const;
+  Block* MutableBody();
   void SetBody(std::unique_ptr<Block> block);
   std::unique_ptr<Block> ReleaseBody();
+  void DeferBody(std::shared_ptr<IDeferredBodySource> source, std::size_t begin, std::size_t end);
+  [[nodiscard]] bool HasDeferredBody() const noexcept;
 
 private:
   bool is_pure_ = false;
   std::string name_;
   std::vector<Param> params_;
   std::unique_ptr<TypeReference> return_type_; // optional
-  std::unique_ptr<Block> body_;                // optional
+  LazyBody body_;                              // optional
 };
 
 } // namespace ovum::compiler::parser
@@ -12,6 +12,11 @@ namespace ovum::compiler::parser {
 
 class GlobalVarDecl : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kGlobalVarDecl;
+
+  GlobalVarDecl() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] bool IsVar() const noexcept;
@@ -12,6 +12,11 @@ namespace ovum::compiler::parser {
 
 class InterfaceDecl : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kInterfaceDecl;
+
+  InterfaceDecl() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const std::string& Name() const noexcept;
@@ -13,6 +13,11 @@ namespace ovum::compiler::parser {
 
 class InterfaceMethod : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kInterfaceMethod;
+
+  InterfaceMethod() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const std::string& Name() const noexcept;
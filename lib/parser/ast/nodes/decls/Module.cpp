@@ -1,5 +1,8 @@
 #include "Module.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 #include "lib/parser/ast/AstVisitor.hpp"
 
 namespace ovum::compiler::parser {
@@ -46,4 +49,15 @@ std::unique_ptr<Decl> Module::ReleaseDecl(std::size_t index) {
   return std::move(old);
 }
 
+void Module::RetainArena(std::shared_ptr<AstArena> arena) {
+  arenas_.push_back(std::move(arena));
+}
+
+void Module::TakeDecls(Module& other) {
+  arenas_.insert(arenas_.end(), other.arenas_.begin(), other.arenas_.end());
+  decls_.reserve(decls_.size() + other.decls_.size());
+  std::ranges::move(other.decls_, std::back_inserter(decls_));
+  other.decls_.clear();
+}
+
 } // namespace ovum::compiler::parser
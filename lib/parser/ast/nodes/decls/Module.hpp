@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 
+#include "lib/parser/ast/AstArena.hpp"
 #include "lib/parser/ast/nodes/base/AstNode.hpp"
 #include "lib/parser/ast/nodes/base/Decl.hpp"
 #include "lib/parser/tokens/SourceId.hpp"
@@ -13,6 +14,11 @@ namespace ovum::compiler::parser {
 
 class Module : public AstNode {
 public:
+  static constexpr NodeKind kKind = NodeKind::kModule;
+
+  Module() : AstNode(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const std::string& Name() const noexcept;
@@ -26,7 +32,14 @@ public:
   void AddDecl(std::unique_ptr<Decl> decl);
   std::unique_ptr<Decl> ReleaseDecl(std::size_t index);
 
+  // Keeps an arena the module's nodes were allocated from alive for as long as the module.
+  void RetainArena(std::shared_ptr<AstArena> arena);
+
+  // Moves other's declarations after this module's, together with a share of the arenas they live in.
+  void TakeDecls(Module& other);
+
 private:
+  std::vector<std::shared_ptr<AstArena>> arenas_; // first, so they are released after every node
   std::string name_;
   SourceId source_;
   std::vector<std::unique_ptr<Decl>> decls_;
@@ -10,6 +10,11 @@ namespace ovum::compiler::parser {
 
 class TypeAliasDecl : public Decl {
 public:
+  static constexpr NodeKind kKind = NodeKind::kTypeAliasDecl;
+
+  TypeAliasDecl() : Decl(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const std::string& Name() const noexcept;
@@ -11,6 +11,11 @@ namespace ovum::compiler::parser {
 
 class Assign : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kAssign;
+
+  Assign() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const IAssignOpTag& Kind() const noexcept;
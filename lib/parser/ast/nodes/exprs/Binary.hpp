@@ -11,6 +11,11 @@ namespace ovum::compiler::parser {
 
 class Binary : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kBinary;
+
+  Binary() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const IBinaryOpTag& Op() const noexcept;
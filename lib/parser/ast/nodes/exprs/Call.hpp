@@ -10,6 +10,11 @@ namespace ovum::compiler::parser {
 
 class Call : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kCall;
+
+  Call() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const Expr& Callee() const noexcept;
@@ -10,6 +10,11 @@ namespace ovum::compiler::parser {
 
 class CastAs : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kCastAs;
+
+  CastAs() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const Expr& Expression() const noexcept;
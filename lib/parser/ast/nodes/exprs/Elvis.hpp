@@ -9,6 +9,11 @@ namespace ovum::compiler::parser {
 
 class Elvis : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kElvis;
+
+  Elvis() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const Expr& Lhs() const noexcept;
@@ -10,6 +10,11 @@ namespace ovum::compiler::parser {
 
 class FieldAccess : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kFieldAccess;
+
+  FieldAccess() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const Expr& Object() const noexcept;
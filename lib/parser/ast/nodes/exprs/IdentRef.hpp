@@ -9,6 +9,11 @@ namespace ovum::compiler::parser {
 
 class IdentRef : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kIdentRef;
+
+  IdentRef() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const std::string& Name() const noexcept;
@@ -9,6 +9,11 @@ namespace ovum::compiler::parser {
 
 class IndexAccess : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kIndexAccess;
+
+  IndexAccess() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const Expr& Object() const noexcept;
@@ -10,6 +10,11 @@ namespace ovum::compiler::parser {
 
 class NamespaceRef : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kNamespaceRef;
+
+  NamespaceRef() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const Expr& NamespaceExpr() const noexcept;
@@ -15,6 +15,11 @@ class AstVisitor;
 
 class SafeCall : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kSafeCall;
+
+  SafeCall() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& v) override;
 
   [[nodiscard]] const Expr& Object() const noexcept;
@@ -7,6 +7,11 @@ namespace ovum::compiler::parser {
 
 class ThisExpr : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kThisExpr;
+
+  ThisExpr() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 };
 
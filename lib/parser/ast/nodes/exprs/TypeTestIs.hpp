@@ -10,6 +10,11 @@ namespace ovum::compiler::parser {
 
 class TypeTestIs : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kTypeTestIs;
+
+  TypeTestIs() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const Expr& Expression() const noexcept;
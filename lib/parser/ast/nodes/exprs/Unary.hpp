@@ -11,6 +11,11 @@ namespace ovum::compiler::parser {
 
 class Unary : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kUnary;
+
+  Unary() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const IUnaryOpTag& Op() const noexcept;
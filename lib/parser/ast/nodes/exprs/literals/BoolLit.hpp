@@ -7,6 +7,11 @@ namespace ovum::compiler::parser {
 
 class BoolLit : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kBoolLit;
+
+  BoolLit() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] bool Value() const noexcept;
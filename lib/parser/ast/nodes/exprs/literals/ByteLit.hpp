@@ -8,6 +8,11 @@ namespace ovum::compiler::parser {
 
 class ByteLit : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kByteLit;
+
+  ByteLit() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] uint8_t Value() const noexcept;
@@ -7,6 +7,11 @@ namespace ovum::compiler::parser {
 
 class CharLit : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kCharLit;
+
+  CharLit() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] char Value() const noexcept;
@@ -7,6 +7,11 @@ namespace ovum::compiler::parser {
 
 class FloatLit : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kFloatLit;
+
+  FloatLit() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] double Value() const noexcept;
@@ -8,6 +8,11 @@ namespace ovum::compiler::parser {
 
 class IntLit : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kIntLit;
+
+  IntLit() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] int64_t Value() const noexcept;
@@ -7,6 +7,11 @@ namespace ovum::compiler::parser {
 
 class NullLit : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kNullLit;
+
+  NullLit() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 };
 
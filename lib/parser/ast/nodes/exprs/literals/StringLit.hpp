@@ -9,6 +9,11 @@ namespace ovum::compiler::parser {
 
 class StringLit : public Expr {
 public:
+  static constexpr NodeKind kKind = NodeKind::kStringLit;
+
+  StringLit() : Expr(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const std::string& Value() const noexcept;
@@ -11,6 +11,11 @@ namespace ovum::compiler::parser {
 
 class Block : public Stmt {
 public:
+  static constexpr NodeKind kKind = NodeKind::kBlock;
+
+  Block() : Stmt(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   std::vector<std::unique_ptr<Stmt>>& GetStatements();
@@ -7,6 +7,11 @@ namespace ovum::compiler::parser {
 
 class BreakStmt : public Stmt {
 public:
+  static constexpr NodeKind kKind = NodeKind::kBreakStmt;
+
+  BreakStmt() : Stmt(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 };
 
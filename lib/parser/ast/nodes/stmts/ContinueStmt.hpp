@@ -7,6 +7,11 @@ namespace ovum::compiler::parser {
 
 class ContinueStmt : public Stmt {
 public:
+  static constexpr NodeKind kKind = NodeKind::kContinueStmt;
+
+  ContinueStmt() : Stmt(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 };
 
@@ -10,6 +10,11 @@ namespace ovum::compiler::parser {
 
 class ExprStmt : public Stmt {
 public:
+  static constexpr NodeKind kKind = NodeKind::kExprStmt;
+
+  ExprStmt() : Stmt(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const Expr* Expression() const noexcept;
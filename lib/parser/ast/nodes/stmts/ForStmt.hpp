@@ -11,6 +11,11 @@ namespace ovum::compiler::parser {
 
 class ForStmt : public Stmt {
 public:
+  static constexpr NodeKind kKind = NodeKind::kForStmt;
+
+  ForStmt() : Stmt(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const std::string& IteratorName() const noexcept;
@@ -13,6 +13,11 @@ namespace ovum::compiler::parser {
 
 class IfStmt : public Stmt {
 public:
+  static constexpr NodeKind kKind = NodeKind::kIfStmt;
+
+  IfStmt() : Stmt(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const std::vector<Branch>& Branches() const noexcept;
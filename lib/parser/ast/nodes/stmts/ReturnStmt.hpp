@@ -11,6 +11,11 @@ namespace ovum::compiler::parser {
 
 class ReturnStmt : public Stmt {
 public:
+  static constexpr NodeKind kKind = NodeKind::kReturnStmt;
+
+  ReturnStmt() : Stmt(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] bool HasValue() const noexcept;
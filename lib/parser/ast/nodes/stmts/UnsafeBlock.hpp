@@ -10,6 +10,11 @@ namespace ovum::compiler::parser {
 
 class UnsafeBlock : public Stmt {
 public:
+  static constexpr NodeKind kKind = NodeKind::kUnsafeBlock;
+
+  UnsafeBlock() : Stmt(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const Block* Body() const noexcept;
@@ -12,6 +12,11 @@ namespace ovum::compiler::parser {
 
 class VarDeclStmt : public Stmt {
 public:
+  static constexpr NodeKind kKind = NodeKind::kVarDeclStmt;
+
+  VarDeclStmt() : Stmt(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] bool IsVar() const noexcept;
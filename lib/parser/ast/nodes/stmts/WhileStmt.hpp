@@ -11,6 +11,11 @@ namespace ovum::compiler::parser {
 
 class WhileStmt : public Stmt {
 public:
+  static constexpr NodeKind kKind = NodeKind::kWhileStmt;
+
+  WhileStmt() : Stmt(kKind) {
+  }
+
   void Accept(AstVisitor& visitor) override;
 
   [[nodiscard]] const Expr* Condition() const noexcept;
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "lib/parser/ast/nodes/base/Expr.hpp"
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
 #include "lib/parser/ast/nodes/base/Stmt.hpp"
 #include "lib/parser/ast/nodes/class_members/CallDecl.hpp"
 #include "lib/parser/ast/nodes/class_members/DestructorDecl.hpp"
@@ -473,88 +474,109 @@ void BytecodeVisitor::Visit(Module& node) {
   pending_init_static_types_.clear();
 
   for (auto& decl : node.MutableDecls()) {
-    if (auto* f = dynamic_cast<FunctionDecl*>(decl.get())) {
-      std::string mangled = GenerateFunctionId(f->Name(), f->Params());
-      function_name_map_[f->Name()] = mangled; // Keep for backward compatibility
-
-      FunctionOverload overload;
-      overload.mangled_name = mangled;
-      for (const auto& param : f->Params()) {
-        overload.param_types.push_back(param.GetType());
-      }
-      if (f->ReturnType() != nullptr) {
-        overload.return_type = TypeToMangledName(*f->ReturnType());
-        function_return_types_[f->Name()] = overload.return_type; // Keep last one for backward compatibility
-      } else {
-        overload.return_type = "void";
-        function_return_types_[f->Name()] = "void";
-      }
-      function_overloads_[f->Name()].push_back(std::move(overload));
-    }
-
-    if (auto* c = dynamic_cast<ClassDecl*>(decl.get())) {
-      std::string class_name = c->Name();
-
-      std::vector<std::pair<std::string, TypeReference>> fields;
-      for (auto& m : c->MutableMembers()) {
-        if (const auto* fd = dynamic_cast<FieldDecl*>(m.get())) {
-          fields.emplace_back(fd->Name(), fd->Type());
+    switch (decl->Kind()) {
+      case NodeKind::kFunctionDecl: {
+        auto* f = Cast<FunctionDecl>(decl.get());
+        std::string mangled = GenerateFunctionId(f->Name(), f->Params());
+        function_name_map_[f->Name()] = mangled; // Keep for backward compatibility
+
+        FunctionOverload overload;
+        overload.mangled_name = mangled;
+        for (const auto& param : f->Params()) {
+          overload.param_types.push_back(param.GetType());
         }
-        if (auto* sd = dynamic_cast<StaticFieldDecl*>(m.get())) {
-          if (sd->MutableInit() != nullptr) {
-            pending_init_static_.push_back(sd->MutableInit());
-            pending_init_static_names_.push_back(sd->Name());
-            pending_init_static_types_.push_back(sd->Type());
-          }
+        if (f->ReturnType() != nullptr) {
+          overload.return_type = TypeToMangledName(*f->ReturnType());
+          function_return_types_[f->Name()] = overload.return_type; // Keep last one for backward compatibility
+        } else {
+          overload.return_type = "void";
+          function_return_types_[f->Name()] = "void";
         }
-        if (const auto* md = dynamic_cast<MethodDecl*>(m.get())) {
-          if (md->Name() == class_name) {
-            const std::string ctor = GenerateConstructorId(class_name, md->Params());
-            method_name_map_[class_name + "::<ctor>"] = ctor;
+        function_overloads_[f->Name()].push_back(std::move(overload));
+        break;
+      }
+      case NodeKind::kClassDecl: {
+        auto* c = Cast<ClassDecl>(decl.get());
+        std::string class_name = c->Name();
 
-            std::vector<TypeReference> param_types;
-            for (const auto& param : md->Params()) {
-              param_types.push_back(param.GetType());
+        std::vector<std::pair<std::string, TypeReference>> fields;
+        for (auto& m : c->MutableMembers()) {
+          switch (m->Kind()) {
+            case NodeKind::kFieldDecl: {
+              const auto* fd = Cast<FieldDecl>(m.get());
+              fields.emplace_back(fd->Name(), fd->Type());
+              break;
             }
-            constructor_params_[class_name + "::<ctor>"] = param_types;
-          } else {
-            bool is_mutable = false;
-            std::string mid = GenerateMethodId(class_name, md->Name(), md->Params(), false, false, is_mutable);
-            std::string vtable_name = GenerateMethodVTableName(md->Name(), md->Params(), is_mutable);
-            method_name_map_[class_name + "::" + md->Name()] = mid;
-            method_vtable_map_[class_name + "::" + md->Name()] = vtable_name;
-
-            if (md->ReturnType() != nullptr) {
-              method_return_types_[class_name + "::" + md->Name()] = TypeToMangledName(*md->ReturnType());
-            } else {
-              method_return_types_[class_name + "::" + md->Name()] = "void";
+            case NodeKind::kStaticFieldDecl: {
+              auto* sd = Cast<StaticFieldDecl>(m.get());
+              if (sd->MutableInit() != nullptr) {
+                pending_init_static_.push_back(sd->MutableInit());
+                pending_init_static_names_.push_back(sd->Name());
+                pending_init_static_types_.push_back(sd->Type());
+              }
+              break;
             }
+            case NodeKind::kMethodDecl: {
+              const auto* md = Cast<MethodDecl>(m.get());
+              if (md->Name() == class_name) {
+                const std::string ctor = GenerateConstructorId(class_name, md->Params());
+                method_name_map_[class_name + "::<ctor>"] = ctor;
+
+                std::vector<TypeReference> param_types;
+                for (const auto& param : md->Params()) {
+                  param_types.push_back(param.GetType());
+                }
+                constructor_params_[class_name + "::<ctor>"] = param_types;
+              } else {
+                bool is_mutable = false;
+                std::string mid = GenerateMethodId(class_name, md->Name(), md->Params(), false, false, is_mutable);
+                std::string vtable_name = GenerateMethodVTableName(md->Name(), md->Params(), is_mutable);
+                method_name_map_[class_name + "::" + md->Name()] = mid;
+                method_vtable_map_[class_name + "::" + md->Name()] = vtable_name;
+
+                if (md->ReturnType() != nullptr) {
+                  method_return_types_[class_name + "::" + md->Name()] = TypeToMangledName(*md->ReturnType());
+                } else {
+                  method_return_types_[class_name + "::" + md->Name()] = "void";
+                }
+              }
+              break;
+            }
+            case NodeKind::kCallDecl: {
+              auto* cd = Cast<CallDecl>(m.get());
+              std::string ctor = GenerateConstructorId(class_name, cd->Params());
+              method_name_map_[class_name + "::<ctor>"] = ctor;
+
+              std::vector<TypeReference> param_types;
+              for (const auto& param : cd->Params()) {
+                param_types.push_back(param.GetType());
+              }
+              constructor_params_[class_name + "::<ctor>"] = param_types;
+              break;
+            }
+            default:
+              break;
           }
         }
-        if (auto* cd = dynamic_cast<CallDecl*>(m.get())) {
-          std::string ctor = GenerateConstructorId(class_name, cd->Params());
-          method_name_map_[class_name + "::<ctor>"] = ctor;
-
-          std::vector<TypeReference> param_types;
-          for (const auto& param : cd->Params()) {
-            param_types.push_back(param.GetType());
-          }
-          constructor_params_[class_name + "::<ctor>"] = param_types;
+        class_fields_[class_name] = fields;
+        break;
+      }
+      case NodeKind::kGlobalVarDecl: {
+        auto* gv = Cast<GlobalVarDecl>(decl.get());
+        if (gv->MutableInit() != nullptr) {
+          pending_init_static_.push_back(gv->MutableInit());
+          pending_init_static_names_.push_back(gv->Name());
+          pending_init_static_types_.push_back(gv->Type());
         }
+        break;
       }
-      class_fields_[class_name] = fields;
-    }
-
-    if (auto* gv = dynamic_cast<GlobalVarDecl*>(decl.get())) {
-      if (gv->MutableInit() != nullptr) {
-        pending_init_static_.push_back(gv->MutableInit());
-        pending_init_static_names_.push_back(gv->Name());
-        pending_init_static_types_.push_back(gv->Type());
+      case NodeKind::kTypeAliasDecl: {
+        auto* ta = Cast<TypeAliasDecl>(decl.get());
+        type_aliases_[ta->Name()] = ta->AliasedType();
+        break;
       }
-    }
-
-    if (auto* ta = dynamic_cast<TypeAliasDecl*>(decl.get())) {
-      type_aliases_[ta->Name()] = ta->AliasedType();
+      default:
+        break;
     }
   }
 
@@ -671,7 +693,7 @@ void BytecodeVisitor::Visit(MethodDecl& node) {
     if (node.MutableBody() != nullptr) {
       bool has_return = false;
       if (const auto& stmts = node.MutableBody()->GetStatements(); !stmts.empty()) {
-        if (dynamic_cast<ReturnStmt*>(stmts.back().get()) != nullptr) {
+        if (Isa<ReturnStmt>(stmts.back().get())) {
           has_return = true;
         }
       }
@@ -745,7 +767,7 @@ void BytecodeVisitor::Visit(CallDecl& node) {
     // Check if body ends with return statement
     bool has_return = false;
     if (const auto& stmts = node.MutableBody()->GetStatements(); !stmts.empty()) {
-      if (dynamic_cast<ReturnStmt*>(stmts.back().get()) != nullptr) {
+      if (Isa<ReturnStmt>(stmts.back().get())) {
         has_return = true;
       }
     }
@@ -845,49 +867,58 @@ void BytecodeVisitor::Visit(ClassDecl& node) {
   std::vector<std::pair<std::string, std::string>> method_map;
 
   for (auto& member : node.MutableMembers()) {
-    if (auto* fd = dynamic_cast<FieldDecl*>(member.get())) {
-      fields.emplace_back(fd->Name(), fd->Type());
-    }
-    if (auto* ifm = dynamic_cast<InterfaceMethod*>(member.get())) {
-      (void) ifm;
-    }
-    if (auto* md = dynamic_cast<MethodDecl*>(member.get())) {
-      if (md->Name() == node.Name()) {
-        std::string ctor_id = GenerateConstructorId(node.Name(), md->Params());
-        method_name_map_[node.Name() + "::<ctor>"] = ctor_id;
+    switch (member->Kind()) {
+      case NodeKind::kFieldDecl: {
+        auto* fd = Cast<FieldDecl>(member.get());
+        fields.emplace_back(fd->Name(), fd->Type());
+        break;
+      }
+      case NodeKind::kMethodDecl: {
+        auto* md = Cast<MethodDecl>(member.get());
+        if (md->Name() == node.Name()) {
+          std::string ctor_id = GenerateConstructorId(node.Name(), md->Params());
+          method_name_map_[node.Name() + "::<ctor>"] = ctor_id;
 
-        std::vector<TypeReference> param_types;
-        for (const auto& param : md->Params()) {
-          param_types.push_back(param.GetType());
-        }
-        constructor_params_[node.Name() + "::<ctor>"] = param_types;
+          std::vector<TypeReference> param_types;
+          for (const auto& param : md->Params()) {
+            param_types.push_back(param.GetType());
+          }
+          constructor_params_[node.Name() + "::<ctor>"] = param_types;
 
-      } else {
-        bool is_mutable = false;
-        std::string mid = GenerateMethodId(node.Name(), md->Name(), md->Params(), false, false, is_mutable);
-        std::string vtable_name = GenerateMethodVTableName(md->Name(), md->Params(), is_mutable);
+        } else {
+          bool is_mutable = false;
+          std::string mid = GenerateMethodId(node.Name(), md->Name(), md->Params(), false, false, is_mutable);
+          std::string vtable_name = GenerateMethodVTableName(md->Name(), md->Params(), is_mutable);
 
-        method_map.emplace_back(md->Name(), mid);
-        method_name_map_[node.Name() + "::" + md->Name()] = mid;
-        method_vtable_map_[node.Name() + "::" + md->Name()] = vtable_name;
+          method_map.emplace_back(md->Name(), mid);
+          method_name_map_[node.Name() + "::" + md->Name()] = mid;
+          method_vtable_map_[node.Name() + "::" + md->Name()] = vtable_name;
+        }
+        break;
       }
-    }
-    if (auto* cd = dynamic_cast<CallDecl*>(member.get())) {
-      std::string ce = GenerateConstructorId(node.Name(), cd->Params());
+      case NodeKind::kCallDecl: {
+        auto* cd = Cast<CallDecl>(member.get());
+        std::string ce = GenerateConstructorId(node.Name(), cd->Params());
 
-      method_name_map_[node.Name() + "::<ctor>"] = ce;
+        method_name_map_[node.Name() + "::<ctor>"] = ce;
 
-      std::vector<TypeReference> param_types;
-      for (const auto& param : cd->Params()) {
-        param_types.push_back(param.GetType());
+        std::vector<TypeReference> param_types;
+        for (const auto& param : cd->Params()) {
+          param_types.push_back(param.GetType());
+        }
+        constructor_params_[node.Name() + "::<ctor>"] = param_types;
+        break;
       }
-      constructor_params_[node.Name() + "::<ctor>"] = param_types;
-    }
-    if (auto* sfd = dynamic_cast<StaticFieldDecl*>(member.get())) {
-      if (sfd->MutableInit() != nullptr) {
-        pending_init_static_.push_back(sfd->MutableInit());
-        pending_init_static_names_.push_back(sfd->Name());
+      case NodeKind::kStaticFieldDecl: {
+        auto* sfd = Cast<StaticFieldDecl>(member.get());
+        if (sfd->MutableInit() != nullptr) {
+          pending_init_static_.push_back(sfd->MutableInit());
+          pending_init_static_names_.push_back(sfd->Name());
+        }
+        break;
       }
+      default:
+        break;
     }
   }
 
@@ -927,7 +958,7 @@ void BytecodeVisitor::Visit(ClassDecl& node) {
 
       std::string vtable_name;
       for (auto& member : node.MutableMembers()) {
-        if (auto* md = dynamic_cast<MethodDecl*>(member.get())) {
+        if (auto* md = DynCast<MethodDecl>(member.get())) {
           if (md->Name() == fst) {
             bool is_mutable = false;
             vtable_name = GenerateMethodVTableName(fst, md->Params(), is_mutable);
@@ -999,8 +1030,8 @@ void BytecodeVisitor::Visit(VarDeclStmt& node) {
 void BytecodeVisitor::Visit(ExprStmt& node) {
   if (node.MutableExpression() != nullptr) {
     bool is_system_command = false;
-    if (auto* call = dynamic_cast<Call*>(node.MutableExpression())) {
-      if (auto* ns_ref = dynamic_cast<NamespaceRef*>(&call->MutableCallee())) {
+    if (auto* call = DynCast<Call>(node.MutableExpression())) {
+      if (auto* ns_ref = DynCast<NamespaceRef>(&call->MutableCallee())) {
         is_system_command = IsBuiltinSystemCommand(ns_ref->Name());
       }
     }
@@ -1009,10 +1040,10 @@ void BytecodeVisitor::Visit(ExprStmt& node) {
 
     bool should_pop = true;
 
-    if (is_system_command || dynamic_cast<Assign*>(node.MutableExpression())) {
+    if (is_system_command || Isa<Assign>(node.MutableExpression())) {
       should_pop = false;
-    } else if (auto* call = dynamic_cast<Call*>(node.MutableExpression())) {
-      if (const auto* ident = dynamic_cast<IdentRef*>(&call->MutableCallee())) {
+    } else if (auto* call = DynCast<Call>(node.MutableExpression())) {
+      if (const auto* ident = DynCast<IdentRef>(&call->MutableCallee())) {
         const std::string func_name = ident->Name();
         if (const auto return_type_it = function_return_types_.find(func_name);
             return_type_it != function_return_types_.end()) {
@@ -1020,7 +1051,7 @@ void BytecodeVisitor::Visit(ExprStmt& node) {
             should_pop = false;
           }
         }
-      } else if (auto* field_access = dynamic_cast<FieldAccess*>(&call->MutableCallee())) {
+      } else if (auto* field_access = DynCast<FieldAccess>(&call->MutableCallee())) {
         const std::string method_name = field_access->Name();
 
         // Use GetTypeNameForExpr to determine object type, which handles chained calls
@@ -1028,8 +1059,8 @@ void BytecodeVisitor::Visit(ExprStmt& node) {
 
         // If object_type is "unknown" (from a Call expression), try to resolve it for chained calls
         if (object_type == "unknown" || object_type.empty()) {
-          if (auto* nested_call = dynamic_cast<Call*>(&field_access->MutableObject())) {
-            if (auto* nested_field_access = dynamic_cast<FieldAccess*>(&nested_call->MutableCallee())) {
+          if (auto* nested_call = DynCast<Call>(&field_access->MutableObject())) {
+            if (auto* nested_field_access = DynCast<FieldAccess>(&nested_call->MutableCallee())) {
               std::string nested_method_name = nested_field_access->Name();
               std::string nested_object_type = GetTypeNameForExpr(&nested_field_access->MutableObject());
 
@@ -1164,7 +1195,7 @@ void BytecodeVisitor::Visit(ForStmt& node) {
   std::string collection_type;
 
   if (node.MutableIteratorExpr() != nullptr) {
-    if (const auto* ident = dynamic_cast<IdentRef*>(node.MutableIteratorExpr())) {
+    if (const auto* ident = DynCast<IdentRef>(node.MutableIteratorExpr())) {
       const auto var_it = variable_types_.find(ident->Name());
       if (const auto local_it = local_variables_.find(ident->Name());
           var_it != variable_types_.end() && local_it != local_variables_.end()) {
@@ -1243,11 +1274,10 @@ void BytecodeVisitor::Visit(UnsafeBlock& node) {
 void BytecodeVisitor::Visit(Binary& node) {
   const auto& op = node.Op();
 
-  bool is_null_comparison =
-      dynamic_cast<NullLit*>(&node.MutableLhs()) != nullptr || dynamic_cast<NullLit*>(&node.MutableRhs()) != nullptr;
+  bool is_null_comparison = Isa<NullLit>(node.MutableLhs()) || Isa<NullLit>(node.MutableRhs());
 
   if (is_null_comparison && (&op == &optags::Eq() || &op == &optags::Ne())) {
-    if (dynamic_cast<NullLit*>(&node.MutableLhs()) != nullptr) {
+    if (Isa<NullLit>(node.MutableLhs())) {
       node.MutableRhs().Accept(*this);
     } else {
       node.MutableLhs().Accept(*this);
@@ -1385,9 +1415,9 @@ void BytecodeVisitor::Visit(Assign& node) {
   const auto& op = node.Kind();
   bool is_copy_assign = (&op == &optags::CopyAssign());
 
-  if (auto* field_access = dynamic_cast<FieldAccess*>(&node.MutableTarget())) {
+  if (auto* field_access = DynCast<FieldAccess>(&node.MutableTarget())) {
     std::string object_type_name;
-    if (auto* ident = dynamic_cast<IdentRef*>(&field_access->MutableObject())) {
+    if (auto* ident = DynCast<IdentRef>(&field_access->MutableObject())) {
       if (auto type_it = variable_types_.find(ident->Name()); type_it != variable_types_.end()) {
         object_type_name = type_it->second;
       }
@@ -1433,7 +1463,7 @@ void BytecodeVisitor::Visit(Assign& node) {
   if (is_copy_assign) {
     std::string target_type_name;
 
-    if (auto* target_ident = dynamic_cast<IdentRef*>(&node.MutableTarget())) {
+    if (auto* target_ident = DynCast<IdentRef>(&node.MutableTarget())) {
       if (auto type_it = variable_types_.find(target_ident->Name()); type_it != variable_types_.end()) {
         target_type_name = type_it->second;
       }
@@ -1456,7 +1486,7 @@ void BytecodeVisitor::Visit(Assign& node) {
     }
   }
 
-  if (auto* ident = dynamic_cast<IdentRef*>(&node.MutableTarget())) {
+  if (auto* ident = DynCast<IdentRef>(&node.MutableTarget())) {
     // Check if this is a global variable before generating code
     bool is_global = static_variables_.contains(ident->Name());
 
@@ -1477,7 +1507,7 @@ void BytecodeVisitor::Visit(Assign& node) {
     } else {
       EmitCommandWithInt("SetLocal", static_cast<int64_t>(GetLocalIndex(ident->Name())));
     }
-  } else if (auto* index_access = dynamic_cast<IndexAccess*>(&node.MutableTarget())) {
+  } else if (auto* index_access = DynCast<IndexAccess>(&node.MutableTarget())) {
     node.MutableValue().Accept(*this);
 
     std::string array_type = GetTypeNameForExpr(&index_access->MutableObject());
@@ -1506,7 +1536,7 @@ void BytecodeVisitor::Visit(Assign& node) {
 void BytecodeVisitor::Visit(Call& node) {
   auto& args = node.MutableArgs();
 
-  if (auto* ns_ref = dynamic_cast<NamespaceRef*>(&node.MutableCallee())) {
+  if (auto* ns_ref = DynCast<NamespaceRef>(&node.MutableCallee())) {
     std::string ns_name = ns_ref->Name();
 
     if (IsBuiltinSystemCommand(ns_name)) {
@@ -1616,7 +1646,7 @@ void BytecodeVisitor::Visit(Call& node) {
     return;
   }
 
-  if (auto* ident = dynamic_cast<IdentRef*>(&node.MutableCallee())) {
+  if (auto* ident = DynCast<IdentRef>(&node.MutableCallee())) {
     std::string name = ident->Name();
 
     if (kBuiltinTypeNames.contains(name)) {
@@ -1804,21 +1834,21 @@ void BytecodeVisitor::Visit(Call& node) {
     return;
   }
 
-  if (auto* field_access = dynamic_cast<FieldAccess*>(&node.MutableCallee())) {
+  if (auto* field_access = DynCast<FieldAccess>(&node.MutableCallee())) {
     std::string method_name = field_access->Name();
 
     std::string object_type;
-    if (auto* ident = dynamic_cast<IdentRef*>(&field_access->MutableObject())) {
+    if (auto* ident = DynCast<IdentRef>(&field_access->MutableObject())) {
       if (auto type_it = variable_types_.find(ident->Name()); type_it != variable_types_.end()) {
         object_type = type_it->second;
       }
-    } else if (dynamic_cast<StringLit*>(&field_access->MutableObject())) {
+    } else if (Isa<StringLit>(field_access->MutableObject())) {
       object_type = "String";
-    } else if (dynamic_cast<IntLit*>(&field_access->MutableObject())) {
+    } else if (Isa<IntLit>(field_access->MutableObject())) {
       object_type = "int";
-    } else if (dynamic_cast<FloatLit*>(&field_access->MutableObject())) {
+    } else if (Isa<FloatLit>(field_access->MutableObject())) {
       object_type = "float";
-    } else if (dynamic_cast<ThisExpr*>(&field_access->MutableObject())) {
+    } else if (Isa<ThisExpr>(field_access->MutableObject())) {
       object_type = current_class_name_;
     }
 
@@ -1826,12 +1856,12 @@ void BytecodeVisitor::Visit(Call& node) {
       object_type = GetTypeNameForExpr(&field_access->MutableObject());
     }
 
-    if (auto* nested_field_access = dynamic_cast<FieldAccess*>(&field_access->MutableObject())) {
+    if (auto* nested_field_access = DynCast<FieldAccess>(&field_access->MutableObject())) {
       std::string field_type;
       std::string nested_object_type = object_type;
-      if (dynamic_cast<ThisExpr*>(&nested_field_access->MutableObject())) {
+      if (Isa<ThisExpr>(nested_field_access->MutableObject())) {
         nested_object_type = current_class_name_;
-      } else if (auto* nested_ident = dynamic_cast<IdentRef*>(&nested_field_access->MutableObject())) {
+      } else if (auto* nested_ident = DynCast<IdentRef>(&nested_field_access->MutableObject())) {
         if (auto type_it = variable_types_.find(nested_ident->Name()); type_it != variable_types_.end()) {
           nested_object_type = type_it->second;
         }
@@ -2116,7 +2146,7 @@ void BytecodeVisitor::Visit(FieldAccess& node) {
   node.MutableObject().Accept(*this);
 
   std::string object_type_name;
-  if (const auto* ident = dynamic_cast<IdentRef*>(&node.MutableObject())) {
+  if (const auto* ident = DynCast<IdentRef>(&node.MutableObject())) {
     if (const auto type_it = variable_types_.find(ident->Name()); type_it != variable_types_.end()) {
       object_type_name = type_it->second;
     }
@@ -2168,7 +2198,7 @@ void BytecodeVisitor::Visit(SafeCall& node) {
 void BytecodeVisitor::Visit(Elvis& node) {
   bool use_direct_var = false;
   size_t lhs_var_index = 0;
-  if (const auto* ident = dynamic_cast<IdentRef*>(&node.MutableLhs())) {
+  if (const auto* ident = DynCast<IdentRef>(&node.MutableLhs())) {
     const auto var_it = variable_types_.find(ident->Name());
     if (const auto local_it = local_variables_.find(ident->Name());
         var_it != variable_types_.end() && local_it != local_variables_.end()) {
@@ -2264,7 +2294,7 @@ void BytecodeVisitor::Visit(CastAs& node) {
 
   bool use_direct_var = false;
   size_t expr_var_index = 0;
-  if (const auto* ident = dynamic_cast<IdentRef*>(&node.MutableExpression())) {
+  if (const auto* ident = DynCast<IdentRef>(&node.MutableExpression())) {
     const auto var_it = variable_types_.find(ident->Name());
     if (const auto local_it = local_variables_.find(ident->Name());
         var_it != variable_types_.end() && local_it != local_variables_.end()) {
@@ -2550,25 +2580,141 @@ BytecodeVisitor::OperandType BytecodeVisitor::DetermineOperandType(Expr* expr) {
     return OperandType::kUnknown;
   }
 
-  if (dynamic_cast<IntLit*>(expr) != nullptr) {
-    return OperandType::kInt;
-  }
-  if (dynamic_cast<FloatLit*>(expr) != nullptr) {
-    return OperandType::kFloat;
-  }
-  if (dynamic_cast<StringLit*>(expr) != nullptr) {
-    return OperandType::kString;
-  }
-  if (dynamic_cast<BoolLit*>(expr) != nullptr) {
-    return OperandType::kBool;
-  }
-  if (dynamic_cast<CharLit*>(expr) != nullptr) {
-    return OperandType::kChar;
-  }
+  switch (expr->Kind()) {
+    case NodeKind::kIntLit:
+      return OperandType::kInt;
+    case NodeKind::kFloatLit:
+      return OperandType::kFloat;
+    case NodeKind::kStringLit:
+      return OperandType::kString;
+    case NodeKind::kBoolLit:
+      return OperandType::kBool;
+    case NodeKind::kCharLit:
+      return OperandType::kChar;
+    case NodeKind::kIdentRef: {
+      const auto* ident = Cast<IdentRef>(expr);
+      if (const auto it = variable_types_.find(ident->Name()); it != variable_types_.end()) {
+        const std::string& type_name = it->second;
+        if (type_name == "int" || type_name == "Int") {
+          return OperandType::kInt;
+        }
+        if (type_name == "float" || type_name == "Float") {
+          return OperandType::kFloat;
+        }
+        if (type_name == "byte" || type_name == "Byte") {
+          return OperandType::kByte;
+        }
+        if (type_name == "bool" || type_name == "Bool") {
+          return OperandType::kBool;
+        }
+        if (type_name == "char" || type_name == "Char") {
+          return OperandType::kChar;
+        }
+        if (type_name == "String") {
+          return OperandType::kString;
+        }
+      }
+      break;
+    }
+    case NodeKind::kFieldAccess: {
+      auto* field_access = Cast<FieldAccess>(expr);
+      // First, try to get the object type using GetTypeNameForExpr
+      // This handles cases where the object is a variable, method call result, etc.
+      std::string object_type_name = GetTypeNameForExpr(&field_access->MutableObject());
 
-  if (const auto* ident = dynamic_cast<IdentRef*>(expr)) {
-    if (const auto it = variable_types_.find(ident->Name()); it != variable_types_.end()) {
-      const std::string& type_name = it->second;
+      // If object_type is "unknown" (from a Call expression), try to resolve it for chained calls
+      if (object_type_name == "unknown" || object_type_name.empty()) {
+        if (auto* nested_call = DynCast<Call>(&field_access->MutableObject())) {
+          // Get the return type of the nested call by examining its structure
+          if (auto* nested_field_access = DynCast<FieldAccess>(&nested_call->MutableCallee())) {
+            std::string nested_method_name = nested_field_access->Name();
+            std::string nested_object_type = GetTypeNameForExpr(&nested_field_access->MutableObject());
+
+            // Check if this is a method call on a user-defined type
+            if (!nested_object_type.empty() && !kBuiltinTypeNames.contains(nested_object_type)) {
+              std::string nested_method_key = nested_object_type + "::" + nested_method_name;
+              if (const auto nested_it = method_return_types_.find(nested_method_key);
+                  nested_it != method_return_types_.end()) {
+                object_type_name = nested_it->second;
+              }
+            }
+          }
+        }
+
+        // If that didn't work, try checking if it's a direct IdentRef
+        if (object_type_name.empty() || object_type_name == "unknown") {
+          if (auto* ident = DynCast<IdentRef>(&field_access->MutableObject())) {
+            if (const auto type_it = variable_types_.find(ident->Name()); type_it != variable_types_.end()) {
+              object_type_name = type_it->second;
+            }
+          }
+        }
+      }
+
+      // If we have an object type, look up the field in that class
+      if (!object_type_name.empty() && object_type_name != "unknown") {
+        if (const auto fields_it = class_fields_.find(object_type_name); fields_it != class_fields_.end()) {
+          for (const auto& fields = fields_it->second; const auto& [fst, snd] : fields) {
+            if (fst == field_access->Name()) {
+              const std::string& type_name = TypeToMangledName(snd);
+              if (type_name == "int" || type_name == "Int") {
+                return OperandType::kInt;
+              }
+              if (type_name == "float" || type_name == "Float") {
+                return OperandType::kFloat;
+              }
+              if (type_name == "byte" || type_name == "Byte") {
+                return OperandType::kByte;
+              }
+              if (type_name == "bool" || type_name == "Bool") {
+                return OperandType::kBool;
+              }
+              if (type_name == "char" || type_name == "Char") {
+                return OperandType::kChar;
+              }
+              if (type_name == "String") {
+                return OperandType::kString;
+              }
+              break;
+            }
+          }
+        }
+      }
+
+      // Fallback: check current class if we're inside a class
+      if (!current_class_name_.empty()) {
+        if (const auto fields_it = class_fields_.find(current_class_name_); fields_it != class_fields_.end()) {
+          for (const auto& fields = fields_it->second; const auto& [fst, snd] : fields) {
+            if (fst == field_access->Name()) {
+              const std::string& type_name = TypeToMangledName(snd);
+              if (type_name == "int" || type_name == "Int") {
+                return OperandType::kInt;
+              }
+              if (type_name == "float" || type_name == "Float") {
+                return OperandType::kFloat;
+              }
+              if (type_name == "byte" || type_name == "Byte") {
+                return OperandType::kByte;
+              }
+              if (type_name == "bool" || type_name == "Bool") {
+                return OperandType::kBool;
+              }
+              if (type_name == "char" || type_name == "Char") {
+                return OperandType::kChar;
+              }
+              if (type_name == "String") {
+                return OperandType::kString;
+              }
+              break;
+            }
+          }
+        }
+      }
+      break;
+    }
+    case NodeKind::kCastAs: {
+      const auto* cast = Cast<CastAs>(expr);
+      const std::string& type_name = TypeToMangledName(cast->Type());
       if (type_name == "int" || type_name == "Int") {
         return OperandType::kInt;
       }
@@ -2587,215 +2733,104 @@ BytecodeVisitor::OperandType BytecodeVisitor::DetermineOperandType(Expr* expr) {
       if (type_name == "String") {
         return OperandType::kString;
       }
+      break;
     }
-  }
-
-  if (auto* field_access = dynamic_cast<FieldAccess*>(expr)) {
-    // First, try to get the object type using GetTypeNameForExpr
-    // This handles cases where the object is a variable, method call result, etc.
-    std::string object_type_name = GetTypeNameForExpr(&field_access->MutableObject());
+    case NodeKind::kIndexAccess: {
+      auto* index_access = Cast<IndexAccess>(expr);
+      // Get the element type of the array
+      std::string array_type = GetTypeNameForExpr(&index_access->MutableObject());
+      std::string elem_type = GetElementTypeForArray(array_type);
 
-    // If object_type is "unknown" (from a Call expression), try to resolve it for chained calls
-    if (object_type_name == "unknown" || object_type_name.empty()) {
-      if (auto* nested_call = dynamic_cast<Call*>(&field_access->MutableObject())) {
-        // Get the return type of the nested call by examining its structure
-        if (auto* nested_field_access = dynamic_cast<FieldAccess*>(&nested_call->MutableCallee())) {
-          std::string nested_method_name = nested_field_access->Name();
-          std::string nested_object_type = GetTypeNameForExpr(&nested_field_access->MutableObject());
-
-          // Check if this is a method call on a user-defined type
-          if (!nested_object_type.empty() && !kBuiltinTypeNames.contains(nested_object_type)) {
-            std::string nested_method_key = nested_object_type + "::" + nested_method_name;
-            if (const auto nested_it = method_return_types_.find(nested_method_key);
-                nested_it != method_return_types_.end()) {
-              object_type_name = nested_it->second;
-            }
-          }
-        }
+      if (elem_type == "int") {
+        return OperandType::kInt;
       }
-
-      // If that didn't work, try checking if it's a direct IdentRef
-      if (object_type_name.empty() || object_type_name == "unknown") {
-        if (auto* ident = dynamic_cast<IdentRef*>(&field_access->MutableObject())) {
-          if (const auto type_it = variable_types_.find(ident->Name()); type_it != variable_types_.end()) {
-            object_type_name = type_it->second;
-          }
-        }
+      if (elem_type == "float") {
+        return OperandType::kFloat;
       }
-    }
-
-    // If we have an object type, look up the field in that class
-    if (!object_type_name.empty() && object_type_name != "unknown") {
-      if (const auto fields_it = class_fields_.find(object_type_name); fields_it != class_fields_.end()) {
-        for (const auto& fields = fields_it->second; const auto& [fst, snd] : fields) {
-          if (fst == field_access->Name()) {
-            const std::string& type_name = TypeToMangledName(snd);
-            if (type_name == "int" || type_name == "Int") {
-              return OperandType::kInt;
-            }
-            if (type_name == "float" || type_name == "Float") {
-              return OperandType::kFloat;
-            }
-            if (type_name == "byte" || type_name == "Byte") {
-              return OperandType::kByte;
-            }
-            if (type_name == "bool" || type_name == "Bool") {
-              return OperandType::kBool;
-            }
-            if (type_name == "char" || type_name == "Char") {
-              return OperandType::kChar;
-            }
-            if (type_name == "String") {
-              return OperandType::kString;
-            }
-            break;
-          }
-        }
+      if (elem_type == "byte") {
+        return OperandType::kByte;
       }
-    }
-
-    // Fallback: check current class if we're inside a class
-    if (!current_class_name_.empty()) {
-      if (const auto fields_it = class_fields_.find(current_class_name_); fields_it != class_fields_.end()) {
-        for (const auto& fields = fields_it->second; const auto& [fst, snd] : fields) {
-          if (fst == field_access->Name()) {
-            const std::string& type_name = TypeToMangledName(snd);
-            if (type_name == "int" || type_name == "Int") {
-              return OperandType::kInt;
-            }
-            if (type_name == "float" || type_name == "Float") {
-              return OperandType::kFloat;
-            }
-            if (type_name == "byte" || type_name == "Byte") {
-              return OperandType::kByte;
-            }
-            if (type_name == "bool" || type_name == "Bool") {
-              return OperandType::kBool;
-            }
-            if (type_name == "char" || type_name == "Char") {
-              return OperandType::kChar;
-            }
-            if (type_name == "String") {
-              return OperandType::kString;
-            }
-            break;
-          }
-        }
+      if (elem_type == "bool") {
+        return OperandType::kBool;
       }
+      if (elem_type == "char") {
+        return OperandType::kChar;
+      }
+      if (elem_type == "String") {
+        return OperandType::kString;
+      }
+      break;
     }
-  }
-
-  if (const auto* cast = dynamic_cast<CastAs*>(expr)) {
-    const std::string& type_name = TypeToMangledName(cast->Type());
-    if (type_name == "int" || type_name == "Int") {
-      return OperandType::kInt;
-    }
-    if (type_name == "float" || type_name == "Float") {
-      return OperandType::kFloat;
-    }
-    if (type_name == "byte" || type_name == "Byte") {
-      return OperandType::kByte;
-    }
-    if (type_name == "bool" || type_name == "Bool") {
-      return OperandType::kBool;
-    }
-    if (type_name == "char" || type_name == "Char") {
-      return OperandType::kChar;
-    }
-    if (type_name == "String") {
-      return OperandType::kString;
-    }
-  }
-
-  if (auto* index_access = dynamic_cast<IndexAccess*>(expr)) {
-    // Get the element type of the array
-    std::string array_type = GetTypeNameForExpr(&index_access->MutableObject());
-    std::string elem_type = GetElementTypeForArray(array_type);
-
-    if (elem_type == "int") {
-      return OperandType::kInt;
-    }
-    if (elem_type == "float") {
-      return OperandType::kFloat;
-    }
-    if (elem_type == "byte") {
-      return OperandType::kByte;
-    }
-    if (elem_type == "bool") {
-      return OperandType::kBool;
-    }
-    if (elem_type == "char") {
-      return OperandType::kChar;
-    }
-    if (elem_type == "String") {
-      return OperandType::kString;
-    }
-  }
-
-  if (auto* binary = dynamic_cast<Binary*>(expr)) {
-    OperandType lhs_type = DetermineOperandType(&binary->MutableLhs());
-    OperandType rhs_type = DetermineOperandType(&binary->MutableRhs());
-
-    const auto& op = binary->Op();
-    if (&op == &optags::LeftShift() || &op == &optags::RightShift()) {
-      return lhs_type != OperandType::kUnknown ? lhs_type : OperandType::kInt;
-    }
-
-    if (const bool is_bitwise = &op == &optags::BitwiseAnd() || &op == &optags::BitwiseOr() || &op == &optags::Xor();
-        is_bitwise && (lhs_type == OperandType::kByte || rhs_type == OperandType::kByte)) {
-      return OperandType::kByte;
-    }
+    case NodeKind::kBinary: {
+      auto* binary = Cast<Binary>(expr);
+      OperandType lhs_type = DetermineOperandType(&binary->MutableLhs());
+      OperandType rhs_type = DetermineOperandType(&binary->MutableRhs());
 
-    if (lhs_type == OperandType::kFloat || rhs_type == OperandType::kFloat) {
-      return OperandType::kFloat;
-    }
+      const auto& op = binary->Op();
+      if (&op == &optags::LeftShift() || &op == &optags::RightShift()) {
+        return lhs_type != OperandType::kUnknown ? lhs_type : OperandType::kInt;
+      }
 
-    if (lhs_type == OperandType::kInt || rhs_type == OperandType::kInt) {
-      return OperandType::kInt;
-    }
+      if (const bool is_bitwise = &op == &optags::BitwiseAnd() || &op == &optags::BitwiseOr() || &op == &optags::Xor();
+          is_bitwise && (lhs_type == OperandType::kByte || rhs_type == OperandType::kByte)) {
+        return OperandType::kByte;
+      }
 
-    if (lhs_type == OperandType::kByte || rhs_type == OperandType::kByte) {
-      return OperandType::kByte;
-    }
+      if (lhs_type == OperandType::kFloat || rhs_type == OperandType::kFloat) {
+        return OperandType::kFloat;
+      }
 
-    if (lhs_type == OperandType::kString || rhs_type == OperandType::kString) {
-      return OperandType::kString;
-    }
+      if (lhs_type == OperandType::kInt || rhs_type == OperandType::kInt) {
+        return OperandType::kInt;
+      }
 
-    if (lhs_type != OperandType::kUnknown) {
-      return lhs_type;
-    }
+      if (lhs_type == OperandType::kByte || rhs_type == OperandType::kByte) {
+        return OperandType::kByte;
+      }
 
-    if (rhs_type != OperandType::kUnknown) {
-      return rhs_type;
-    }
-  }
+      if (lhs_type == OperandType::kString || rhs_type == OperandType::kString) {
+        return OperandType::kString;
+      }
 
-  if (auto* unary = dynamic_cast<Unary*>(expr)) {
-    return DetermineOperandType(&unary->MutableOperand());
-  }
+      if (lhs_type != OperandType::kUnknown) {
+        return lhs_type;
+      }
 
-  if (auto* call = dynamic_cast<Call*>(expr)) {
-    // Use GetTypeNameForExpr to determine return type
-    std::string return_type = GetTypeNameForExpr(call);
-    if (return_type == "int") {
-      return OperandType::kInt;
-    }
-    if (return_type == "float") {
-      return OperandType::kFloat;
-    }
-    if (return_type == "byte") {
-      return OperandType::kByte;
-    }
-    if (return_type == "bool") {
-      return OperandType::kBool;
+      if (rhs_type != OperandType::kUnknown) {
+        return rhs_type;
+      }
+      break;
     }
-    if (return_type == "char") {
-      return OperandType::kChar;
+    case NodeKind::kUnary: {
+      auto* unary = Cast<Unary>(expr);
+      return DetermineOperandType(&unary->MutableOperand());
     }
-    if (return_type == "String") {
-      return OperandType::kString;
+    case NodeKind::kCall: {
+      auto* call = Cast<Call>(expr);
+      // Use GetTypeNameForExpr to determine return type
+      std::string return_type = GetTypeNameForExpr(call);
+      if (return_type == "int") {
+        return OperandType::kInt;
+      }
+      if (return_type == "float") {
+        return OperandType::kFloat;
+      }
+      if (return_type == "byte") {
+        return OperandType::kByte;
+      }
+      if (return_type == "bool") {
+        return OperandType::kBool;
+      }
+      if (return_type == "char") {
+        return OperandType::kChar;
+      }
+      if (return_type == "String") {
+        return OperandType::kString;
+      }
+      break;
     }
+    default:
+      break;
   }
 
   return OperandType::kUnknown;
@@ -2823,253 +2858,290 @@ std::string BytecodeVisitor::GetTypeNameForExpr(Expr* expr) {
     return "unknown";
   }
 
-  if (const auto* ident = dynamic_cast<IdentRef*>(expr)) {
-    if (const auto it = variable_types_.find(ident->Name()); it != variable_types_.end()) {
-      return it->second;
+  switch (expr->Kind()) {
+    case NodeKind::kIdentRef: {
+      const auto* ident = Cast<IdentRef>(expr);
+      if (const auto it = variable_types_.find(ident->Name()); it != variable_types_.end()) {
+        return it->second;
+      }
+      break;
     }
-  }
+    case NodeKind::kFieldAccess: {
+      auto* field = Cast<FieldAccess>(expr);
+      // First, try to get the object type recursively using GetTypeNameForExpr
+      // This handles cases where the object is a variable, method call result, etc.
+      std::string object_type_name = GetTypeNameForExpr(&field->MutableObject());
 
-  if (auto* field = dynamic_cast<FieldAccess*>(expr)) {
-    // First, try to get the object type recursively using GetTypeNameForExpr
-    // This handles cases where the object is a variable, method call result, etc.
-    std::string object_type_name = GetTypeNameForExpr(&field->MutableObject());
-
-    // If object_type is "unknown" (from a Call expression), try to resolve it for chained calls
-    if (object_type_name == "unknown" || object_type_name.empty()) {
-      if (auto* nested_call = dynamic_cast<Call*>(&field->MutableObject())) {
-        // Get the return type of the nested call by examining its structure
-        if (auto* nested_field_access = dynamic_cast<FieldAccess*>(&nested_call->MutableCallee())) {
-          std::string nested_method_name = nested_field_access->Name();
-          std::string nested_object_type = GetTypeNameForExpr(&nested_field_access->MutableObject());
+      // If object_type is "unknown" (from a Call expression), try to resolve it for chained calls
+      if (object_type_name == "unknown" || object_type_name.empty()) {
+        if (auto* nested_call = DynCast<Call>(&field->MutableObject())) {
+          // Get the return type of the nested call by examining its structure
+          if (auto* nested_field_access = DynCast<FieldAccess>(&nested_call->MutableCallee())) {
+            std::string nested_method_name = nested_field_access->Name();
+            std::string nested_object_type = GetTypeNameForExpr(&nested_field_access->MutableObject());
 
-          // Check if this is a method call on a user-defined type
-          if (!nested_object_type.empty() && !kBuiltinTypeNames.contains(nested_object_type)) {
-            std::string nested_method_key = nested_object_type + "::" + nested_method_name;
-            if (const auto nested_it = method_return_types_.find(nested_method_key);
-                nested_it != method_return_types_.end()) {
-              object_type_name = nested_it->second;
+            // Check if this is a method call on a user-defined type
+            if (!nested_object_type.empty() && !kBuiltinTypeNames.contains(nested_object_type)) {
+              std::string nested_method_key = nested_object_type + "::" + nested_method_name;
+              if (const auto nested_it = method_return_types_.find(nested_method_key);
+                  nested_it != method_return_types_.end()) {
+                object_type_name = nested_it->second;
+              }
             }
           }
         }
-      }
 
-      // If that didn't work, try checking if it's a direct IdentRef
-      if (object_type_name.empty() || object_type_name == "unknown") {
-        if (const auto* ident = dynamic_cast<IdentRef*>(&field->MutableObject())) {
-          if (const auto type_it = variable_types_.find(ident->Name()); type_it != variable_types_.end()) {
-            object_type_name = type_it->second;
+        // If that didn't work, try checking if it's a direct IdentRef
+        if (object_type_name.empty() || object_type_name == "unknown") {
+          if (const auto* ident = DynCast<IdentRef>(&field->MutableObject())) {
+            if (const auto type_it = variable_types_.find(ident->Name()); type_it != variable_types_.end()) {
+              object_type_name = type_it->second;
+            }
           }
         }
       }
-    }
 
-    // If we have an object type, look up the field in that class
-    if (!object_type_name.empty() && object_type_name != "unknown") {
-      if (const auto fields_it = class_fields_.find(object_type_name); fields_it != class_fields_.end()) {
-        for (const auto& [fst, snd] : fields_it->second) {
-          if (fst == field->Name()) {
-            return TypeToMangledName(snd);
+      // If we have an object type, look up the field in that class
+      if (!object_type_name.empty() && object_type_name != "unknown") {
+        if (const auto fields_it = class_fields_.find(object_type_name); fields_it != class_fields_.end()) {
+          for (const auto& [fst, snd] : fields_it->second) {
+            if (fst == field->Name()) {
+              return TypeToMangledName(snd);
+            }
           }
         }
       }
-    }
 
-    // Fallback: check current class if we're inside a class
-    if (!current_class_name_.empty()) {
-      if (const auto fields_it = class_fields_.find(current_class_name_); fields_it != class_fields_.end()) {
-        for (const auto& [fst, snd] : fields_it->second) {
-          if (fst == field->Name()) {
-            return TypeToMangledName(snd);
+      // Fallback: check current class if we're inside a class
+      if (!current_class_name_.empty()) {
+        if (const auto fields_it = class_fields_.find(current_class_name_); fields_it != class_fields_.end()) {
+          for (const auto& [fst, snd] : fields_it->second) {
+            if (fst == field->Name()) {
+              return TypeToMangledName(snd);
+            }
           }
         }
       }
+      break;
     }
-  }
-
-  if (dynamic_cast<IntLit*>(expr) != nullptr) {
-    return "int";
-  }
-  if (dynamic_cast<FloatLit*>(expr) != nullptr) {
-    return "float";
-  }
-  if (dynamic_cast<ByteLit*>(expr) != nullptr) {
-    return "byte";
-  }
-  if (dynamic_cast<CharLit*>(expr) != nullptr) {
-    return "char";
-  }
-  if (dynamic_cast<BoolLit*>(expr) != nullptr) {
-    return "bool";
-  }
-  if (dynamic_cast<StringLit*>(expr) != nullptr) {
-    return "String";
-  }
-
-  if (auto* index_access = dynamic_cast<IndexAccess*>(expr)) {
-    std::string array_type = GetTypeNameForExpr(&index_access->MutableObject());
-    return GetElementTypeForArray(array_type);
-  }
-
-  if (auto* call = dynamic_cast<Call*>(expr)) {
-    if (const auto* ident = dynamic_cast<IdentRef*>(&call->MutableCallee())) {
-      std::string func_name = ident->Name();
-      // Handle constructor calls for builtin wrapper types
-      if (kBuiltinTypeNames.contains(func_name)) {
-        return func_name; // Int(0) returns "Int", Float(1.0) returns "Float", etc.
-      }
-      if (const auto it = function_return_types_.find(func_name); it != function_return_types_.end()) {
-        return it->second;
+    case NodeKind::kIntLit:
+      return "int";
+    case NodeKind::kFloatLit:
+      return "float";
+    case NodeKind::kByteLit:
+      return "byte";
+    case NodeKind::kCharLit:
+      return "char";
+    case NodeKind::kBoolLit:
+      return "bool";
+    case NodeKind::kStringLit:
+      return "String";
+    case NodeKind::kIndexAccess: {
+      auto* index_access = Cast<IndexAccess>(expr);
+      std::string array_type = GetTypeNameForExpr(&index_access->MutableObject());
+      return GetElementTypeForArray(array_type);
+    }
+    case NodeKind::kCall: {
+      auto* call = Cast<Call>(expr);
+      if (const auto* ident = DynCast<IdentRef>(&call->MutableCallee())) {
+        std::string func_name = ident->Name();
+        // Handle constructor calls for builtin wrapper types
+        if (kBuiltinTypeNames.contains(func_name)) {
+          return func_name; // Int(0) returns "Int", Float(1.0) returns "Float", etc.
+        }
+        if (const auto it = function_return_types_.find(func_name); it != function_return_types_.end()) {
+          return it->second;
+        }
       }
-    }
 
-    // Handle sys::Sqrt and other sys namespace functions
-    if (auto* ns_ref = dynamic_cast<NamespaceRef*>(&call->MutableCallee())) {
-      std::string ns_name = ns_ref->Name();
-      // Check if namespace is "sys" by examining NamespaceExpr
-      if (const auto* ns_ident = dynamic_cast<IdentRef*>(&ns_ref->MutableNamespaceExpr())) {
-        if (ns_ident->Name() == "sys") {
-          // Check for built-in return types
-          if (const auto it = kBuiltinReturnPrimitives.find(ns_name); it != kBuiltinReturnPrimitives.end()) {
-            return it->second;
-          }
-          if (ns_name == "Sqrt" && call->Args().size() == 1) {
-            return "float";
-          }
-          if (ns_name == "ToString" && call->Args().size() == 1) {
-            // ToString returns String, but we need to check the argument type
-            // to determine which *ToString instruction to use
-            std::string arg_type = GetTypeNameForExpr(call->Args()[0].get());
-            if (arg_type == "int" || arg_type == "Int") {
+      // Handle sys::Sqrt and other sys namespace functions
+      if (auto* ns_ref = DynCast<NamespaceRef>(&call->MutableCallee())) {
+        std::string ns_name = ns_ref->Name();
+        // Check if namespace is "sys" by examining NamespaceExpr
+        if (const auto* ns_ident = DynCast<IdentRef>(&ns_ref->MutableNamespaceExpr())) {
+          if (ns_ident->Name() == "sys") {
+            // Check for built-in return types
+            if (const auto it = kBuiltinReturnPrimitives.find(ns_name); it != kBuiltinReturnPrimitives.end()) {
+              return it->second;
+            }
+            if (ns_name == "Sqrt" && call->Args().size() == 1) {
+              return "float";
+            }
+            if (ns_name == "ToString" && call->Args().size() == 1) {
+              // ToString returns String, but we need to check the argument type
+              // to determine which *ToString instruction to use
+              std::string arg_type = GetTypeNameForExpr(call->Args()[0].get());
+              if (arg_type == "int" || arg_type == "Int") {
+                return "String";
+              }
+              if (arg_type == "float" || arg_type == "Float") {
+                return "String";
+              }
+              // For other types, ToString still returns String
               return "String";
             }
-            if (arg_type == "float" || arg_type == "Float") {
+            if (ns_name == "ToInt" && call->Args().size() == 1) {
+              return "int";
+            }
+            if (ns_name == "ToFloat" && call->Args().size() == 1) {
+              return "float";
+            }
+            if (ns_name == "GetOsName" && call->Args().size() == 0) {
               return "String";
             }
-            // For other types, ToString still returns String
-            return "String";
-          }
-          if (ns_name == "ToInt" && call->Args().size() == 1) {
-            return "int";
-          }
-          if (ns_name == "ToFloat" && call->Args().size() == 1) {
-            return "float";
-          }
-          if (ns_name == "GetOsName" && call->Args().size() == 0) {
-            return "String";
-          }
-          if (ns_name == "ReadLine" && call->Args().size() == 0) {
-            return "String";
-          }
-          if (ns_name == "ReadChar" && call->Args().size() == 0) {
-            return "char";
-          }
-          // Time and Date Operations
-          if (ns_name == "FormatDateTime" && call->Args().size() == 2) {
-            return "String";
-          }
-          if (ns_name == "ParseDateTime" && call->Args().size() == 2) {
-            return "Int";
-          }
-          // File Operations
-          if (ns_name == "FileExists" && call->Args().size() == 1) {
-            return "bool";
-          }
-          if (ns_name == "DirectoryExists" && call->Args().size() == 1) {
-            return "bool";
-          }
-          if (ns_name == "CreateDirectory" && call->Args().size() == 1) {
-            return "bool";
-          }
-          if (ns_name == "DeleteFile" && call->Args().size() == 1) {
-            return "bool";
-          }
-          if (ns_name == "DeleteDirectory" && call->Args().size() == 1) {
-            return "bool";
-          }
-          if (ns_name == "MoveFile" && call->Args().size() == 2) {
-            return "bool";
-          }
-          if (ns_name == "CopyFile" && call->Args().size() == 2) {
-            return "bool";
-          }
-          if (ns_name == "ListDirectory" && call->Args().size() == 1) {
-            return "StringArray";
-          }
-          if (ns_name == "GetCurrentDirectory" && call->Args().size() == 0) {
-            return "String";
-          }
-          if (ns_name == "ChangeDirectory" && call->Args().size() == 1) {
-            return "bool";
-          }
-          // Process Control
-          if (ns_name == "Sleep" && call->Args().size() == 1) {
-            return "Void";
-          }
-          if (ns_name == "SleepMs" && call->Args().size() == 1) {
-            return "Void";
-          }
-          if (ns_name == "SleepNs" && call->Args().size() == 1) {
-            return "Void";
-          }
-          if (ns_name == "Exit" && call->Args().size() == 1) {
-            return "Never";
-          }
-          if (ns_name == "GetEnvironmentVar" && call->Args().size() == 1) {
-            return "String?"; // Returns Nullable<String>
-          }
-          if (ns_name == "SetEnvironmentVar" && call->Args().size() == 2) {
-            return "bool";
-          }
-          // Random Number Generation
-          if (ns_name == "SeedRandom" && call->Args().size() == 1) {
-            return "Void";
-          }
-          // System Information
-          if (ns_name == "GetOsVersion" && call->Args().size() == 0) {
-            return "String";
-          }
-          if (ns_name == "GetArchitecture" && call->Args().size() == 0) {
-            return "String";
-          }
-          if (ns_name == "GetUserName" && call->Args().size() == 0) {
-            return "String";
-          }
-          if (ns_name == "GetHomeDirectory" && call->Args().size() == 0) {
-            return "String";
-          }
-          // Memory and Performance
-          if (ns_name == "ForceGarbageCollection" && call->Args().size() == 0) {
-            return "Void";
-          }
-          // FFI
-          if (ns_name == "Interop" && call->Args().size() == 4) {
-            return "int";
-          }
-          // I/O functions that return Void
-          if (ns_name == "Print" && call->Args().size() == 1) {
-            return "Void";
-          }
-          if (ns_name == "PrintLine" && call->Args().size() == 1) {
-            return "Void";
+            if (ns_name == "ReadLine" && call->Args().size() == 0) {
+              return "String";
+            }
+            if (ns_name == "ReadChar" && call->Args().size() == 0) {
+              return "char";
+            }
+            // Time and Date Operations
+            if (ns_name == "FormatDateTime" && call->Args().size() == 2) {
+              return "String";
+            }
+            if (ns_name == "ParseDateTime" && call->Args().size() == 2) {
+              return "Int";
+            }
+            // File Operations
+            if (ns_name == "FileExists" && call->Args().size() == 1) {
+              return "bool";
+            }
+            if (ns_name == "DirectoryExists" && call->Args().size() == 1) {
+              return "bool";
+            }
+            if (ns_name == "CreateDirectory" && call->Args().size() == 1) {
+              return "bool";
+            }
+            if (ns_name == "DeleteFile" && call->Args().size() == 1) {
+              return "bool";
+            }
+            if (ns_name == "DeleteDirectory" && call->Args().size() == 1) {
+              return "bool";
+            }
+            if (ns_name == "MoveFile" && call->Args().size() == 2) {
+              return "bool";
+            }
+            if (ns_name == "CopyFile" && call->Args().size() == 2) {
+              return "bool";
+            }
+            if (ns_name == "ListDirectory" && call->Args().size() == 1) {
+              return "StringArray";
+            }
+            if (ns_name == "GetCurrentDirectory" && call->Args().size() == 0) {
+              return "String";
+            }
+            if (ns_name == "ChangeDirectory" && call->Args().size() == 1) {
+              return "bool";
+            }
+            // Process Control
+            if (ns_name == "Sleep" && call->Args().size() == 1) {
+              return "Void";
+            }
+            if (ns_name == "SleepMs" && call->Args().size() == 1) {
+              return "Void";
+            }
+            if (ns_name == "SleepNs" && call->Args().size() == 1) {
+              return "Void";
+            }
+            if (ns_name == "Exit" && call->Args().size() == 1) {
+              return "Never";
+            }
+            if (ns_name == "GetEnvironmentVar" && call->Args().size() == 1) {
+              return "String?"; // Returns Nullable<String>
+            }
+            if (ns_name == "SetEnvironmentVar" && call->Args().size() == 2) {
+              return "bool";
+            }
+            // Random Number Generation
+            if (ns_name == "SeedRandom" && call->Args().size() == 1) {
+              return "Void";
+            }
+            // System Information
+            if (ns_name == "GetOsVersion" && call->Args().size() == 0) {
+              return "String";
+            }
+            if (ns_name == "GetArchitecture" && call->Args().size() == 0) {
+              return "String";
+            }
+            if (ns_name == "GetUserName" && call->Args().size() == 0) {
+              return "String";
+            }
+            if (ns_name == "GetHomeDirectory" && call->Args().size() == 0) {
+              return "String";
+            }
+            // Memory and Performance
+            if (ns_name == "ForceGarbageCollection" && call->Args().size() == 0) {
+              return "Void";
+            }
+            // FFI
+            if (ns_name == "Interop" && call->Args().size() == 4) {
+              return "int";
+            }
+            // I/O functions that return Void
+            if (ns_name == "Print" && call->Args().size() == 1) {
+              return "Void";
+            }
+            if (ns_name == "PrintLine" && call->Args().size() == 1) {
+              return "Void";
+            }
           }
         }
       }
-    }
 
-    // Handle method calls on builtin types (e.g., array.Length(), array.GetAt(0))
-    if (auto* field_access = dynamic_cast<FieldAccess*>(&call->MutableCallee())) {
-      std::string method_name = field_access->Name();
-      std::string object_type = GetTypeNameForExpr(&field_access->MutableObject());
+      // Handle method calls on builtin types (e.g., array.Length(), array.GetAt(0))
+      if (auto* field_access = DynCast<FieldAccess>(&call->MutableCallee())) {
+        std::string method_name = field_access->Name();
+        std::string object_type = GetTypeNameForExpr(&field_access->MutableObject());
 
-      if (!object_type.empty() && kBuiltinTypeNames.contains(object_type)) {
-        // Handle array methods
-        if (object_type.find("Array") != std::string::npos) {
-          if (method_name == "Length" || method_name == "Capacity") {
-            return "int";
+        if (!object_type.empty() && kBuiltinTypeNames.contains(object_type)) {
+          // Handle array methods
+          if (object_type.find("Array") != std::string::npos) {
+            if (method_name == "Length" || method_name == "Capacity") {
+              return "int";
+            }
+            if (method_name == "GetAt") {
+              return GetElementTypeForArray(object_type);
+            }
+            if (method_name == "ToString") {
+              return "String";
+            }
+            if (method_name == "GetHash") {
+              return "int";
+            }
+            if (method_name == "Equals") {
+              return "bool";
+            }
+            if (method_name == "IsLess") {
+              return "bool";
+            }
+            if (method_name == "Add" || method_name == "RemoveAt" || method_name == "InsertAt" ||
+                method_name == "SetAt" || method_name == "Clear" || method_name == "Reserve" ||
+                method_name == "ShrinkToFit") {
+              return "void";
+            }
           }
-          if (method_name == "GetAt") {
-            return GetElementTypeForArray(object_type);
+          // Handle String methods
+          if (object_type == "String") {
+            if (method_name == "Length") {
+              return "int";
+            }
+            if (method_name == "Substring") {
+              return "String";
+            }
+            if (method_name == "Compare") {
+              return "int";
+            }
+            if (method_name == "ToUtf8Bytes") {
+              return "ByteArray";
+            }
+            if (method_name == "Equals") {
+              return "bool";
+            }
+            if (method_name == "IsLess") {
+              return "bool";
+            }
           }
+          // Handle wrapper type methods (Int, Float, etc.)
           if (method_name == "ToString") {
             return "String";
           }
@@ -3082,114 +3154,79 @@ std::string BytecodeVisitor::GetTypeNameForExpr(Expr* expr) {
           if (method_name == "IsLess") {
             return "bool";
           }
-          if (method_name == "Add" || method_name == "RemoveAt" || method_name == "InsertAt" ||
-              method_name == "SetAt" || method_name == "Clear" || method_name == "Reserve" ||
-              method_name == "ShrinkToFit") {
-            return "void";
-          }
-        }
-        // Handle String methods
-        if (object_type == "String") {
-          if (method_name == "Length") {
-            return "int";
-          }
-          if (method_name == "Substring") {
-            return "String";
-          }
-          if (method_name == "Compare") {
-            return "int";
-          }
-          if (method_name == "ToUtf8Bytes") {
-            return "ByteArray";
-          }
-          if (method_name == "Equals") {
-            return "bool";
-          }
-          if (method_name == "IsLess") {
-            return "bool";
-          }
-        }
-        // Handle wrapper type methods (Int, Float, etc.)
-        if (method_name == "ToString") {
-          return "String";
-        }
-        if (method_name == "GetHash") {
-          return "int";
-        }
-        if (method_name == "Equals") {
-          return "bool";
-        }
-        if (method_name == "IsLess") {
-          return "bool";
-        }
-        // Handle File methods
-        if (object_type == "File") {
-          if (method_name == "Open" || method_name == "Close" || method_name == "WriteLine" || method_name == "Seek") {
-            return "void";
-          }
-          if (method_name == "IsOpen" || method_name == "Eof") {
-            return "bool";
-          }
-          if (method_name == "Read") {
-            return "ByteArray";
-          }
-          if (method_name == "ReadLine") {
-            return "String";
-          }
-          if (method_name == "Tell" || method_name == "Write") {
-            return "int";
+          // Handle File methods
+          if (object_type == "File") {
+            if (method_name == "Open" || method_name == "Close" || method_name == "WriteLine" ||
+                method_name == "Seek") {
+              return "void";
+            }
+            if (method_name == "IsOpen" || method_name == "Eof") {
+              return "bool";
+            }
+            if (method_name == "Read") {
+              return "ByteArray";
+            }
+            if (method_name == "ReadLine") {
+              return "String";
+            }
+            if (method_name == "Tell" || method_name == "Write") {
+              return "int";
+            }
           }
         }
-      }
 
-      // Handle method calls on user-defined types
-      // Check method_return_types_ for the return type of this method
-      if (!object_type.empty() && !kBuiltinTypeNames.contains(object_type)) {
-        std::string method_key = object_type + "::" + method_name;
-        if (const auto it = method_return_types_.find(method_key); it != method_return_types_.end()) {
-          return it->second;
+        // Handle method calls on user-defined types
+        // Check method_return_types_ for the return type of this method
+        if (!object_type.empty() && !kBuiltinTypeNames.contains(object_type)) {
+          std::string method_key = object_type + "::" + method_name;
+          if (const auto it = method_return_types_.find(method_key); it != method_return_types_.end()) {
+            return it->second;
+          }
         }
-      }
 
-      // Handle chained method calls: if object_type is "unknown", it might be a Call expression
-      // Try to determine the return type of the nested call to use as object_type
-      if (object_type == "unknown" || object_type.empty()) {
-        if (auto* nested_call = dynamic_cast<Call*>(&field_access->MutableObject())) {
-          // Get the return type of the nested call by examining its structure
-          if (auto* nested_field_access = dynamic_cast<FieldAccess*>(&nested_call->MutableCallee())) {
-            std::string nested_method_name = nested_field_access->Name();
-            std::string nested_object_type = GetTypeNameForExpr(&nested_field_access->MutableObject());
+        // Handle chained method calls: if object_type is "unknown", it might be a Call expression
+        // Try to determine the return type of the nested call to use as object_type
+        if (object_type == "unknown" || object_type.empty()) {
+          if (auto* nested_call = DynCast<Call>(&field_access->MutableObject())) {
+            // Get the return type of the nested call by examining its structure
+            if (auto* nested_field_access = DynCast<FieldAccess>(&nested_call->MutableCallee())) {
+              std::string nested_method_name = nested_field_access->Name();
+              std::string nested_object_type = GetTypeNameForExpr(&nested_field_access->MutableObject());
 
-            // Check if this is a method call on a user-defined type
-            if (!nested_object_type.empty() && !kBuiltinTypeNames.contains(nested_object_type)) {
-              std::string nested_method_key = nested_object_type + "::" + nested_method_name;
-              if (const auto nested_it = method_return_types_.find(nested_method_key);
-                  nested_it != method_return_types_.end()) {
-                // Use the return type of the nested call as the object type for this call
-                std::string return_type = nested_it->second;
-                std::string chained_method_key = return_type + "::" + method_name;
-                if (const auto chained_it = method_return_types_.find(chained_method_key);
-                    chained_it != method_return_types_.end()) {
-                  return chained_it->second;
+              // Check if this is a method call on a user-defined type
+              if (!nested_object_type.empty() && !kBuiltinTypeNames.contains(nested_object_type)) {
+                std::string nested_method_key = nested_object_type + "::" + nested_method_name;
+                if (const auto nested_it = method_return_types_.find(nested_method_key);
+                    nested_it != method_return_types_.end()) {
+                  // Use the return type of the nested call as the object type for this call
+                  std::string return_type = nested_it->second;
+                  std::string chained_method_key = return_type + "::" + method_name;
+                  if (const auto chained_it = method_return_types_.find(chained_method_key);
+                      chained_it != method_return_types_.end()) {
+                    return chained_it->second;
+                  }
+                  // If the chained method doesn't exist, at least return the return type of the nested call
+                  // This helps with type propagation in chained calls
+                  return return_type;
                 }
-                // If the chained method doesn't exist, at least return the return type of the nested call
-                // This helps with type propagation in chained calls
-                return return_type;
               }
             }
           }
         }
       }
+      break;
     }
-  }
-
-  if (const auto* cast = dynamic_cast<CastAs*>(expr)) {
-    return TypeToMangledName(cast->Type());
+    case NodeKind::kCastAs: {
+      const auto* cast = Cast<CastAs>(expr);
+      return TypeToMangledName(cast->Type());
+    }
+    default:
+      break;
   }
 
   // For Call expressions, if we couldn't determine the type, return "unknown"
   // to avoid infinite recursion (GetOperandTypeName -> DetermineOperandType -> GetTypeNameForExpr)
-  if (dynamic_cast<Call*>(expr) != nullptr) {
+  if (Isa<Call>(expr)) {
     return "unknown";
   }
 
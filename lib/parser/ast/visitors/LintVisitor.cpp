@@ -2,6 +2,7 @@
 
 #include <vector>
 
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
 #include "lib/parser/diagnostics/severity/Severity.hpp"
 
 #include "lib/parser/ast/nodes/class_members/CallDecl.hpp"
@@ -61,19 +62,14 @@ void LintVisitor::CheckNestingDepth(const SourceSpan& source) const {
 }
 
 bool LintVisitor::IsPureExpr(Expr& expression) {
-  if (dynamic_cast<Assign*>(&expression)) {
-    return false;
+  switch (expression.Kind()) {
+    case NodeKind::kAssign:
+    case NodeKind::kCall:
+    case NodeKind::kSafeCall:
+      return false;
+    default:
+      return true;
   }
-
-  if (dynamic_cast<Call*>(&expression)) {
-    return false;
-  }
-
-  if (dynamic_cast<SafeCall*>(&expression)) {
-    return false;
-  }
-
-  return true;
 }
 
 void LintVisitor::Visit(Module& node) {
@@ -159,8 +155,7 @@ void LintVisitor::Visit(Block& node) {
         continue;
       }
 
-      if (dynamic_cast<ReturnStmt*>(stmt.get()) || dynamic_cast<BreakStmt*>(stmt.get()) ||
-          dynamic_cast<ContinueStmt*>(stmt.get())) {
+      if (Isa<ReturnStmt>(stmt.get()) || Isa<BreakStmt>(stmt.get()) || Isa<ContinueStmt>(stmt.get())) {
         terminated = true;
       }
     }
@@ -244,7 +239,7 @@ void LintVisitor::Visit(WhileStmt& node) {
 
   if (opts_.warn_while_true) {
     if (auto* cond = node.MutableCondition()) {
-      if (const auto* bl = dynamic_cast<BoolLit*>(cond)) {
+      if (const auto* bl = DynCast<BoolLit>(cond)) {
         if (bl->Value()) {
           sink_.Warn("W0601", "while(true) loop", node.Span());
         }
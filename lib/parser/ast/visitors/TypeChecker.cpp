@@ -6,6 +6,7 @@
 
 #include <sstream>
 
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
 #include "lib/parser/ast/nodes/class_members/CallDecl.hpp"
 #include "lib/parser/ast/nodes/class_members/FieldDecl.hpp"
 #include "lib/parser/ast/nodes/class_members/MethodDecl.hpp"
@@ -177,116 +178,136 @@ void TypeChecker::Visit(Module& node) {
   InitializeBuiltinMethods();
 
   for (auto& decl : node.MutableDecls()) {
-    if (auto* f = dynamic_cast<FunctionDecl*>(decl.get())) {
-      FunctionSignature sig;
-      sig.name = f->Name();
-      for (const auto& param : f->Params()) {
-        sig.param_types.emplace_back(param.GetType());
-      }
-      if (f->ReturnType() != nullptr) {
-        sig.return_type = std::make_unique<TypeReference>(*f->ReturnType());
-      }
-      functions_[f->Name()] = std::move(sig);
-
-      // Also register in function_overloads_
-      FunctionOverload overload;
-      for (const auto& param : f->Params()) {
-        overload.param_types.push_back(param.GetType());
-      }
-      if (f->ReturnType() != nullptr) {
-        overload.return_type = std::make_unique<TypeReference>(*f->ReturnType());
-      }
-      function_overloads_[f->Name()].push_back(std::move(overload));
-    }
-
-    if (auto* c = dynamic_cast<ClassDecl*>(decl.get())) {
-      std::string class_name = c->Name();
-      std::vector<std::pair<std::string, TypeReference>> fields;
+    switch (decl->Kind()) {
+      case NodeKind::kFunctionDecl: {
+        auto* f = Cast<FunctionDecl>(decl.get());
+        FunctionSignature sig;
+        sig.name = f->Name();
+        for (const auto& param : f->Params()) {
+          sig.param_types.emplace_back(param.GetType());
+        }
+        if (f->ReturnType() != nullptr) {
+          sig.return_type = std::make_unique<TypeReference>(*f->ReturnType());
+        }
+        functions_[f->Name()] = std::move(sig);
 
-      // Register interfaces that this class implements
-      std::vector<std::string> interface_names;
-      for (const auto& impl : c->Implements()) {
-        if (!impl.QualifiedName().empty()) {
-          interface_names.emplace_back(impl.SimpleName());
+        // Also register in function_overloads_
+        FunctionOverload overload;
+        for (const auto& param : f->Params()) {
+          overload.param_types.push_back(param.GetType());
         }
+        if (f->ReturnType() != nullptr) {
+          overload.return_type = std::make_unique<TypeReference>(*f->ReturnType());
+        }
+        function_overloads_[f->Name()].push_back(std::move(overload));
+        break;
       }
-      if (!interface_names.empty()) {
-        class_implements_[class_name] = interface_names;
-      }
-
-      for (auto& m : c->MutableMembers()) {
-        if (const auto* fd = dynamic_cast<FieldDecl*>(m.get())) {
-          fields.emplace_back(fd->Name(), fd->Type());
+      case NodeKind::kClassDecl: {
+        auto* c = Cast<ClassDecl>(decl.get());
+        std::string class_name = c->Name();
+        std::vector<std::pair<std::string, TypeReference>> fields;
+
+        // Register interfaces that this class implements
+        std::vector<std::string> interface_names;
+        for (const auto& impl : c->Implements()) {
+          if (!impl.QualifiedName().empty()) {
+            interface_names.emplace_back(impl.SimpleName());
+          }
         }
-        if (const auto* md = dynamic_cast<MethodDecl*>(m.get())) {
-          if (md->Name() == class_name) {
-            // This is a constructor (method with same name as class)
-            MethodSignature sig;
-            sig.class_name = class_name;
-            sig.method_name = class_name;
-            for (const auto& param : md->Params()) {
-              sig.param_types.push_back(param.GetType());
-            }
-            if (md->ReturnType() != nullptr) {
-              sig.return_type = std::make_unique<TypeReference>(*md->ReturnType());
+        if (!interface_names.empty()) {
+          class_implements_[class_name] = interface_names;
+        }
+
+        for (auto& m : c->MutableMembers()) {
+          switch (m->Kind()) {
+            case NodeKind::kFieldDecl: {
+              const auto* fd = Cast<FieldDecl>(m.get());
+              fields.emplace_back(fd->Name(), fd->Type());
+              break;
             }
-            constructors_[class_name] = std::move(sig);
-          } else {
-            MethodSignature sig;
-            sig.class_name = class_name;
-            sig.method_name = md->Name();
-            for (const auto& param : md->Params()) {
-              sig.param_types.push_back(param.GetType());
+            case NodeKind::kMethodDecl: {
+              const auto* md = Cast<MethodDecl>(m.get());
+              if (md->Name() == class_name) {
+                // This is a constructor (method with same name as class)
+                MethodSignature sig;
+                sig.class_name = class_name;
+                sig.method_name = class_name;
+                for (const auto& param : md->Params()) {
+                  sig.param_types.push_back(param.GetType());
+                }
+                if (md->ReturnType() != nullptr) {
+                  sig.return_type = std::make_unique<TypeReference>(*md->ReturnType());
+                }
+                constructors_[class_name] = std::move(sig);
+              } else {
+                MethodSignature sig;
+                sig.class_name = class_name;
+                sig.method_name = md->Name();
+                for (const auto& param : md->Params()) {
+                  sig.param_types.push_back(param.GetType());
+                }
+                if (md->ReturnType() != nullptr) {
+                  sig.return_type = std::make_unique<TypeReference>(*md->ReturnType());
+                }
+                methods_[class_name + "::" + md->Name()] = std::move(sig);
+              }
+              break;
             }
-            if (md->ReturnType() != nullptr) {
-              sig.return_type = std::make_unique<TypeReference>(*md->ReturnType());
+            case NodeKind::kCallDecl: {
+              const auto* cd = Cast<CallDecl>(m.get());
+              // CallDecl is always a constructor
+              MethodSignature sig;
+              sig.class_name = class_name;
+              sig.method_name = class_name;
+              for (const auto& param : cd->Params()) {
+                sig.param_types.push_back(param.GetType());
+              }
+              if (cd->ReturnType() != nullptr) {
+                sig.return_type = std::make_unique<TypeReference>(*cd->ReturnType());
+              }
+              constructors_[class_name] = std::move(sig);
+              break;
             }
-            methods_[class_name + "::" + md->Name()] = std::move(sig);
+            default:
+              break;
           }
         }
-        if (const auto* cd = dynamic_cast<CallDecl*>(m.get())) {
-          // CallDecl is always a constructor
-          MethodSignature sig;
-          sig.class_name = class_name;
-          sig.method_name = class_name;
-          for (const auto& param : cd->Params()) {
-            sig.param_types.push_back(param.GetType());
-          }
-          if (cd->ReturnType() != nullptr) {
-            sig.return_type = std::make_unique<TypeReference>(*cd->ReturnType());
-          }
-          constructors_[class_name] = std::move(sig);
-        }
+        class_fields_[class_name] = std::move(fields);
+        break;
       }
-      class_fields_[class_name] = std::move(fields);
-    }
-
-    if (auto* ta = dynamic_cast<TypeAliasDecl*>(decl.get())) {
-      type_aliases_[ta->Name()] = ta->AliasedType();
-    }
-
-    if (auto* gv = dynamic_cast<GlobalVarDecl*>(decl.get())) {
-      global_variables_[gv->Name()] = gv->Type();
-    }
-
-    if (auto* i = dynamic_cast<InterfaceDecl*>(decl.get())) {
-      InterfaceSignature interface_sig;
-      interface_sig.interface_name = i->Name();
-      for (auto& m : i->MutableMembers()) {
-        if (const auto* im = dynamic_cast<InterfaceMethod*>(m.get())) {
-          MethodSignature sig;
-          sig.class_name = i->Name();
-          sig.method_name = im->Name();
-          for (const auto& param : im->Params()) {
-            sig.param_types.push_back(param.GetType());
-          }
-          if (im->ReturnType() != nullptr) {
-            sig.return_type = std::make_unique<TypeReference>(*im->ReturnType());
+      case NodeKind::kTypeAliasDecl: {
+        auto* ta = Cast<TypeAliasDecl>(decl.get());
+        type_aliases_[ta->Name()] = ta->AliasedType();
+        break;
+      }
+      case NodeKind::kGlobalVarDecl: {
+        auto* gv = Cast<GlobalVarDecl>(decl.get());
+        global_variables_[gv->Name()] = gv->Type();
+        break;
+      }
+      case NodeKind::kInterfaceDecl: {
+        auto* i = Cast<InterfaceDecl>(decl.get());
+        InterfaceSignature interface_sig;
+        interface_sig.interface_name = i->Name();
+        for (auto& m : i->MutableMembers()) {
+          if (const auto* im = DynCast<InterfaceMethod>(m.get())) {
+            MethodSignature sig;
+            sig.class_name = i->Name();
+            sig.method_name = im->Name();
+            for (const auto& param : im->Params()) {
+              sig.param_types.push_back(param.GetType());
+            }
+            if (im->ReturnType() != nullptr) {
+              sig.return_type = std::make_unique<TypeReference>(*im->ReturnType());
+            }
+            interface_sig.methods[im->Name()] = std::move(sig);
           }
-          interface_sig.methods[im->Name()] = std::move(sig);
         }
+        interfaces_[i->Name()] = std::move(interface_sig);
+        break;
       }
-      interfaces_[i->Name()] = std::move(interface_sig);
+      default:
+        break;
     }
   }
 
@@ -454,7 +475,7 @@ void TypeChecker::Visit(Call& node) {
   InferExpressionType(&node.MutableCallee());
 
   // Handle NamespaceRef (system commands like sys::Print)
-  if (auto* ns_ref = dynamic_cast<NamespaceRef*>(&node.MutableCallee())) {
+  if (auto* ns_ref = DynCast<NamespaceRef>(&node.MutableCallee())) {
     const std::string& func_name = ns_ref->Name();
     // System commands are built-in, don't emit errors for them
     if (kBuiltinSystemCommands.find(func_name) != kBuiltinSystemCommands.end()) {
@@ -468,7 +489,7 @@ void TypeChecker::Visit(Call& node) {
     return;
   }
 
-  if (auto* ident = dynamic_cast<IdentRef*>(&node.MutableCallee())) {
+  if (auto* ident = DynCast<IdentRef>(&node.MutableCallee())) {
     const std::string& func_name = ident->Name();
 
     // Check if it's a built-in type name (used as constructor)
@@ -611,7 +632,7 @@ void TypeChecker::Visit(Call& node) {
         }
       }
     }
-  } else if (auto* field_access = dynamic_cast<FieldAccess*>(&node.MutableCallee())) {
+  } else if (auto* field_access = DynCast<FieldAccess>(&node.MutableCallee())) {
     TypeReference object_type = InferExpressionType(&field_access->MutableObject());
     std::string class_name;
     if (!object_type.QualifiedName().empty()) {
@@ -1191,372 +1212,363 @@ TypeReference TypeChecker::InferExpressionType(Expr* expr) {
     return {};
   }
 
-  // Check IdentRef first (like BytecodeVisitor does)
-  if (auto* ident = dynamic_cast<IdentRef*>(expr)) {
-    if (auto var_it = variable_types_.find(ident->Name()); var_it != variable_types_.end()) {
-      return var_it->second;
-    }
-    if (auto global_it = global_variables_.find(ident->Name()); global_it != global_variables_.end()) {
-      return global_it->second;
-    }
-    return {};
-  }
-
-  // Check FieldAccess
-  if (auto* field_access = dynamic_cast<FieldAccess*>(expr)) {
-    TypeReference object_type = InferExpressionType(&field_access->MutableObject());
-    std::string class_name;
-    if (!object_type.QualifiedName().empty()) {
-      class_name = std::string(object_type.SimpleName());
+  switch (expr->Kind()) {
+    case NodeKind::kIdentRef: {
+      auto* ident = Cast<IdentRef>(expr);
+      if (auto var_it = variable_types_.find(ident->Name()); var_it != variable_types_.end()) {
+        return var_it->second;
+      }
+      if (auto global_it = global_variables_.find(ident->Name()); global_it != global_variables_.end()) {
+        return global_it->second;
+      }
+      return {};
     }
-    if (!class_name.empty()) {
-      if (auto fields_it = class_fields_.find(class_name); fields_it != class_fields_.end()) {
-        for (const auto& [field_name, field_type] : fields_it->second) {
-          if (field_name == field_access->Name()) {
-            return field_type;
+    case NodeKind::kFieldAccess: {
+      auto* field_access = Cast<FieldAccess>(expr);
+      TypeReference object_type = InferExpressionType(&field_access->MutableObject());
+      std::string class_name;
+      if (!object_type.QualifiedName().empty()) {
+        class_name = std::string(object_type.SimpleName());
+      }
+      if (!class_name.empty()) {
+        if (auto fields_it = class_fields_.find(class_name); fields_it != class_fields_.end()) {
+          for (const auto& [field_name, field_type] : fields_it->second) {
+            if (field_name == field_access->Name()) {
+              return field_type;
+            }
           }
         }
       }
+      return {};
     }
-    return {};
-  }
-
-  // Check literals (after IdentRef and FieldAccess, like BytecodeVisitor)
-  if (dynamic_cast<IntLit*>(expr) != nullptr) {
-    return TypeReference("int");
-  }
-  if (dynamic_cast<FloatLit*>(expr) != nullptr) {
-    return TypeReference("float");
-  }
-  if (dynamic_cast<StringLit*>(expr) != nullptr) {
-    return TypeReference("String");
-  }
-  if (dynamic_cast<BoolLit*>(expr) != nullptr) {
-    return TypeReference("bool");
-  }
-  if (dynamic_cast<CharLit*>(expr) != nullptr) {
-    return TypeReference("char");
-  }
-  if (dynamic_cast<ByteLit*>(expr) != nullptr) {
-    return TypeReference("byte");
-  }
-  if (dynamic_cast<NullLit*>(expr) != nullptr) {
-    TypeReference null_type("Object");
-    null_type.MakeNullable();
-    return null_type;
-  }
-
-  if (dynamic_cast<ThisExpr*>(expr)) {
-    if (!current_class_name_.empty()) {
-      return TypeReference(current_class_name_);
+    case NodeKind::kIntLit:
+      return TypeReference("int");
+    case NodeKind::kFloatLit:
+      return TypeReference("float");
+    case NodeKind::kStringLit:
+      return TypeReference("String");
+    case NodeKind::kBoolLit:
+      return TypeReference("bool");
+    case NodeKind::kCharLit:
+      return TypeReference("char");
+    case NodeKind::kByteLit:
+      return TypeReference("byte");
+    case NodeKind::kNullLit: {
+      TypeReference null_type("Object");
+      null_type.MakeNullable();
+      return null_type;
     }
-    return {};
-  }
-
-  if (auto* call = dynamic_cast<Call*>(expr)) {
-    // Handle NamespaceRef (sys:: functions)
-    if (auto* ns_ref = dynamic_cast<NamespaceRef*>(&call->MutableCallee())) {
-      std::string ns_name = ns_ref->Name();
-      // Check if namespace is "sys" by examining NamespaceExpr
-      if (const auto* ns_ident = dynamic_cast<IdentRef*>(&ns_ref->MutableNamespaceExpr())) {
-        if (ns_ident->Name() == "sys") {
-          // Handle GetEnvironmentVar - returns Nullable<String>
-          if (ns_name == "GetEnvironmentVar" && call->Args().size() == 1) {
-            TypeReference result("String");
-            result.MakeNullable();
-            return result;
-          }
-          // Check for built-in return types
-          if (const auto it = kBuiltinReturnTypes.find(ns_name); it != kBuiltinReturnTypes.end()) {
-            std::string return_type_name = it->second;
-            // Handle Void return type
-            if (return_type_name == "Void") {
-              return {}; // Empty TypeReference for void
+    case NodeKind::kThisExpr: {
+      if (!current_class_name_.empty()) {
+        return TypeReference(current_class_name_);
+      }
+      return {};
+    }
+    case NodeKind::kCall: {
+      auto* call = Cast<Call>(expr);
+      // Handle NamespaceRef (sys:: functions)
+      if (auto* ns_ref = DynCast<NamespaceRef>(&call->MutableCallee())) {
+        std::string ns_name = ns_ref->Name();
+        // Check if namespace is "sys" by examining NamespaceExpr
+        if (const auto* ns_ident = DynCast<IdentRef>(&ns_ref->MutableNamespaceExpr())) {
+          if (ns_ident->Name() == "sys") {
+            // Handle GetEnvironmentVar - returns Nullable<String>
+            if (ns_name == "GetEnvironmentVar" && call->Args().size() == 1) {
+              TypeReference result("String");
+              result.MakeNullable();
+              return result;
             }
-            return TypeReference(return_type_name);
-          }
-          // Handle special cases with argument checks
-          if (ns_name == "Sqrt" && call->Args().size() == 1) {
-            return TypeReference("float");
-          }
-          if (ns_name == "ToString" && call->Args().size() == 1) {
-            return TypeReference("String");
-          }
-          if (ns_name == "ToInt" && call->Args().size() == 1) {
-            return TypeReference("int");
-          }
-          if (ns_name == "ToFloat" && call->Args().size() == 1) {
-            return TypeReference("float");
+            // Check for built-in return types
+            if (const auto it = kBuiltinReturnTypes.find(ns_name); it != kBuiltinReturnTypes.end()) {
+              std::string return_type_name = it->second;
+              // Handle Void return type
+              if (return_type_name == "Void") {
+                return {}; // Empty TypeReference for void
+              }
+              return TypeReference(return_type_name);
+            }
+            // Handle special cases with argument checks
+            if (ns_name == "Sqrt" && call->Args().size() == 1) {
+              return TypeReference("float");
+            }
+            if (ns_name == "ToString" && call->Args().size() == 1) {
+              return TypeReference("String");
+            }
+            if (ns_name == "ToInt" && call->Args().size() == 1) {
+              return TypeReference("int");
+            }
+            if (ns_name == "ToFloat" && call->Args().size() == 1) {
+              return TypeReference("float");
+            }
+            // Default: system commands that don't return values return Void (empty)
+            return {};
           }
-          // Default: system commands that don't return values return Void (empty)
-          return {};
         }
+        // For non-sys namespace calls, return empty (unknown)
+        return {};
       }
-      // For non-sys namespace calls, return empty (unknown)
-      return {};
-    }
-
-    if (auto* ident = dynamic_cast<IdentRef*>(&call->MutableCallee())) {
-      const std::string& func_name = ident->Name();
 
-      // Check if it's a built-in type name (used as constructor)
-      if (kBuiltinTypeNames.find(func_name) != kBuiltinTypeNames.end()) {
-        // Return the type name (e.g., Int, Float, String, etc.)
-        return TypeReference(func_name);
-      }
+      if (auto* ident = DynCast<IdentRef>(&call->MutableCallee())) {
+        const std::string& func_name = ident->Name();
 
-      // Check if it's a built-in array type constructor
-      if (func_name == "IntArray") {
-        return TypeReference("IntArray");
-      }
-      if (func_name == "FloatArray") {
-        return TypeReference("FloatArray");
-      }
-      if (func_name == "StringArray") {
-        return TypeReference("StringArray");
-      }
-      if (func_name == "BoolArray") {
-        return TypeReference("BoolArray");
-      }
-      if (func_name == "ByteArray") {
-        return TypeReference("ByteArray");
-      }
-      if (func_name == "CharArray") {
-        return TypeReference("CharArray");
-      }
-      if (func_name == "ObjectArray") {
-        return TypeReference("ObjectArray");
-      }
+        // Check if it's a built-in type name (used as constructor)
+        if (kBuiltinTypeNames.find(func_name) != kBuiltinTypeNames.end()) {
+          // Return the type name (e.g., Int, Float, String, etc.)
+          return TypeReference(func_name);
+        }
 
-      if (auto func_it = functions_.find(func_name); func_it != functions_.end()) {
-        if (func_it->second.return_type) {
-          return *func_it->second.return_type;
+        // Check if it's a built-in array type constructor
+        if (func_name == "IntArray") {
+          return TypeReference("IntArray");
+        }
+        if (func_name == "FloatArray") {
+          return TypeReference("FloatArray");
+        }
+        if (func_name == "StringArray") {
+          return TypeReference("StringArray");
+        }
+        if (func_name == "BoolArray") {
+          return TypeReference("BoolArray");
+        }
+        if (func_name == "ByteArray") {
+          return TypeReference("ByteArray");
+        }
+        if (func_name == "CharArray") {
+          return TypeReference("CharArray");
+        }
+        if (func_name == "ObjectArray") {
+          return TypeReference("ObjectArray");
         }
-      }
 
-      // Check if it's a class constructor
-      if (class_fields_.find(func_name) != class_fields_.end()) {
-        return TypeReference(func_name);
-      }
-    } else if (auto* field_access = dynamic_cast<FieldAccess*>(&call->MutableCallee())) {
-      TypeReference object_type = InferExpressionType(&field_access->MutableObject());
-      std::string class_name;
-      if (!object_type.QualifiedName().empty()) {
-        class_name = std::string(object_type.SimpleName());
-      }
-      if (!class_name.empty()) {
-        // Check builtin methods first
-        const BuiltinMethodSignature* builtin_sig = FindBuiltinMethod(class_name, field_access->Name());
-        if (builtin_sig != nullptr && builtin_sig->return_type != nullptr) {
-          return *builtin_sig->return_type;
+        if (auto func_it = functions_.find(func_name); func_it != functions_.end()) {
+          if (func_it->second.return_type) {
+            return *func_it->second.return_type;
+          }
         }
 
-        // Then check user-defined methods
-        std::string method_key = class_name + "::" + field_access->Name();
-        if (auto method_it = methods_.find(method_key); method_it != methods_.end()) {
-          if (method_it->second.return_type) {
-            return *method_it->second.return_type;
+        // Check if it's a class constructor
+        if (class_fields_.find(func_name) != class_fields_.end()) {
+          return TypeReference(func_name);
+        }
+      } else if (auto* field_access = DynCast<FieldAccess>(&call->MutableCallee())) {
+        TypeReference object_type = InferExpressionType(&field_access->MutableObject());
+        std::string class_name;
+        if (!object_type.QualifiedName().empty()) {
+          class_name = std::string(object_type.SimpleName());
+        }
+        if (!class_name.empty()) {
+          // Check builtin methods first
+          const BuiltinMethodSignature* builtin_sig = FindBuiltinMethod(class_name, field_access->Name());
+          if (builtin_sig != nullptr && builtin_sig->return_type != nullptr) {
+            return *builtin_sig->return_type;
           }
-        } else if (auto interface_it = interfaces_.find(class_name); interface_it != interfaces_.end()) {
-          const auto& interface_sig = interface_it->second;
-          if (auto interface_method_it = interface_sig.methods.find(field_access->Name());
-              interface_method_it != interface_sig.methods.end()) {
-            if (interface_method_it->second.return_type) {
-              return *interface_method_it->second.return_type;
+
+          // Then check user-defined methods
+          std::string method_key = class_name + "::" + field_access->Name();
+          if (auto method_it = methods_.find(method_key); method_it != methods_.end()) {
+            if (method_it->second.return_type) {
+              return *method_it->second.return_type;
+            }
+          } else if (auto interface_it = interfaces_.find(class_name); interface_it != interfaces_.end()) {
+            const auto& interface_sig = interface_it->second;
+            if (auto interface_method_it = interface_sig.methods.find(field_access->Name());
+                interface_method_it != interface_sig.methods.end()) {
+              if (interface_method_it->second.return_type) {
+                return *interface_method_it->second.return_type;
+              }
             }
           }
-        }
-        // Check Object interface for class types
-        if (IsClassType(class_name)) {
-          if (auto object_it = interfaces_.find("Object"); object_it != interfaces_.end()) {
-            const auto& object_sig = object_it->second;
-            if (auto object_method_it = object_sig.methods.find(field_access->Name());
-                object_method_it != object_sig.methods.end()) {
-              if (object_method_it->second.return_type) {
-                return *object_method_it->second.return_type;
+          // Check Object interface for class types
+          if (IsClassType(class_name)) {
+            if (auto object_it = interfaces_.find("Object"); object_it != interfaces_.end()) {
+              const auto& object_sig = object_it->second;
+              if (auto object_method_it = object_sig.methods.find(field_access->Name());
+                  object_method_it != object_sig.methods.end()) {
+                if (object_method_it->second.return_type) {
+                  return *object_method_it->second.return_type;
+                }
               }
             }
           }
-        }
-        // Check explicitly implemented interfaces (including IComparable, IHashable, IStringConvertible)
-        if (class_implements_.find(class_name) != class_implements_.end()) {
-          const auto& impls = class_implements_[class_name];
-          for (const auto& impl_name : impls) {
-            if (auto interface_it = interfaces_.find(impl_name); interface_it != interfaces_.end()) {
-              const auto& interface_sig = interface_it->second;
-              if (auto interface_method_it = interface_sig.methods.find(field_access->Name());
-                  interface_method_it != interface_sig.methods.end()) {
-                if (interface_method_it->second.return_type) {
-                  return *interface_method_it->second.return_type;
+          // Check explicitly implemented interfaces (including IComparable, IHashable, IStringConvertible)
+          if (class_implements_.find(class_name) != class_implements_.end()) {
+            const auto& impls = class_implements_[class_name];
+            for (const auto& impl_name : impls) {
+              if (auto interface_it = interfaces_.find(impl_name); interface_it != interfaces_.end()) {
+                const auto& interface_sig = interface_it->second;
+                if (auto interface_method_it = interface_sig.methods.find(field_access->Name());
+                    interface_method_it != interface_sig.methods.end()) {
+                  if (interface_method_it->second.return_type) {
+                    return *interface_method_it->second.return_type;
+                  }
                 }
               }
             }
           }
         }
       }
+      return {};
     }
-    return {};
-  }
-
-  if (auto* index_access = dynamic_cast<IndexAccess*>(expr)) {
-    TypeReference object_type = InferExpressionType(&index_access->MutableObject());
-
-    // If we couldn't get the type from InferExpressionType, try getting it directly from IdentRef
-    if (object_type.QualifiedName().empty()) {
-      if (auto* ident = dynamic_cast<IdentRef*>(&index_access->MutableObject())) {
-        if (auto var_it = variable_types_.find(ident->Name()); var_it != variable_types_.end()) {
-          object_type = var_it->second;
-        } else if (auto global_it = global_variables_.find(ident->Name()); global_it != global_variables_.end()) {
-          object_type = global_it->second;
+    case NodeKind::kIndexAccess: {
+      auto* index_access = Cast<IndexAccess>(expr);
+      TypeReference object_type = InferExpressionType(&index_access->MutableObject());
+
+      // If we couldn't get the type from InferExpressionType, try getting it directly from IdentRef
+      if (object_type.QualifiedName().empty()) {
+        if (auto* ident = DynCast<IdentRef>(&index_access->MutableObject())) {
+          if (auto var_it = variable_types_.find(ident->Name()); var_it != variable_types_.end()) {
+            object_type = var_it->second;
+          } else if (auto global_it = global_variables_.find(ident->Name()); global_it != global_variables_.end()) {
+            object_type = global_it->second;
+          }
         }
       }
-    }
 
-    // Get element type for array types
-    return GetElementTypeForArray(object_type);
-  }
-
-  if (auto* safe_call = dynamic_cast<SafeCall*>(expr)) {
-    TypeReference object_type = InferExpressionType(&safe_call->MutableObject());
-    std::string class_name;
-    if (!object_type.QualifiedName().empty()) {
-      class_name = std::string(object_type.SimpleName());
+      // Get element type for array types
+      return GetElementTypeForArray(object_type);
     }
-    if (!class_name.empty()) {
-      // Remove nullable to check for methods
-      TypeReference non_nullable_type = object_type.IsNullable() ? object_type.WithoutNullable() : object_type;
-      std::string non_nullable_class_name;
-      if (!non_nullable_type.QualifiedName().empty()) {
-        non_nullable_class_name = std::string(non_nullable_type.SimpleName());
+    case NodeKind::kSafeCall: {
+      auto* safe_call = Cast<SafeCall>(expr);
+      TypeReference object_type = InferExpressionType(&safe_call->MutableObject());
+      std::string class_name;
+      if (!object_type.QualifiedName().empty()) {
+        class_name = std::string(object_type.SimpleName());
       }
+      if (!class_name.empty()) {
+        // Remove nullable to check for methods
+        TypeReference non_nullable_type = object_type.IsNullable() ? object_type.WithoutNullable() : object_type;
+        std::string non_nullable_class_name;
+        if (!non_nullable_type.QualifiedName().empty()) {
+          non_nullable_class_name = std::string(non_nullable_type.SimpleName());
+        }
 
-      if (!non_nullable_class_name.empty()) {
-        std::string method_key = non_nullable_class_name + "::" + safe_call->Method();
-        if (auto method_it = methods_.find(method_key); method_it != methods_.end()) {
-          if (method_it->second.return_type) {
-            TypeReference return_type = *method_it->second.return_type;
-            // Safe call always returns nullable type (since object can be null)
-            return_type.MakeNullable();
-            return return_type;
-          }
-        } else if (auto interface_it = interfaces_.find(non_nullable_class_name); interface_it != interfaces_.end()) {
-          // Check if non_nullable_class_name is actually an interface
-          const auto& interface_sig = interface_it->second;
-          if (auto interface_method_it = interface_sig.methods.find(safe_call->Method());
-              interface_method_it != interface_sig.methods.end()) {
-            if (interface_method_it->second.return_type) {
-              TypeReference return_type = *interface_method_it->second.return_type;
+        if (!non_nullable_class_name.empty()) {
+          std::string method_key = non_nullable_class_name + "::" + safe_call->Method();
+          if (auto method_it = methods_.find(method_key); method_it != methods_.end()) {
+            if (method_it->second.return_type) {
+              TypeReference return_type = *method_it->second.return_type;
               // Safe call always returns nullable type (since object can be null)
               return_type.MakeNullable();
               return return_type;
             }
-          }
-        } else if (safe_call->Args().empty()) {
-          // SafeCall with no arguments might be field access (p?.x)
-          // Check if it's a field
-          if (auto fields_it = class_fields_.find(non_nullable_class_name); fields_it != class_fields_.end()) {
-            for (const auto& [field_name, field_type] : fields_it->second) {
-              if (field_name == safe_call->Method()) {
+          } else if (auto interface_it = interfaces_.find(non_nullable_class_name); interface_it != interfaces_.end()) {
+            // Check if non_nullable_class_name is actually an interface
+            const auto& interface_sig = interface_it->second;
+            if (auto interface_method_it = interface_sig.methods.find(safe_call->Method());
+                interface_method_it != interface_sig.methods.end()) {
+              if (interface_method_it->second.return_type) {
+                TypeReference return_type = *interface_method_it->second.return_type;
                 // Safe call always returns nullable type (since object can be null)
-                TypeReference return_type = field_type;
                 return_type.MakeNullable();
                 return return_type;
               }
             }
+          } else if (safe_call->Args().empty()) {
+            // SafeCall with no arguments might be field access (p?.x)
+            // Check if it's a field
+            if (auto fields_it = class_fields_.find(non_nullable_class_name); fields_it != class_fields_.end()) {
+              for (const auto& [field_name, field_type] : fields_it->second) {
+                if (field_name == safe_call->Method()) {
+                  // Safe call always returns nullable type (since object can be null)
+                  TypeReference return_type = field_type;
+                  return_type.MakeNullable();
+                  return return_type;
+                }
+              }
+            }
           }
         }
       }
+      return {};
     }
-    return {};
-  }
-
-  if (auto* binary = dynamic_cast<Binary*>(expr)) {
-    TypeReference lhs_type = InferExpressionType(&binary->MutableLhs());
-    TypeReference rhs_type = InferExpressionType(&binary->MutableRhs());
-
-    const IBinaryOpTag& op = binary->Op();
-    bool is_comparison = &op == &optags::Eq() || &op == &optags::Ne() || &op == &optags::Lt() || &op == &optags::Le() ||
-                         &op == &optags::Gt() || &op == &optags::Ge();
-    bool is_logical = &op == &optags::And() || &op == &optags::Or();
-
-    if (is_comparison || is_logical) {
-      return TypeReference("bool");
-    } else {
-      // Arithmetic operations return the type of the operands
-      // Use type promotion: if either operand is float, result is float
-      // Otherwise use the type of the first non-empty operand
-      std::string lhs_fundamental = GetFundamentalTypeName(lhs_type);
-      std::string rhs_fundamental = GetFundamentalTypeName(rhs_type);
-
-      // Type promotion: float > int > byte/char
-      if (lhs_fundamental == "float" || rhs_fundamental == "float") {
-        return TypeReference("float");
-      }
-      if (lhs_fundamental == "int" || rhs_fundamental == "int") {
-        return TypeReference("int");
+    case NodeKind::kBinary: {
+      auto* binary = Cast<Binary>(expr);
+      TypeReference lhs_type = InferExpressionType(&binary->MutableLhs());
+      TypeReference rhs_type = InferExpressionType(&binary->MutableRhs());
+
+      const IBinaryOpTag& op = binary->Op();
+      bool is_comparison = &op == &optags::Eq() || &op == &optags::Ne() || &op == &optags::Lt() ||
+                           &op == &optags::Le() || &op == &optags::Gt() || &op == &optags::Ge();
+      bool is_logical = &op == &optags::And() || &op == &optags::Or();
+
+      if (is_comparison || is_logical) {
+        return TypeReference("bool");
+      } else {
+        // Arithmetic operations return the type of the operands
+        // Use type promotion: if either operand is float, result is float
+        // Otherwise use the type of the first non-empty operand
+        std::string lhs_fundamental = GetFundamentalTypeName(lhs_type);
+        std::string rhs_fundamental = GetFundamentalTypeName(rhs_type);
+
+        // Type promotion: float > int > byte/char
+        if (lhs_fundamental == "float" || rhs_fundamental == "float") {
+          return TypeReference("float");
+        }
+        if (lhs_fundamental == "int" || rhs_fundamental == "int") {
+          return TypeReference("int");
+        }
+        if (!lhs_fundamental.empty()) {
+          return TypeReference(lhs_fundamental);
+        }
+        if (!rhs_fundamental.empty()) {
+          return TypeReference(rhs_fundamental);
+        }
+        // If both are empty, return empty (shouldn't happen for valid expressions)
+        return {};
       }
-      if (!lhs_fundamental.empty()) {
-        return TypeReference(lhs_fundamental);
+    }
+    case NodeKind::kUnary: {
+      auto* unary = Cast<Unary>(expr);
+      TypeReference operand_type = InferExpressionType(&unary->MutableOperand());
+
+      const IUnaryOpTag& op = unary->Op();
+      if (&op == &optags::Not()) {
+        return TypeReference("bool");
+      } else {
+        // Other unary operations (negation, plus) return the type of the operand
+        return operand_type;
       }
-      if (!rhs_fundamental.empty()) {
-        return TypeReference(rhs_fundamental);
+    }
+    case NodeKind::kElvis: {
+      auto* elvis = Cast<Elvis>(expr);
+      TypeReference lhs_type = InferExpressionType(&elvis->MutableLhs());
+      TypeReference rhs_type = InferExpressionType(&elvis->MutableRhs());
+
+      // Elvis operator: if lhs is null, use rhs
+      // Result type is the non-nullable version of lhs type, or rhs type if lhs is nullable
+      // The result is always non-nullable (since rhs is used if lhs is null)
+      if (lhs_type.IsNullable()) {
+        // Result is the union: non-nullable lhs type, or rhs type (whichever is more general)
+        // For simplicity, return rhs type (which should be non-nullable)
+        return rhs_type;
+      } else {
+        // If lhs is not nullable, result is lhs type
+        return lhs_type;
       }
-      // If both are empty, return empty (shouldn't happen for valid expressions)
-      return {};
     }
-  }
-
-  if (auto* unary = dynamic_cast<Unary*>(expr)) {
-    TypeReference operand_type = InferExpressionType(&unary->MutableOperand());
-
-    const IUnaryOpTag& op = unary->Op();
-    if (&op == &optags::Not()) {
+    case NodeKind::kCastAs: {
+      auto* cast = Cast<CastAs>(expr);
+      // Cast returns the target type
+      return cast->Type();
+    }
+    case NodeKind::kTypeTestIs: {
+      // Type test always returns bool
       return TypeReference("bool");
-    } else {
-      // Other unary operations (negation, plus) return the type of the operand
-      return operand_type;
     }
-  }
-
-  if (auto* elvis = dynamic_cast<Elvis*>(expr)) {
-    TypeReference lhs_type = InferExpressionType(&elvis->MutableLhs());
-    TypeReference rhs_type = InferExpressionType(&elvis->MutableRhs());
-
-    // Elvis operator: if lhs is null, use rhs
-    // Result type is the non-nullable version of lhs type, or rhs type if lhs is nullable
-    // The result is always non-nullable (since rhs is used if lhs is null)
-    if (lhs_type.IsNullable()) {
-      // Result is the union: non-nullable lhs type, or rhs type (whichever is more general)
-      // For simplicity, return rhs type (which should be non-nullable)
-      return rhs_type;
-    } else {
-      // If lhs is not nullable, result is lhs type
-      return lhs_type;
+    case NodeKind::kAssign: {
+      auto* assign = Cast<Assign>(expr);
+      // Assignment returns the type of the target
+      return InferExpressionType(&assign->MutableTarget());
     }
-  }
-
-  if (auto* cast = dynamic_cast<CastAs*>(expr)) {
-    // Cast returns the target type
-    return cast->Type();
-  }
-
-  if (dynamic_cast<TypeTestIs*>(expr)) {
-    // Type test always returns bool
-    return TypeReference("bool");
-  }
-
-  if (auto* assign = dynamic_cast<Assign*>(expr)) {
-    // Assignment returns the type of the target
-    return InferExpressionType(&assign->MutableTarget());
-  }
-
-  if (dynamic_cast<NamespaceRef*>(expr) != nullptr) {
-    // NamespaceRef is used for system commands, return Object for now
-    return TypeReference("Object");
+    case NodeKind::kNamespaceRef: {
+      // NamespaceRef is used for system commands, return Object for now
+      return TypeReference("Object");
+    }
+    default:
+      break;
   }
 
   // If we can't determine the type, return empty
-  // This should not happen for literals as they are checked first
   return {};
 }
 
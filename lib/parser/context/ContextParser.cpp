@@ -87,4 +87,12 @@ IAstFactory* ContextParser::Factory() const {
   return factory_;
 }
 
+void ContextParser::SetDeferredBodies(std::shared_ptr<IDeferredBodySource> source) {
+  deferred_bodies_ = std::move(source);
+}
+
+const std::shared_ptr<IDeferredBodySource>& ContextParser::DeferredBodies() const {
+  return deferred_bodies_;
+}
+
 } // namespace ovum::compiler::parser
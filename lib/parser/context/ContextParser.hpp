@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "NodeEntry.hpp"
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
 #include "lib/parser/diagnostics/IDiagnosticSink.hpp"
 #include "lib/parser/states/base/IState.hpp"
 
@@ -15,6 +16,7 @@ class AstNode;
 class IExpressionParser;
 class ITypeParser;
 class IAstFactory; // forward
+class IDeferredBodySource;
 
 template<class T>
 concept AstNodeDerived = std::is_base_of_v<AstNode, T>;
@@ -36,6 +38,10 @@ public:
   void SetFactory(IAstFactory* factory);
   [[nodiscard]] IAstFactory* Factory() const;
 
+  // When set, function, method and call bodies in braces are skipped and left to this source to parse on demand.
+  void SetDeferredBodies(std::shared_ptr<IDeferredBodySource> source);
+  [[nodiscard]] const std::shared_ptr<IDeferredBodySource>& DeferredBodies() const;
+
   void PushState(const IState& state);
   void PopState();
   [[nodiscard]] const IState* CurrentState() const;
@@ -46,12 +52,7 @@ public:
       return nullptr;
     }
 
-    AstNode* base = node_stack_.back().MutableNode();
-    if (!base) {
-      return nullptr;
-    }
-
-    return dynamic_cast<T*>(base);
+    return DynCast<T>(node_stack_.back().MutableNode());
   }
 
   void PushNode(std::unique_ptr<AstNode> node);
@@ -68,6 +69,7 @@ private:
   IExpressionParser* expr_ = nullptr;
   ITypeParser* typep_ = nullptr;
   IAstFactory* factory_ = nullptr;
+  std::shared_ptr<IDeferredBodySource> deferred_bodies_;
 };
 
 } // namespace ovum::compiler::parser
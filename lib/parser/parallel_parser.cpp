@@ -0,0 +1,195 @@
+#include "parallel_parser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "ParserFsm.hpp"
+#include "ast/BuilderAstFactory.hpp"
+#include "diagnostics/DiagnosticCollector.hpp"
+#include "lib/lexer/TokenKind.hpp"
+#include "lib/lexer/parallel_lexer.hpp"
+#include "pratt/DefaultOperatorResolver.hpp"
+#include "pratt/PrattExpressionParser.hpp"
+#include "tokens/token_streams/TokenBufferStream.hpp"
+#include "type_parser/QNameTypeParser.hpp"
+
+namespace ovum::compiler::parser {
+
+namespace {
+
+constexpr std::array<std::string_view, 8> kDeclKeywords = {
+    "fun", "pure", "class", "interface", "typealias", "var", "val", "global"};
+
+// Several chunks per thread, so a thread that drew cheap declarations picks up more work instead of idling.
+constexpr std::size_t kChunksPerThread = 4;
+
+struct ChunkRange {
+  std::size_t begin = 0;
+  std::size_t end = 0;
+};
+
+struct ChunkResult {
+  std::unique_ptr<Module> module;
+  std::unique_ptr<DiagnosticCollector> diags;
+  std::exception_ptr failure;
+};
+
+bool IsDeclKeyword(std::string_view lexeme) {
+  return std::ranges::find(kDeclKeywords, lexeme) != kDeclKeywords.end();
+}
+
+std::size_t ParseThreadCount(const ParallelParseOptions& options) {
+  if (options.threads != 0) {
+    return options.threads;
+  }
+
+  return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+// Closes a chunk at the first declaration start once it holds target tokens.
+std::vector<ChunkRange> GroupIntoChunks(const std::vector<std::size_t>& starts,
+                                        std::size_t token_count,
+                                        std::size_t target) {
+  std::vector<ChunkRange> chunks;
+  std::size_t begin = 0;
+
+  for (const std::size_t start : starts) {
+    if (start - begin >= target) {
+      chunks.push_back({.begin = begin, .end = start});
+      begin = start;
+    }
+  }
+
+  chunks.push_back({.begin = begin, .end = token_count});
+
+  return chunks;
+}
+
+} // namespace
+
+ParserComponents MakeDefaultParserComponents() {
+  auto factory = std::make_shared<BuilderAstFactory>();
+  auto type_parser = std::make_unique<QNameTypeParser>(*factory);
+  auto expr_parser =
+      std::make_unique<PrattExpressionParser>(std::make_unique<DefaultOperatorResolver>(), factory, type_parser.get());
+
+  return {.expr = std::move(expr_parser), .type = std::move(type_parser), .factory = std::move(factory)};
+}
+
+std::vector<std::size_t> FindTopLevelDeclStarts(const lexer::TokenBuffer& tokens) {
+  std::vector<std::size_t> starts{0};
+
+  if (tokens.IsEmpty()) {
+    return starts;
+  }
+
+  std::size_t depth = 0;
+  bool line_start = true;
+
+  for (std::size_t i = 0; i + 1 < tokens.Size(); ++i) {
+    const lexer::TokenKind kind = tokens.Kind(i);
+
+    if (kind == lexer::TokenKind::kComment) {
+      continue;
+    }
+
+    if (kind == lexer::TokenKind::kNewline) {
+      line_start = depth == 0;
+      continue;
+    }
+
+    const std::string_view lexeme = tokens.Lexeme(i);
+
+    if (depth == 0 && line_start && starts.back() != i && IsDeclKeyword(lexeme)) {
+      starts.push_back(i);
+    }
+
+    line_start = false;
+
+    if (kind != lexer::TokenKind::kPunct && kind != lexer::TokenKind::kOperator) {
+      continue;
+    }
+
+    if (lexeme == "{" || lexeme == "(" || lexeme == "[") {
+      ++depth;
+    } else if (lexeme == "}" || lexeme == ")" || lexeme == "]") {
+      depth -= depth != 0 ? 1 : 0;
+      line_start = depth == 0 && lexeme == "}";
+    } else if (lexeme == ";") {
+      line_start = depth == 0;
+    }
+  }
+
+  return starts;
+}
+
+std::optional<std::unique_ptr<Module>> TryParseParallel(const lexer::TokenBuffer& tokens,
+                                                        IAstFactory* factory,
+                                                        IDiagnosticSink& diags,
+                                                        const ParserComponentsFactory& make_components,
+                                                        const ParallelParseOptions& options) {
+  const std::size_t threads = ParseThreadCount(options);
+
+  if (threads < 2 || tokens.Size() < 2 || tokens.Size() < options.threshold) {
+    return std::nullopt;
+  }
+
+  // The end of file token is not part of any chunk: every chunk's stream ends with it.
+  const std::size_t token_count = tokens.Size() - 1;
+  const std::size_t chunk_count =
+      std::min(threads * kChunksPerThread, token_count / std::max<std::size_t>(1, options.min_chunk));
+
+  if (chunk_count < 2) {
+    return std::nullopt;
+  }
+
+  const std::vector<ChunkRange> chunks =
+      GroupIntoChunks(FindTopLevelDeclStarts(tokens), token_count, (token_count + chunk_count - 1) / chunk_count);
+
+  if (chunks.size() < 2) {
+    return std::nullopt;
+  }
+
+  std::vector<ChunkResult> results(chunks.size());
+  lexer::RunChunksInParallel(chunks.size(), threads, [&](std::size_t index) {
+    ChunkResult& result = results[index];
+    result.diags = std::make_unique<DiagnosticCollector>();
+    result.diags->EnableDeduplication(false);
+
+    try {
+      ParserComponents components = make_components();
+      ParserFsm parser(std::move(components.expr), std::move(components.type), std::move(components.factory));
+      TokenBufferStream stream(tokens, chunks[index].begin, chunks[index].end);
+      result.module = parser.Parse(stream, *result.diags);
+    } catch (...) {
+      result.failure = std::current_exception();
+    }
+  });
+
+  // A chunk that failed is parsed again serially, with the whole module around it, so the caller sees the serial
+  // diagnostics or exception.
+  for (const ChunkResult& result : results) {
+    if (result.failure != nullptr || result.module == nullptr || result.diags->HasErrors()) {
+      return std::nullopt;
+    }
+  }
+
+  std::unique_ptr<Module> module =
+      factory != nullptr ? factory->MakeModule({}, SourceId{}, {}, SourceSpan{}) : std::make_unique<Module>();
+
+  for (ChunkResult& result : results) {
+    module->TakeDecls(*result.module);
+
+    for (const Diagnostic& diagnostic : result.diags->All()) {
+      diags.Report(diagnostic);
+    }
+  }
+
+  return module;
+}
+
+} // namespace ovum::compiler::parser
@@ -0,0 +1,60 @@
+#ifndef PARSER_PARALLEL_PARSER_HPP_
+#define PARSER_PARALLEL_PARSER_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "ast/IAstFactory.hpp"
+#include "ast/nodes/decls/Module.hpp"
+#include "diagnostics/IDiagnosticSink.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+#include "pratt/IExpressionParser.hpp"
+#include "type_parser/ITypeParser.hpp"
+
+namespace ovum::compiler::parser {
+
+// Below this many tokens a module is parsed serially: starting threads would cost more than it saves.
+inline constexpr std::size_t kParallelParseThreshold = std::size_t{1} << 16;
+inline constexpr std::size_t kMinParallelParseChunk = std::size_t{1} << 12;
+
+struct ParallelParseOptions {
+  std::size_t threshold = kParallelParseThreshold;
+  std::size_t min_chunk = kMinParallelParseChunk; // in tokens
+  std::size_t threads = 0; // 0 picks std::thread::hardware_concurrency()
+};
+
+// Everything a ParserFsm is built from. The expression parser may refer to the type parser, so they travel together.
+struct ParserComponents {
+  std::unique_ptr<IExpressionParser> expr;
+  std::unique_ptr<ITypeParser> type;
+  std::shared_ptr<IAstFactory> factory;
+};
+
+// Fresh components for one chunk of a parallel parse.
+using ParserComponentsFactory = std::function<ParserComponents()>;
+
+// Pratt expressions over the default operators, qualified-name types and an arena-backed BuilderAstFactory.
+[[nodiscard]] ParserComponents MakeDefaultParserComponents();
+
+// Token indices where a top-level declaration (fun, pure, class, interface, typealias, var, val, global) starts: a
+// declaration keyword at the start of a line, outside any brackets. A cheap scan over kinds and lexemes; the first
+// index is always 0, so the ranges between consecutive starts cover every token before the end of file.
+[[nodiscard]] std::vector<std::size_t> FindTopLevelDeclStarts(const lexer::TokenBuffer& tokens);
+
+// Splits tokens at top-level declarations into chunks, parses each chunk on a worker with its own components, context
+// and diagnostic buffer, and merges the declarations into one module in source order. Each chunk's diagnostics are
+// then passed on in chunk order, so they come out as a serial parse would give them.
+// nullopt when tokens are below the threshold, hold fewer than two chunks, or any chunk reports an error; the caller
+// should then parse serially, so error recovery and its diagnostics are exactly the serial ones.
+[[nodiscard]] std::optional<std::unique_ptr<Module>> TryParseParallel(const lexer::TokenBuffer& tokens,
+                                                                      IAstFactory* factory,
+                                                                      IDiagnosticSink& diags,
+                                                                      const ParserComponentsFactory& make_components,
+                                                                      const ParallelParseOptions& options);
+
+} // namespace ovum::compiler::parser
+
+#endif // PARSER_PARALLEL_PARSER_HPP_
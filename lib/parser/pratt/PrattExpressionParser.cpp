@@ -1,6 +1,6 @@
 #include "PrattExpressionParser.hpp"
 
-#include <charconv>
+#include <algorithm>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -8,6 +8,7 @@
 
 #include <tokens/Token.hpp>
 
+#include "lib/lexer/literal_decoder.hpp"
 #include "lib/parser/ast/nodes/exprs/tags/optags.hpp"
 #include "lib/parser/diagnostics/IDiagnosticSink.hpp"
 #include "lib/parser/pratt/specifications/InfixSpec.hpp"
@@ -21,20 +22,25 @@ namespace {
 
 constexpr int kBpAssign = 5;
 constexpr int kBpPost = 100;
-constexpr int kDecimalBase = 10;
-constexpr int kMaxByteValue = 255;
-constexpr int kHexBase = 16;
 
 bool Lex(const Token& t, std::string_view s) {
   return t.GetLexeme() == s;
 }
 
-bool IsIdentifier(const Token& t) {
-  return t.GetStringType() == "IDENT";
+bool IsIdentifier(ITokenStream& ts) {
+  if (const std::optional<lexer::TokenKind> kind = ts.PeekKind(); kind.has_value()) {
+    return *kind == lexer::TokenKind::kIdent;
+  }
+
+  return ts.Peek().GetStringType() == "IDENT";
 }
 
-bool IsLiteral(const Token& t) {
-  const std::string ty = t.GetStringType();
+bool IsLiteral(ITokenStream& ts) {
+  if (const std::optional<lexer::TokenKind> kind = ts.PeekKind(); kind.has_value()) {
+    return lexer::IsLiteralKind(*kind);
+  }
+
+  const std::string ty = ts.Peek().GetStringType();
   return ty.starts_with("LITERAL");
 }
 
@@ -47,43 +53,6 @@ SourceSpan Union(const SourceSpan& a, const SourceSpan& b) {
   return SourceSpan::Union(a, b);
 }
 
-bool ParseIntegerLiteral(const std::string& text, long long* out) {
-  if (text.size() >= 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
-    // Hex literal: 0x1A
-    try {
-      *out = std::stoll(text, nullptr, kHexBase);
-      return true;
-    } catch (...) {
-      return false;
-    }
-  }
-
-  if (text.size() >= 2 && text[0] == '0' && (text[1] == 'b' || text[1] == 'B')) {
-    // Binary literal: 0b1010
-    try {
-      *out = std::stoll(text.substr(2), nullptr, 2);
-      return true;
-    } catch (...) {
-      return false;
-    }
-  }
-
-  // Decimal literal: 42
-  const char* begin = text.data();
-  const char* end = begin + text.size();
-  auto [ptr, ec] = std::from_chars(begin, end, *out, kDecimalBase);
-  return ec == std::errc{} && ptr == end;
-}
-
-bool ParseFloat(const std::string& text, long double* out) {
-  try {
-    *out = std::stold(text);
-    return true;
-  } catch (...) {
-    return false;
-  }
-}
-
 std::string Unquote(std::string_view lexeme) {
   if (lexeme.size() >= 2 &&
       ((lexeme.front() == '"' && lexeme.back() == '"') || (lexeme.front() == '\'' && lexeme.back() == '\''))) {
@@ -92,80 +61,92 @@ std::string Unquote(std::string_view lexeme) {
   return std::string(lexeme);
 }
 
-std::unique_ptr<Expr> MakeLiteralFromToken(const Token& token, IAstFactory& factory, IDiagnosticSink& diags) {
-  const std::string ty = token.GetStringType();
-  const auto span = SpanFrom(token);
+std::unique_ptr<Expr> MakeNumericLiteral(const lexer::NumericLiteral& literal, IAstFactory& factory, SourceSpan span) {
+  switch (literal.kind) {
+    case lexer::NumericLiteralKind::kInt:
+      return factory.MakeInt(literal.int_value, span);
+    case lexer::NumericLiteralKind::kByte:
+      return factory.MakeByte(static_cast<uint8_t>(literal.int_value), span);
+    case lexer::NumericLiteralKind::kFloat:
+      return factory.MakeFloat(literal.float_value, span);
+  }
 
-  if (ty == "LITERAL:Int") {
-    long long value = 0;
-    const std::string& lexeme = token.GetLexeme();
+  return nullptr;
+}
 
-    if (!lexeme.empty() && (lexeme.back() == 'b' || lexeme.back() == 'B')) {
-      if (const std::string num_part = lexeme.substr(0, lexeme.size() - 1); !ParseIntegerLiteral(num_part, &value)) {
-        diags.Error("E_LITERAL_BYTE", "invalid byte literal", span);
-        return nullptr;
-      }
+// decoded is the value the stream kept for the token, if any; numeric literals without one are decoded here.
+std::unique_ptr<Expr> MakeNumberFromToken(const Token& token,
+                                          bool is_float,
+                                          const std::optional<lexer::NumericLiteral>& decoded,
+                                          IAstFactory& factory,
+                                          IDiagnosticSink& diags,
+                                          SourceSpan span) {
+  if (decoded) {
+    return MakeNumericLiteral(*decoded, factory, span);
+  }
 
-      if (value < 0) {
-        value = 0;
-      }
-      if (value > kMaxByteValue) {
-        value = kMaxByteValue;
-      }
-      return factory.MakeByte(static_cast<uint8_t>(value), span);
-    }
+  const std::string lexeme = token.GetLexeme();
 
-    if (!ParseIntegerLiteral(lexeme, &value)) {
-      diags.Error("E_LITERAL_INT", "invalid integer literal", span);
-      return nullptr;
-    }
-    return factory.MakeInt(value, span);
+  if (const std::optional<lexer::NumericLiteral> literal = lexer::DecodeNumericLexeme(lexeme, is_float)) {
+    return MakeNumericLiteral(*literal, factory, span);
   }
 
-  if (ty == "LITERAL:Float") {
-    long double value = 0.0;
-    if (!ParseFloat(token.GetLexeme(), &value)) {
-      diags.Error("E_LITERAL_FLOAT", "invalid float literal", span);
-      return nullptr;
-    }
-    return factory.MakeFloat(value, span);
+  if (is_float) {
+    diags.Error("E_LITERAL_FLOAT", "invalid float literal", span);
+  } else if (!lexeme.empty() && (lexeme.back() == 'b' || lexeme.back() == 'B')) {
+    diags.Error("E_LITERAL_BYTE", "invalid byte literal", span);
+  } else {
+    diags.Error("E_LITERAL_INT", "invalid integer literal", span);
   }
 
-  if (ty == "LITERAL:Bool") {
-    const auto lex = token.GetLexeme();
-    const bool value = lex == "true" || lex == "True" || lex == "TRUE";
-    return factory.MakeBool(value, span);
-  }
+  return nullptr;
+}
 
-  if (ty == "LITERAL:Char") {
-    const auto raw = Unquote(token.GetLexeme());
-    char value = raw.empty() ? '\0' : raw.front();
-    return factory.MakeChar(value, span);
-  }
+// kind is the stream's PeekKind for the token; the type string is only read when the stream does not know it.
+std::unique_ptr<Expr> MakeLiteralFromToken(const Token& token,
+                                           std::optional<lexer::TokenKind> kind,
+                                           const std::optional<lexer::NumericLiteral>& decoded,
+                                           IAstFactory& factory,
+                                           IDiagnosticSink& diags) {
+  const auto span = SpanFrom(token);
 
-  if (ty == "LITERAL:Byte") {
-    long long value = 0;
-    if (!ParseIntegerLiteral(token.GetLexeme(), &value)) {
-      diags.Error("E_LITERAL_BYTE", "invalid byte literal", span);
-      return nullptr;
+  if (kind.has_value()) {
+    switch (*kind) {
+      case lexer::TokenKind::kIntLiteral:
+      case lexer::TokenKind::kFloatLiteral:
+        return MakeNumberFromToken(token, *kind == lexer::TokenKind::kFloatLiteral, decoded, factory, diags, span);
+      case lexer::TokenKind::kBoolLiteral: {
+        const auto lex = token.GetLexeme();
+        const bool value = lex == "true" || lex == "True" || lex == "TRUE";
+        return factory.MakeBool(value, span);
+      }
+      case lexer::TokenKind::kCharLiteral: {
+        const auto raw = Unquote(token.GetLexeme());
+        char value = raw.empty() ? '\0' : raw.front();
+        return factory.MakeChar(value, span);
+      }
+      case lexer::TokenKind::kStringLiteral:
+        return factory.MakeString(Unquote(token.GetLexeme()), span);
+      default:
+        break;
     }
+  } else {
+    // Literal types the lexer never produces, so no stream knows their kind.
+    const std::string ty = token.GetStringType();
 
-    if (value < 0) {
-      value = 0;
-    }
-    if (value > kMaxByteValue) {
-      value = kMaxByteValue;
-    }
-    return factory.MakeByte(static_cast<uint8_t>(value), span);
-  }
+    if (ty == "LITERAL:Byte") {
+      const std::optional<long long> value = lexer::DecodeIntegerLexeme(token.GetLexeme());
+      if (!value) {
+        diags.Error("E_LITERAL_BYTE", "invalid byte literal", span);
+        return nullptr;
+      }
 
-  if (ty == "LITERAL:String") {
-    const auto raw = Unquote(token.GetLexeme());
-    return factory.MakeString(raw, span);
-  }
+      return factory.MakeByte(static_cast<uint8_t>(std::clamp(*value, 0LL, lexer::kMaxByteLiteral)), span);
+    }
 
-  if (ty == "LITERAL:Null") {
-    return factory.MakeNull(span);
+    if (ty == "LITERAL:Null") {
+      return factory.MakeNull(span);
+    }
   }
 
   const std::string lex = token.GetLexeme();
@@ -228,7 +209,7 @@ std::unique_ptr<Expr> PrattExpressionParser::ParseExpr(ITokenStream& ts, IDiagno
     const Token& look = ts.Peek();
 
     const std::string& lex = look.GetLexeme();
-    if (lex == ";" || look.GetStringType() == "NEWLINE") {
+    if (lex == ";" || ts.PeekKind() == lexer::TokenKind::kNewline) {
       break;
     }
 
@@ -258,7 +239,7 @@ std::unique_ptr<Expr> PrattExpressionParser::ParseExpr(ITokenStream& ts, IDiagno
         const Token& next = ts.Peek();
 
         const std::string& new_lex = next.GetLexeme();
-        if (new_lex == ";" || next.GetStringType() == "NEWLINE") {
+        if (new_lex == ";" || ts.PeekKind() == lexer::TokenKind::kNewline) {
           break;
         }
 
@@ -379,14 +360,14 @@ std::unique_ptr<Expr> PrattExpressionParser::ParsePrefix(ITokenStream& ts, IDiag
     return factory_->MakeThisExpr(SpanFrom(look));
   }
 
-  if (IsIdentifier(look)) {
+  if (IsIdentifier(ts)) {
     std::string name = look.GetLexeme();
     ts.Consume();
     return factory_->MakeIdent(std::move(name), SpanFrom(look));
   }
 
-  if (IsLiteral(look)) {
-    std::unique_ptr<Expr> lit = MakeLiteralFromToken(look, *factory_, diags);
+  if (IsLiteral(ts)) {
+    std::unique_ptr<Expr> lit = MakeLiteralFromToken(look, ts.PeekKind(), ts.PeekNumber(), *factory_, diags);
     ts.Consume();
     return lit;
   }
@@ -444,7 +425,7 @@ std::unique_ptr<Expr> PrattExpressionParser::ParsePostfix(ITokenStream& ts,
   if (Lex(look, ".")) {
     ts.Consume();
 
-    if (ts.IsEof() || !IsIdentifier(ts.Peek())) {
+    if (ts.IsEof() || !IsIdentifier(ts)) {
       diags.Error("E_DOT_IDENT", "expected identifier after '.'", SpanFrom(look));
       return nullptr;
     }
@@ -481,7 +462,7 @@ std::unique_ptr<Expr> PrattExpressionParser::ParsePostfix(ITokenStream& ts,
   if (Lex(look, "?.")) {
     ts.Consume();
 
-    if (ts.IsEof() || !IsIdentifier(ts.Peek())) {
+    if (ts.IsEof() || !IsIdentifier(ts)) {
       diags.Error("E_SAFECALL_IDENT", "expected identifier after '?.'", SpanFrom(look));
       return nullptr;
     }
@@ -516,7 +497,7 @@ std::unique_ptr<Expr> PrattExpressionParser::ParsePostfix(ITokenStream& ts,
 
   if (Lex(look, "::")) {
     ts.Consume();
-    if (ts.IsEof() || !IsIdentifier(ts.Peek())) {
+    if (ts.IsEof() || !IsIdentifier(ts)) {
       diags.Error("E_NS_IDENT", "expected identifier after '::'", SpanFrom(look));
       return nullptr;
     }
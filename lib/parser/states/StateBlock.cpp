@@ -1,7 +1,9 @@
 #include "StateBlock.hpp"
 
 #include <memory>
+#include <optional>
 
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
 #include "lib/parser/ast/nodes/class_members/CallDecl.hpp"
 #include "lib/parser/ast/nodes/class_members/DestructorDecl.hpp"
 #include "lib/parser/ast/nodes/class_members/MethodDecl.hpp"
@@ -24,13 +26,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       (void) ts.Consume();
       continue;
     }
-    if (type == "NEWLINE") {
+    if (kind == lexer::TokenKind::kNewline) {
       (void) ts.Consume();
       continue;
     }
@@ -63,130 +64,130 @@ IState::StepResult StateBlock::TryStep(ContextParser& ctx, ITokenStream& ts) con
       const auto parent_node = ctx.NodeStack()[ctx.NodeStack().size() - 2].MutableNode();
 
       // Check if parent is FunctionDecl
-      if (auto* func = dynamic_cast<FunctionDecl*>(parent_node); func != nullptr && func->Body() == nullptr) {
+      if (auto* func = DynCast<FunctionDecl>(parent_node); func != nullptr && func->Body() == nullptr) {
         auto block_node = ctx.PopNode();
-        if (auto* block = dynamic_cast<Block*>(block_node.get()); block != nullptr) {
+        if (auto* block = DynCast<Block>(block_node.get()); block != nullptr) {
           func->SetBody(std::unique_ptr<Block>(block));
           [[maybe_unused]] auto* released = block_node.release();
 
           // Pop function and add to module
           auto func_node = ctx.PopNode();
           if (auto* module = ctx.TopNodeAs<Module>(); module != nullptr) {
-            module->AddDecl(std::unique_ptr<Decl>(dynamic_cast<Decl*>(func_node.release())));
+            module->AddDecl(std::unique_ptr<Decl>(Cast<Decl>(func_node.release())));
           }
         }
         return false;
       }
 
       // Check if parent is IfStmt (for else block)
-      if (auto* if_stmt = dynamic_cast<IfStmt*>(parent_node); if_stmt != nullptr && if_stmt->ElseBlock() == nullptr) {
+      if (auto* if_stmt = DynCast<IfStmt>(parent_node); if_stmt != nullptr && if_stmt->ElseBlock() == nullptr) {
         auto block_node = ctx.PopNode();
-        if (auto* else_block = dynamic_cast<Block*>(block_node.get()); else_block != nullptr) {
+        if (auto* else_block = DynCast<Block>(block_node.get()); else_block != nullptr) {
           if_stmt->SetElseBlock(std::unique_ptr<Block>(else_block));
           [[maybe_unused]] auto* released = block_node.release();
 
           // Pop IfStmt and add to parent block
           auto if_node = ctx.PopNode();
           if (auto* parent_block = ctx.TopNodeAs<Block>(); parent_block != nullptr) {
-            parent_block->Append(std::unique_ptr<Stmt>(dynamic_cast<Stmt*>(if_node.release())));
+            parent_block->Append(std::unique_ptr<Stmt>(Cast<Stmt>(if_node.release())));
           }
         }
         return false;
       }
 
       // Check if parent is WhileStmt
-      if (auto* while_stmt = dynamic_cast<WhileStmt*>(parent_node);
+      if (auto* while_stmt = DynCast<WhileStmt>(parent_node);
           while_stmt != nullptr && while_stmt->Body() == nullptr) {
         auto block_node = ctx.PopNode();
-        if (auto* body_block = dynamic_cast<Block*>(block_node.get()); body_block != nullptr) {
+        if (auto* body_block = DynCast<Block>(block_node.get()); body_block != nullptr) {
           while_stmt->SetBody(std::unique_ptr<Block>(body_block));
           [[maybe_unused]] auto* released = block_node.release();
         }
         auto while_node = ctx.PopNode();
         if (auto* parent_block = ctx.TopNodeAs<Block>(); parent_block != nullptr) {
-          parent_block->Append(std::unique_ptr<Stmt>(dynamic_cast<Stmt*>(while_node.release())));
+          parent_block->Append(std::unique_ptr<Stmt>(Cast<Stmt>(while_node.release())));
         }
         // Don't call PopState here - ParserFsm will do it when returning false
         return false;
       }
 
       // Check if parent is ForStmt
-      if (auto* for_stmt = dynamic_cast<ForStmt*>(parent_node); for_stmt != nullptr && for_stmt->Body() == nullptr) {
+      if (auto* for_stmt = DynCast<ForStmt>(parent_node); for_stmt != nullptr && for_stmt->Body() == nullptr) {
         auto block_node = ctx.PopNode();
-        if (auto* body_block = dynamic_cast<Block*>(block_node.get()); body_block != nullptr) {
+        if (auto* body_block = DynCast<Block>(block_node.get()); body_block != nullptr) {
           for_stmt->SetBody(std::unique_ptr<Block>(body_block));
           [[maybe_unused]] auto* released = block_node.release();
         }
         // Pop ForStmt and add to parent block
         auto for_node = ctx.PopNode();
         if (auto* parent_block = ctx.TopNodeAs<Block>(); parent_block != nullptr) {
-          parent_block->Append(std::unique_ptr<Stmt>(dynamic_cast<Stmt*>(for_node.release())));
+          parent_block->Append(std::unique_ptr<Stmt>(Cast<Stmt>(for_node.release())));
         }
         // Don't call PopState here - ParserFsm will do it when returning false
         return false;
       }
 
       // Check if parent is UnsafeBlock
-      if (auto* unsafe_stmt = dynamic_cast<UnsafeBlock*>(parent_node);
+      if (auto* unsafe_stmt = DynCast<UnsafeBlock>(parent_node);
           unsafe_stmt != nullptr && unsafe_stmt->Body() == nullptr) {
         auto block_node = ctx.PopNode();
-        if (auto* body_block = dynamic_cast<Block*>(block_node.get()); body_block != nullptr) {
+        if (auto* body_block = DynCast<Block>(block_node.get()); body_block != nullptr) {
           unsafe_stmt->SetBody(std::unique_ptr<Block>(body_block));
           [[maybe_unused]] auto* released = block_node.release();
         }
         // Pop UnsafeBlock and add to parent block
         auto unsafe_node = ctx.PopNode();
         if (auto* parent_block = ctx.TopNodeAs<Block>(); parent_block != nullptr) {
-          parent_block->Append(std::unique_ptr<Stmt>(dynamic_cast<Stmt*>(unsafe_node.release())));
+          parent_block->Append(std::unique_ptr<Stmt>(Cast<Stmt>(unsafe_node.release())));
         }
         // Don't call PopState here - ParserFsm will do it when returning false
         return false;
       }
 
       // Check if the parent is MethodDecl
-      if (auto* method = dynamic_cast<MethodDecl*>(parent_node); method != nullptr && method->Body() == nullptr) {
+      if (auto* method = DynCast<MethodDecl>(parent_node); method != nullptr && method->Body() == nullptr) {
         auto block_node = ctx.PopNode();
-        if (auto* body_block = dynamic_cast<Block*>(block_node.get()); body_block != nullptr) {
+        if (auto* body_block = DynCast<Block>(block_node.get()); body_block != nullptr) {
           method->SetBody(std::unique_ptr<Block>(body_block));
           [[maybe_unused]] auto* released = block_node.release();
 
           // Pop method and add to class
           auto method_node = ctx.PopNode();
           if (auto* class_decl = ctx.TopNodeAs<ClassDecl>(); class_decl != nullptr) {
-            class_decl->AddMember(std::unique_ptr<Decl>(dynamic_cast<Decl*>(method_node.release())));
+            class_decl->AddMember(std::unique_ptr<Decl>(Cast<Decl>(method_node.release())));
           }
         }
         return false;
       }
 
       // Check if parent is CallDecl
-      if (auto* call = dynamic_cast<CallDecl*>(parent_node); call != nullptr && call->Body() == nullptr) {
+      if (auto* call = DynCast<CallDecl>(parent_node); call != nullptr && call->Body() == nullptr) {
         auto block_node = ctx.PopNode();
-        if (auto* body_block = dynamic_cast<Block*>(block_node.get()); body_block != nullptr) {
+        if (auto* body_block = DynCast<Block>(block_node.get()); body_block != nullptr) {
           call->SetBody(std::unique_ptr<Block>(body_block));
           [[maybe_unused]] auto* released = block_node.release();
 
           // Pop call and add to class
           auto call_node = ctx.PopNode();
           if (auto* class_decl = ctx.TopNodeAs<ClassDecl>(); class_decl != nullptr) {
-            class_decl->AddMember(std::unique_ptr<Decl>(dynamic_cast<Decl*>(call_node.release())));
+            class_decl->AddMember(std::unique_ptr<Decl>(Cast<Decl>(call_node.release())));
           }
         }
         return false;
       }
 
       // Check if parent is DestructorDecl
-      if (auto* destructor = dynamic_cast<DestructorDecl*>(parent_node);
+      if (auto* destructor = DynCast<DestructorDecl>(parent_node);
           destructor != nullptr && destructor->Body() == nullptr) {
         auto block_node = ctx.PopNode();
-        if (auto* body_block = dynamic_cast<Block*>(block_node.get()); body_block != nullptr) {
+        if (auto* body_block = DynCast<Block>(block_node.get()); body_block != nullptr) {
           destructor->SetBody(std::unique_ptr<Block>(body_block));
           [[maybe_unused]] auto* released = block_node.release();
 
           // Pop destructor and add to class
           auto destructor_node = ctx.PopNode();
           if (auto* class_decl = ctx.TopNodeAs<ClassDecl>(); class_decl != nullptr) {
-            class_decl->AddMember(std::unique_ptr<Decl>(dynamic_cast<Decl*>(destructor_node.release())));
+            class_decl->AddMember(std::unique_ptr<Decl>(Cast<Decl>(destructor_node.release())));
           }
         }
         ctx.PopState();
@@ -1,6 +1,7 @@
 #include "StateCallDeclHdr.hpp"
 
 #include <memory>
+#include <optional>
 
 #include "ast/IAstFactory.hpp"
 #include "lib/parser/ast/nodes/class_members/CallDecl.hpp"
@@ -17,13 +18,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (type == "NEWLINE") {
+    if (kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -1,9 +1,11 @@
 #include "StateIfTail.hpp"
 
 #include <memory>
+#include <optional>
 #include <ranges>
 
 #include "ast/IAstFactory.hpp"
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
 #include "lib/parser/ast/nodes/stmts/Block.hpp"
 #include "lib/parser/ast/nodes/stmts/Branch.hpp"
 #include "lib/parser/ast/nodes/stmts/IfStmt.hpp"
@@ -19,13 +21,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (type == "NEWLINE") {
+    if (kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -44,7 +45,7 @@ IState::StepResult StateIfTail::TryStep(ContextParser& ctx, ITokenStream& ts) co
 
   IfStmt* if_stmt = nullptr;
   for (auto& it : std::ranges::reverse_view(ctx.NodeStack())) {
-    if_stmt = dynamic_cast<IfStmt*>(it.MutableNode());
+    if_stmt = DynCast<IfStmt>(it.MutableNode());
     if (if_stmt) {
       break;
     }
@@ -65,8 +66,8 @@ IState::StepResult StateIfTail::TryStep(ContextParser& ctx, ITokenStream& ts) co
     auto then_block_node = ctx.PopNode();
     auto condition_node = ctx.PopNode();
 
-    auto then_block = std::unique_ptr<Block>(dynamic_cast<Block*>(then_block_node.release()));
-    auto condition = std::unique_ptr<Expr>(dynamic_cast<Expr*>(condition_node.release()));
+    auto then_block = std::unique_ptr<Block>(Cast<Block>(then_block_node.release()));
+    auto condition = std::unique_ptr<Expr>(Cast<Expr>(condition_node.release()));
 
     if (!then_block || !condition) {
       return std::unexpected(StateError(std::string_view("invalid if branch components")));
@@ -109,7 +110,7 @@ IState::StepResult StateIfTail::TryStep(ContextParser& ctx, ITokenStream& ts) co
 
   auto if_node = ctx.PopNode();
   if (auto* parent_block = ctx.TopNodeAs<Block>()) {
-    parent_block->Append(std::unique_ptr<Stmt>(dynamic_cast<Stmt*>(if_node.release())));
+    parent_block->Append(std::unique_ptr<Stmt>(Cast<Stmt>(if_node.release())));
   }
 
   return false;
@@ -1,6 +1,7 @@
 #include "StateMethodHdr.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "ast/IAstFactory.hpp"
@@ -19,13 +20,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (type == "NEWLINE") {
+    if (kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -33,14 +33,14 @@ void SkipTrivia(ITokenStream& ts) {
   }
 }
 
-bool IsIdentifier(const Token& token) {
+bool IsIdentifier(ITokenStream& ts) {
   const MatchIdentifier matcher;
-  return matcher.TryMatch(token);
+  return matcher.TryMatchKind(ts.Peek(), ts.PeekKind());
 }
 
 std::string ReadIdentifier(const ContextParser& ctx, ITokenStream& ts) {
   SkipTrivia(ts);
-  if (ts.IsEof() || !IsIdentifier(ts.Peek())) {
+  if (ts.IsEof() || !IsIdentifier(ts)) {
     if (ctx.Diags() != nullptr) {
       if (const Token* tok = ts.TryPeek(); tok != nullptr) {
         SourceSpan span = StateBase::SpanFrom(*tok);
@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "lib/parser/ast/IAstFactory.hpp"
 #include "lib/parser/ast/nodes/decls/Module.hpp"
 #include "lib/parser/context/ContextParser.hpp"
 #include "lib/parser/states/base/StateRegistry.hpp"
@@ -15,7 +16,10 @@ std::string_view StateModule::Name() const {
 
 IState::StepResult StateModule::TryStep(ContextParser& context, ITokenStream& token_stream) const {
   if (context.NodeStack().empty()) {
-    auto module = std::make_unique<Module>();
+    // Through the factory, so the module owns the arena its nodes are about to be allocated from.
+    std::unique_ptr<Module> module = context.Factory() != nullptr
+                                         ? context.Factory()->MakeModule({}, SourceId{}, {}, SourceSpan{})
+                                         : std::make_unique<Module>();
     context.PushNode(std::move(module));
   }
 
@@ -1,6 +1,7 @@
 #include "StateReturnTail.hpp"
 
 #include <memory>
+#include <optional>
 
 #include "ast/IAstFactory.hpp"
 #include "lib/parser/ast/nodes/stmts/Block.hpp"
@@ -16,13 +17,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts, bool skip_newlines = true) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (skip_newlines && type == "NEWLINE") {
+    if (skip_newlines && kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -33,12 +33,11 @@ void SkipTrivia(ITokenStream& ts, bool skip_newlines = true) {
 void ConsumeTerminators(ITokenStream& ts) {
   SkipTrivia(ts, false);
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    if (const std::string type = t.GetStringType(); type == "NEWLINE") {
+    if (ts.PeekKind() == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
-    if (t.GetLexeme() == ";") {
+    if (ts.Peek().GetLexeme() == ";") {
       ts.Consume();
       continue;
     }
@@ -81,7 +80,7 @@ IState::StepResult StateReturnTail::TryStep(ContextParser& ctx, ITokenStream& ts
 
   // Check if there's a return value
   if (ts.IsEof() || ts.Peek().GetLexeme() == ";" || ts.Peek().GetLexeme() == "}" ||
-      ts.Peek().GetStringType() == "NEWLINE") {
+      ts.PeekKind() == lexer::TokenKind::kNewline) {
     // Return without value
     auto stmt = ctx.Factory()->MakeReturnStmt(nullptr, span);
     block->Append(std::move(stmt));
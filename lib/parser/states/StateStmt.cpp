@@ -1,6 +1,7 @@
 #include "StateStmt.hpp"
 
 #include <memory>
+#include <optional>
 
 #include "ast/IAstFactory.hpp"
 #include "ast/nodes/base/Expr.hpp"
@@ -21,13 +22,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts, const bool skip_newlines = true) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (skip_newlines && type == "NEWLINE") {
+    if (skip_newlines && kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -35,9 +35,9 @@ void SkipTrivia(ITokenStream& ts, const bool skip_newlines = true) {
   }
 }
 
-bool IsIdentifier(const Token& token) {
+bool IsIdentifier(ITokenStream& ts) {
   const MatchIdentifier matcher;
-  return matcher.TryMatch(token);
+  return matcher.TryMatchKind(ts.Peek(), ts.PeekKind());
 }
 
 void ReportUnexpected(IDiagnosticSink* diags, std::string_view code, std::string_view message, const Token* tok) {
@@ -71,12 +71,11 @@ std::unique_ptr<Expr> ParseExpression(ContextParser& ctx, ITokenStream& ts) {
 void ConsumeTerminators(ITokenStream& ts) {
   SkipTrivia(ts, false);
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    if (const std::string type = t.GetStringType(); type == "NEWLINE") {
+    if (ts.PeekKind() == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
-    if (t.GetLexeme() == ";") {
+    if (ts.Peek().GetLexeme() == ";") {
       ts.Consume();
       continue;
     }
@@ -174,7 +173,7 @@ IState::StepResult StateStmt::TryStep(ContextParser& ctx, ITokenStream& ts) cons
     }
   }
 
-  if (IsIdentifier(ts.Peek())) {
+  if (IsIdentifier(ts)) {
     std::string name = ts.Consume()->GetLexeme();
     SkipTrivia(ts);
 
@@ -1,6 +1,7 @@
 #include "StateTopDecl.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -21,13 +22,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts, const bool skip_newlines = true) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (skip_newlines && type == "NEWLINE") {
+    if (skip_newlines && kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -39,9 +39,9 @@ SourceSpan SpanFrom(const Token& token) {
   return StateBase::SpanFrom(token);
 }
 
-bool IsIdentifier(const Token& token) {
+bool IsIdentifier(ITokenStream& ts) {
   const MatchIdentifier matcher;
-  return matcher.TryMatch(token);
+  return matcher.TryMatchKind(ts.Peek(), ts.PeekKind());
 }
 
 void ReportUnexpected(IDiagnosticSink* diags, std::string_view code, std::string_view message, const Token* tok) {
@@ -57,7 +57,7 @@ void ReportUnexpected(IDiagnosticSink* diags, std::string_view code, std::string
 
 std::string ReadIdentifier(const ContextParser& ctx, ITokenStream& ts) {
   SkipTrivia(ts);
-  if (ts.IsEof() || !IsIdentifier(ts.Peek())) {
+  if (ts.IsEof() || !IsIdentifier(ts)) {
     const Token* tok = ts.TryPeek();
     ReportUnexpected(ctx.Diags(), "P_GLOBAL_VAR_NAME", "expected variable name", tok);
     return "";
@@ -89,12 +89,11 @@ std::unique_ptr<Expr> ParseExpression(const ContextParser& ctx, ITokenStream& ts
 void ConsumeTerminators(ITokenStream& ts) {
   SkipTrivia(ts, false);
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    if (const std::string type = t.GetStringType(); type == "NEWLINE") {
+    if (ts.PeekKind() == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
-    if (t.GetLexeme() == ";") {
+    if (ts.Peek().GetLexeme() == ";") {
       ts.Consume();
       continue;
     }
@@ -1,6 +1,7 @@
 #include "StateTypeAliasDecl.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "ast/IAstFactory.hpp"
@@ -18,13 +19,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts, const bool skip_newlines = true) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (skip_newlines && type == "NEWLINE") {
+    if (skip_newlines && kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -32,14 +32,14 @@ void SkipTrivia(ITokenStream& ts, const bool skip_newlines = true) {
   }
 }
 
-bool IsIdentifier(const Token& token) {
+bool IsIdentifier(ITokenStream& ts) {
   const MatchIdentifier matcher;
-  return matcher.TryMatch(token);
+  return matcher.TryMatchKind(ts.Peek(), ts.PeekKind());
 }
 
 std::string ReadIdentifier(const ContextParser& ctx, ITokenStream& ts) {
   SkipTrivia(ts);
-  if (ts.IsEof() || !IsIdentifier(ts.Peek())) {
+  if (ts.IsEof() || !IsIdentifier(ts)) {
     if (ctx.Diags() != nullptr) {
       if (const Token* tok = ts.TryPeek(); tok != nullptr) {
         SourceSpan span = StateBase::SpanFrom(*tok);
@@ -57,12 +57,11 @@ std::string ReadIdentifier(const ContextParser& ctx, ITokenStream& ts) {
 void ConsumeTerminators(ITokenStream& ts) {
   SkipTrivia(ts, false);
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    if (const std::string type = t.GetStringType(); type == "NEWLINE") {
+    if (ts.PeekKind() == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
-    if (t.GetLexeme() == ";") {
+    if (ts.Peek().GetLexeme() == ";") {
       ts.Consume();
       continue;
     }
@@ -1,7 +1,9 @@
 #include "StateClassBody.hpp"
 
 #include <memory>
+#include <optional>
 
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
 #include "lib/parser/ast/nodes/decls/ClassDecl.hpp"
 #include "lib/parser/ast/nodes/decls/Module.hpp"
 #include "lib/parser/context/ContextParser.hpp"
@@ -14,13 +16,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (type == "NEWLINE") {
+    if (kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -50,7 +51,7 @@ IState::StepResult StateClassBody::TryStep(ContextParser& ctx, ITokenStream& ts)
     // Pop class and add to module
     auto class_node = ctx.PopNode();
     if (auto* module = ctx.TopNodeAs<Module>(); module != nullptr) {
-      module->AddDecl(std::unique_ptr<Decl>(dynamic_cast<Decl*>(class_node.release())));
+      module->AddDecl(std::unique_ptr<Decl>(Cast<Decl>(class_node.release())));
     }
     return false;
   }
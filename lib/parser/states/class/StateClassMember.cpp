@@ -1,7 +1,9 @@
 #include "StateClassMember.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include "ast/IAstFactory.hpp"
 #include "lib/parser/ast/nodes/class_members/FieldDecl.hpp"
@@ -21,13 +23,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts, bool skip_newlines = true) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (skip_newlines && type == "NEWLINE") {
+    if (skip_newlines && kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -35,9 +36,37 @@ void SkipTrivia(ITokenStream& ts, bool skip_newlines = true) {
   }
 }
 
-bool IsIdentifier(const Token& token) {
+// Position of the first token at or after k that is not a comment or newline, looking ahead without consuming.
+size_t SkipTriviaAhead(const ITokenStream& ts, size_t k) {
+  for (;; ++k) {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind(k);
+    if (kind != lexer::TokenKind::kComment && kind != lexer::TokenKind::kNewline) {
+      return k;
+    }
+  }
+}
+
+bool LexemeAheadIs(ITokenStream& ts, size_t k, std::string_view lexeme) {
+  const Token* token = ts.TryPeek(k);
+  return token != nullptr && token->GetLexeme() == lexeme;
+}
+
+// Whether the member at the cursor is a method, decided by looking past its modifiers rather than consuming them:
+// MethodHdr parses the modifiers itself, and rewinding over them could reach back across any amount of trivia.
+bool IsMethodAhead(ITokenStream& ts) {
+  size_t k = SkipTriviaAhead(ts, 0);
+  if (LexemeAheadIs(ts, k, "public") || LexemeAheadIs(ts, k, "private")) {
+    k = SkipTriviaAhead(ts, k + 1);
+  }
+  if (LexemeAheadIs(ts, k, "override")) {
+    k = SkipTriviaAhead(ts, k + 1);
+  }
+  return LexemeAheadIs(ts, k, "fun");
+}
+
+bool IsIdentifier(ITokenStream& ts) {
   MatchIdentifier matcher;
-  return matcher.TryMatch(token);
+  return matcher.TryMatchKind(ts.Peek(), ts.PeekKind());
 }
 
 std::string ReadIdentifier(const ContextParser& ctx,
@@ -45,7 +74,7 @@ std::string ReadIdentifier(const ContextParser& ctx,
                            std::string_view code,
                            std::string_view message) {
   SkipTrivia(ts);
-  if (ts.IsEof() || !IsIdentifier(ts.Peek())) {
+  if (ts.IsEof() || !IsIdentifier(ts)) {
     if (ctx.Diags() != nullptr) {
       if (const Token* tok = ts.TryPeek(); tok != nullptr) {
         SourceSpan span = StateBase::SpanFrom(*tok);
@@ -63,12 +92,11 @@ std::string ReadIdentifier(const ContextParser& ctx,
 void ConsumeTerminators(ITokenStream& ts) {
   SkipTrivia(ts, false);
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    if (const std::string type = t.GetStringType(); type == "NEWLINE") {
+    if (ts.PeekKind() == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
-    if (t.GetLexeme() == ";") {
+    if (ts.Peek().GetLexeme() == ";") {
       ts.Consume();
       continue;
     }
@@ -94,8 +122,13 @@ IState::StepResult StateClassMember::TryStep(ContextParser& ctx, ITokenStream& t
     return std::unexpected(StateError(std::string_view("unexpected end of file in class member")));
   }
 
+  if (IsMethodAhead(ts)) {
+    ctx.PopState();
+    ctx.PushState(StateRegistry::MethodHdr());
+    return true;
+  }
+
   const Token& start = ts.Peek();
-  const size_t start_index = ts.Position();
   std::string lex = start.GetLexeme();
   SourceSpan span = SpanFrom(start);
 
@@ -187,7 +220,6 @@ IState::StepResult StateClassMember::TryStep(ContextParser& ctx, ITokenStream& t
     return true;
   }
 
-  // Check for method (fun)
   if (lex == "override") {
     ts.Consume();
     SkipTrivia(ts);
@@ -204,13 +236,6 @@ IState::StepResult StateClassMember::TryStep(ContextParser& ctx, ITokenStream& t
     }
   }
 
-  if (lex == "fun") {
-    ts.Rewind(ts.Position() - start_index);
-    ctx.PopState();
-    ctx.PushState(StateRegistry::MethodHdr());
-    return true;
-  }
-
   // Field declaration
   bool is_var = false;
   if (lex == "var" || lex == "val") {
@@ -1,8 +1,11 @@
 #include "StateFuncBody.hpp"
 
 #include <memory>
+#include <optional>
 
 #include "ast/IAstFactory.hpp"
+#include "lib/parser/ast/LazyBody.hpp"
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
 #include "lib/parser/ast/nodes/class_members/CallDecl.hpp"
 #include "lib/parser/ast/nodes/class_members/MethodDecl.hpp"
 #include "lib/parser/ast/nodes/decls/ClassDecl.hpp"
@@ -23,13 +26,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (type == "NEWLINE") {
+    if (kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -68,15 +70,15 @@ IState::StepResult StateFuncBody::TryStep(ContextParser& ctx, ITokenStream& ts)
 
     if (func != nullptr) {
       if (auto* module = ctx.TopNodeAs<Module>(); module != nullptr) {
-        module->AddDecl(std::unique_ptr<Decl>(dynamic_cast<Decl*>(decl_node.release())));
+        module->AddDecl(std::unique_ptr<Decl>(Cast<Decl>(decl_node.release())));
       }
     } else if (method != nullptr) {
       if (auto* class_decl = ctx.TopNodeAs<ClassDecl>(); class_decl != nullptr) {
-        class_decl->AddMember(std::unique_ptr<Decl>(dynamic_cast<Decl*>(decl_node.release())));
+        class_decl->AddMember(std::unique_ptr<Decl>(Cast<Decl>(decl_node.release())));
       }
     } else {
       if (auto* class_decl = ctx.TopNodeAs<ClassDecl>(); class_decl != nullptr) {
-        class_decl->AddMember(std::unique_ptr<Decl>(dynamic_cast<Decl*>(decl_node.release())));
+        class_decl->AddMember(std::unique_ptr<Decl>(Cast<Decl>(decl_node.release())));
       }
     }
     return false;
@@ -117,25 +119,52 @@ IState::StepResult StateFuncBody::TryStep(ContextParser& ctx, ITokenStream& ts)
       func->SetBody(std::move(block));
       auto decl_node = ctx.PopNode();
       if (auto* module = ctx.TopNodeAs<Module>(); module != nullptr) {
-        module->AddDecl(std::unique_ptr<Decl>(dynamic_cast<Decl*>(decl_node.release())));
+        module->AddDecl(std::unique_ptr<Decl>(Cast<Decl>(decl_node.release())));
       }
     } else if (method != nullptr) {
       method->SetBody(std::move(block));
       auto decl_node = ctx.PopNode();
       if (auto* class_decl = ctx.TopNodeAs<ClassDecl>(); class_decl != nullptr) {
-        class_decl->AddMember(std::unique_ptr<Decl>(dynamic_cast<Decl*>(decl_node.release())));
+        class_decl->AddMember(std::unique_ptr<Decl>(Cast<Decl>(decl_node.release())));
       }
     } else {
       call->SetBody(std::move(block));
       auto decl_node = ctx.PopNode();
       if (auto* class_decl = ctx.TopNodeAs<ClassDecl>(); class_decl != nullptr) {
-        class_decl->AddMember(std::unique_ptr<Decl>(dynamic_cast<Decl*>(decl_node.release())));
+        class_decl->AddMember(std::unique_ptr<Decl>(Cast<Decl>(decl_node.release())));
       }
     }
     return false;
   }
 
   if (tok.GetLexeme() == "{") {
+    // Lazy mode: record the braced range and leave the body to be parsed when a pass first asks for it
+    if (const auto& deferred = ctx.DeferredBodies(); deferred != nullptr) {
+      const size_t open = ts.Position();
+
+      if (const std::optional<size_t> end = deferred->FindBodyEnd(open); end.has_value()) {
+        ts.Skip(*end - open);
+        auto decl_node = ctx.PopNode();
+
+        if (func != nullptr) {
+          func->DeferBody(deferred, open, *end);
+          if (auto* module = ctx.TopNodeAs<Module>(); module != nullptr) {
+            module->AddDecl(std::unique_ptr<Decl>(Cast<Decl>(decl_node.release())));
+          }
+        } else {
+          if (method != nullptr) {
+            method->DeferBody(deferred, open, *end);
+          } else {
+            call->DeferBody(deferred, open, *end);
+          }
+          if (auto* class_decl = ctx.TopNodeAs<ClassDecl>(); class_decl != nullptr) {
+            class_decl->AddMember(std::unique_ptr<Decl>(Cast<Decl>(decl_node.release())));
+          }
+        }
+        return false;
+      }
+    }
+
     // Function with body - create block and push it
     ts.Consume();
     auto block = ctx.Factory()->MakeBlock({}, SpanFrom(tok));
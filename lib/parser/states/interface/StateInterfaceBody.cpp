@@ -1,7 +1,9 @@
 #include "StateInterfaceBody.hpp"
 
 #include <memory>
+#include <optional>
 
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
 #include "lib/parser/ast/nodes/decls/InterfaceDecl.hpp"
 #include "lib/parser/ast/nodes/decls/Module.hpp"
 #include "lib/parser/context/ContextParser.hpp"
@@ -15,13 +17,12 @@ namespace {
 
 void SkipTrivia(ITokenStream& ts) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    const std::string type = t.GetStringType();
-    if (type == "COMMENT") {
+    const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+    if (kind == lexer::TokenKind::kComment) {
       ts.Consume();
       continue;
     }
-    if (type == "NEWLINE") {
+    if (kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -51,7 +52,7 @@ IState::StepResult StateInterfaceBody::TryStep(ContextParser& ctx, ITokenStream&
     // Pop interface and add to module
     auto interface_node = ctx.PopNode();
     if (auto* module = ctx.TopNodeAs<Module>(); module != nullptr) {
-      module->AddDecl(std::unique_ptr<Decl>(dynamic_cast<Decl*>(interface_node.release())));
+      module->AddDecl(std::unique_ptr<Decl>(Cast<Decl>(interface_node.release())));
     }
     return false;
   }
@@ -1,28 +1,17 @@
 #include "SourceId.hpp"
 
-#include <filesystem>
-
 namespace ovum::compiler::parser {
 
-std::string_view SourceId::Path() const noexcept {
-  return path_;
-}
-
-std::string SourceId::Basename() const {
-  if (path_.empty()) {
-    return {};
-  }
-
-  std::filesystem::path p(path_);
-  return p.filename().string();
+std::uint32_t SourceId::Value() const noexcept {
+  return value_;
 }
 
 bool SourceId::IsValid() const noexcept {
-  return !path_.empty();
+  return value_ != kInvalid;
 }
 
 bool SourceId::operator==(const SourceId& other) const noexcept {
-  return path_ == other.path_;
+  return value_ == other.value_;
 }
 
 bool SourceId::operator!=(const SourceId& other) const noexcept {
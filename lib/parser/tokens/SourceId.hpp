@@ -1,27 +1,29 @@
 #ifndef PARSER_SOURCEID_HPP_
 #define PARSER_SOURCEID_HPP_
 
-#include <string>
-#include <string_view>
+#include <cstdint>
 
 namespace ovum::compiler::parser {
 
+// 32-bit handle of a source file. The parser does not assign ids yet, so its spans carry the default-constructed id,
+// which names no source.
 class SourceId {
 public:
   SourceId() = default;
-  explicit SourceId(std::string path) : path_(std::move(path)) {
-  }
 
-  [[nodiscard]] std::string_view Path() const noexcept;
+  explicit SourceId(std::uint32_t value) noexcept : value_(value) {
+  }
 
-  [[nodiscard]] std::string Basename() const;
+  [[nodiscard]] std::uint32_t Value() const noexcept;
 
   [[nodiscard]] bool IsValid() const noexcept;
   [[nodiscard]] bool operator==(const SourceId& other) const noexcept;
   [[nodiscard]] bool operator!=(const SourceId& other) const noexcept;
 
 private:
-  std::string path_;
+  static constexpr std::uint32_t kInvalid = 0;
+
+  std::uint32_t value_ = kInvalid;
 };
 
 } // namespace ovum::compiler::parser
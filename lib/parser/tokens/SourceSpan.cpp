@@ -5,11 +5,11 @@
 namespace ovum::compiler::parser {
 
 SourceSpan::SourceSpan(SourceId id, const TokenPosition start, const TokenPosition end) :
-    id_(std::move(id)), begin_(start), end_(end) {
+    id_(id), begin_(start), end_(end) {
   Normalize();
 }
 
-const SourceId& SourceSpan::GetSourceId() const noexcept {
+SourceId SourceSpan::GetSourceId() const noexcept {
   return id_;
 }
 TokenPosition SourceSpan::GetStart() const noexcept {
@@ -30,7 +30,7 @@ void SourceSpan::Normalize() noexcept {
 }
 
 SourceSpan SourceSpan::SinglePoint(SourceId id, TokenPosition point) {
-  return {std::move(id), point, point};
+  return {id, point, point};
 }
 
 SourceSpan SourceSpan::Union(const SourceSpan& a, const SourceSpan& b) {
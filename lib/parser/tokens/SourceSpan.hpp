@@ -6,12 +6,14 @@
 
 namespace ovum::compiler::parser {
 
+// A source id and a pair of positions, with no owned data, so spans are trivially copied into every node and
+// diagnostic. The path behind the id is only looked up when a span is printed.
 class SourceSpan {
 public:
   SourceSpan() = default;
   SourceSpan(SourceId id, TokenPosition start, TokenPosition end);
 
-  [[nodiscard]] const SourceId& GetSourceId() const noexcept;
+  [[nodiscard]] SourceId GetSourceId() const noexcept;
   [[nodiscard]] TokenPosition GetStart() const noexcept;
   [[nodiscard]] TokenPosition GetEnd() const noexcept;
 
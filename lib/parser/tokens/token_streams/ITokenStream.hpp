@@ -1,8 +1,13 @@
 #ifndef PARSER_ITOKENSTREAM_HPP_
 #define PARSER_ITOKENSTREAM_HPP_
 
+#include <optional>
+
 #include <tokens/Token.hpp>
 
+#include "lib/lexer/TokenKind.hpp"
+#include "lib/lexer/literal_decoder.hpp"
+
 namespace ovum::compiler::parser {
 
 class ITokenStream { // NOLINT(cppcoreguidelines-special-member-functions)
@@ -14,10 +19,29 @@ public:
 
   [[nodiscard]] virtual size_t Position() const = 0;
   virtual void Rewind(size_t n) = 0;
+
+  // Moves past the next n tokens, stopping at the end of file. Streams that can do so without materialising the
+  // tokens override this.
+  virtual void Skip(size_t n) {
+    for (; n > 0 && !IsEof(); --n) {
+      (void) Consume();
+    }
+  }
+
   [[nodiscard]] virtual bool IsEof() const = 0;
 
   [[nodiscard]] virtual const Token* LastConsumed() const = 0;
   virtual const Token* TryPeek(size_t k = 0) = 0;
+
+  // Kind of the token at TryPeek(k) without comparing type strings; nullopt past the end and for string types the
+  // lexer never produces, in which case callers fall back to the token itself.
+  [[nodiscard]] virtual std::optional<lexer::TokenKind> PeekKind(size_t k = 0) const = 0;
+
+  // Value of the int or float literal at TryPeek(k), as decoded when the stream built that token. Streams over
+  // finished tokens keep none and return nullopt, in which case callers decode the lexeme.
+  [[nodiscard]] virtual std::optional<lexer::NumericLiteral> PeekNumber(size_t /*k*/ = 0) {
+    return std::nullopt;
+  }
 };
 
 } // namespace ovum::compiler::parser
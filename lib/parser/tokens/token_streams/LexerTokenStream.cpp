@@ -0,0 +1,289 @@
+#include "lib/parser/tokens/token_streams/LexerTokenStream.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "lib/lexer/token_materializer.hpp"
+
+namespace ovum::compiler::parser {
+
+// Lexes views on its own thread and hands them over in batches, at most max_batches ahead of the consumer. Tokens
+// are still materialized on the consumer thread, so the ring is never shared between threads.
+class LexerTokenStream::Producer {
+public:
+  Producer(std::string_view src, size_t batch, size_t max_batches) :
+      lexer_(src), batch_(batch), max_batches_(max_batches), thread_([this]() { Run(); }) {
+  }
+
+  Producer(const Producer&) = delete;
+  Producer& operator=(const Producer&) = delete;
+
+  ~Producer() {
+    {
+      std::lock_guard lock(mutex_);
+      stop_ = true;
+    }
+
+    space_.notify_all();
+    thread_.join();
+  }
+
+  // Blocks until a batch is ready; false once the lexer has ended and every batch was taken, with error set if it
+  // ended on a lexer error.
+  bool Take(std::vector<lexer::TokenView>& out, std::optional<lexer::LexerError>& error) {
+    std::unique_lock lock(mutex_);
+    ready_.wait(lock, [this]() { return !batches_.empty() || done_; });
+
+    if (batches_.empty()) {
+      error = error_;
+      return false;
+    }
+
+    out = std::move(batches_.front());
+    batches_.pop_front();
+    lock.unlock();
+    space_.notify_one();
+
+    return true;
+  }
+
+private:
+  void Run() {
+    bool more = true;
+
+    while (more) {
+      std::vector<lexer::TokenView> batch;
+      batch.reserve(batch_);
+      std::optional<lexer::LexerError> error;
+
+      while (more && batch.size() < batch_) {
+        auto next = lexer_.TokenizeNext(batch);
+
+        if (!next) {
+          error = next.error();
+          more = false;
+        } else {
+          more = next.value();
+        }
+      }
+
+      std::unique_lock lock(mutex_);
+      space_.wait(lock, [this]() { return batches_.size() < max_batches_ || stop_; });
+
+      if (stop_) {
+        return;
+      }
+
+      batches_.push_back(std::move(batch));
+      error_ = std::move(error);
+      done_ = !more;
+      lock.unlock();
+      ready_.notify_one();
+    }
+  }
+
+  lexer::ViewLexer lexer_;
+  size_t batch_;
+  size_t max_batches_;
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::condition_variable space_;
+  std::deque<std::vector<lexer::TokenView>> batches_;
+  std::optional<lexer::LexerError> error_;
+  bool done_ = false;
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+LexerTokenStream::LexerTokenStream(std::string_view src, LexerTokenStreamOptions options) :
+    src_(src), batch_(std::max<size_t>(1, options.batch)), lexer_(src) {
+  const size_t capacity = std::bit_ceil(std::max<size_t>(2, options.window));
+  ring_.resize(capacity);
+  kinds_.resize(capacity);
+  numbers_.resize(capacity);
+
+  if (options.lex_ahead) {
+    producer_ = std::make_unique<Producer>(src, batch_, std::max<size_t>(1, options.max_batches));
+  }
+}
+
+LexerTokenStream::~LexerTokenStream() = default;
+
+const Token& LexerTokenStream::Peek(size_t k) {
+  if (const Token* token = TryPeek(k); token != nullptr) {
+    return *token;
+  }
+
+  if (last_ != nullptr) {
+    return *last_;
+  }
+
+  if (end_ > begin_) {
+    return *ring_[Slot(end_ - 1)];
+  }
+
+  throw std::out_of_range("LexerTokenStream::Peek out of range");
+}
+
+TokenPtr LexerTokenStream::Consume() {
+  if (FillUpTo(index_)) {
+    last_ = ring_[Slot(index_++)];
+    return last_;
+  }
+
+  last_ = nullptr;
+  return nullptr;
+}
+
+size_t LexerTokenStream::Position() const {
+  return index_;
+}
+
+void LexerTokenStream::Rewind(size_t n) {
+  n = std::min(n, index_);
+
+  if (index_ - n < begin_) {
+    throw std::out_of_range("LexerTokenStream::Rewind past the retained window");
+  }
+
+  index_ -= n;
+  last_ = nullptr;
+}
+
+bool LexerTokenStream::IsEof() const {
+  const std::optional<lexer::TokenKind> kind = PeekKind();
+
+  return !kind.has_value() || *kind == lexer::TokenKind::kEof;
+}
+
+const Token* LexerTokenStream::LastConsumed() const {
+  return last_.get();
+}
+
+const Token* LexerTokenStream::TryPeek(size_t k) {
+  if (const size_t pos = index_ + k; FillUpTo(pos)) {
+    return ring_[Slot(pos)].get();
+  }
+
+  return nullptr;
+}
+
+std::optional<lexer::TokenKind> LexerTokenStream::PeekKind(size_t k) const {
+  if (const size_t pos = index_ + k; FillUpTo(pos)) {
+    return kinds_[Slot(pos)];
+  }
+
+  return std::nullopt;
+}
+
+std::optional<lexer::NumericLiteral> LexerTokenStream::PeekNumber(size_t k) {
+  if (const size_t pos = index_ + k; FillUpTo(pos)) {
+    return numbers_[Slot(pos)];
+  }
+
+  return std::nullopt;
+}
+
+const std::optional<lexer::LexerError>& LexerTokenStream::Error() const noexcept {
+  return error_;
+}
+
+size_t LexerTokenStream::Capacity() const noexcept {
+  return ring_.size();
+}
+
+bool LexerTokenStream::FillUpTo(size_t pos) const {
+  while (end_ <= pos && !finished_) {
+    if (pending_index_ == pending_.size() && !PullViews()) {
+      // Only reached on a lexer error: a clean end always delivers the EOF view, which sets finished_.
+      const uint32_t end_offset = last_view_.offset + last_view_.length;
+      Push(lexer::TokenView{.kind = lexer::TokenKind::kEof,
+                            .offset = end_offset,
+                            .length = 0,
+                            .line = last_view_.line,
+                            .column = last_view_.column + static_cast<int32_t>(last_view_.length)});
+      break;
+    }
+
+    Push(pending_[pending_index_++]);
+  }
+
+  return pos < end_;
+}
+
+bool LexerTokenStream::PullViews() const {
+  pending_.clear();
+  pending_index_ = 0;
+
+  if (producer_ != nullptr) {
+    while (pending_.empty()) {
+      if (!producer_->Take(pending_, error_)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  while (pending_.size() < batch_) {
+    auto next = lexer_.TokenizeNext(pending_);
+
+    if (!next) {
+      error_ = next.error();
+      break;
+    }
+
+    if (!next.value()) {
+      break;
+    }
+  }
+
+  return !pending_.empty();
+}
+
+void LexerTokenStream::Push(const lexer::TokenView& view) const {
+  if (end_ - begin_ == ring_.size()) {
+    if (begin_ < index_) {
+      ++begin_;
+    } else {
+      Grow();
+    }
+  }
+
+  ring_[Slot(end_)] = lexer::MaterializeToken(view, src_, &numbers_[Slot(end_)]);
+  kinds_[Slot(end_)] = view.kind;
+  last_view_ = view;
+  ++end_;
+
+  if (view.kind == lexer::TokenKind::kEof) {
+    finished_ = true;
+  }
+}
+
+void LexerTokenStream::Grow() const {
+  std::vector<TokenPtr> ring(ring_.size() * 2);
+  std::vector<lexer::TokenKind> kinds(kinds_.size() * 2);
+  std::vector<std::optional<lexer::NumericLiteral>> numbers(numbers_.size() * 2);
+
+  for (size_t pos = begin_; pos < end_; ++pos) {
+    ring[pos & (ring.size() - 1)] = std::move(ring_[Slot(pos)]);
+    kinds[pos & (kinds.size() - 1)] = kinds_[Slot(pos)];
+    numbers[pos & (numbers.size() - 1)] = numbers_[Slot(pos)];
+  }
+
+  ring_ = std::move(ring);
+  kinds_ = std::move(kinds);
+  numbers_ = std::move(numbers);
+}
+
+size_t LexerTokenStream::Slot(size_t pos) const noexcept {
+  return pos & (ring_.size() - 1);
+}
+
+} // namespace ovum::compiler::parser
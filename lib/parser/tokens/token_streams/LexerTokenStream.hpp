@@ -0,0 +1,102 @@
+#ifndef PARSER_LEXERTOKENSTREAM_HPP_
+#define PARSER_LEXERTOKENSTREAM_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <tokens/Token.hpp>
+
+#include "ITokenStream.hpp"
+#include "lib/lexer/LexerError.hpp"
+#include "lib/lexer/TokenView.hpp"
+#include "lib/lexer/ViewLexer.hpp"
+
+namespace ovum::compiler::parser {
+
+// The parser rewinds by one token at most and looks further ahead with PeekKind/TryPeek, which grow the window.
+inline constexpr size_t kDefaultLexerStreamWindow = 256;
+inline constexpr size_t kDefaultLexerStreamBatch = 1024;
+
+struct LexerTokenStreamOptions {
+  size_t window = kDefaultLexerStreamWindow; // tokens kept for lookahead and Rewind, rounded up to a power of two
+  bool lex_ahead = false;                    // lex on a producer thread while the parser consumes
+  size_t batch = kDefaultLexerStreamBatch;   // views handed over by the producer at a time
+  size_t max_batches = 4;                    // batches the producer may run ahead by
+};
+
+// Token stream that lexes the source on demand instead of wrapping a finished token vector, so parsing starts
+// before lexing ends and memory stays bounded by the window. Only the last window tokens are retained: rewinding
+// further throws std::out_of_range.
+// A lexer error ends the stream with an EOF token; check Error() after parsing. The source must outlive the stream.
+class LexerTokenStream : public ITokenStream {
+public:
+  explicit LexerTokenStream(std::string_view src, LexerTokenStreamOptions options = {});
+
+  LexerTokenStream(const LexerTokenStream&) = delete;
+  LexerTokenStream& operator=(const LexerTokenStream&) = delete;
+
+  ~LexerTokenStream() override;
+
+  const Token& Peek(size_t k = 0) override;
+
+  TokenPtr Consume() override;
+
+  [[nodiscard]] size_t Position() const override;
+
+  void Rewind(size_t n) override;
+
+  [[nodiscard]] bool IsEof() const override;
+
+  [[nodiscard]] const Token* LastConsumed() const override;
+
+  const Token* TryPeek(size_t k = 0) override;
+
+  [[nodiscard]] std::optional<lexer::TokenKind> PeekKind(size_t k = 0) const override;
+
+  [[nodiscard]] std::optional<lexer::NumericLiteral> PeekNumber(size_t k = 0) override;
+
+  [[nodiscard]] const std::optional<lexer::LexerError>& Error() const noexcept;
+
+  [[nodiscard]] size_t Capacity() const noexcept;
+
+private:
+  class Producer;
+
+  // Lexes until the token at absolute position pos exists or the stream has ended; true if it exists.
+  bool FillUpTo(size_t pos) const;
+
+  bool PullViews() const;
+
+  void Push(const lexer::TokenView& view) const;
+
+  void Grow() const;
+
+  [[nodiscard]] size_t Slot(size_t pos) const noexcept;
+
+  std::string_view src_;
+  size_t batch_;
+
+  // Lexed lazily, also from the const lookahead calls.
+  mutable lexer::ViewLexer lexer_;
+  mutable std::unique_ptr<Producer> producer_;
+  mutable std::vector<lexer::TokenView> pending_;
+  mutable size_t pending_index_ = 0;
+  mutable std::vector<TokenPtr> ring_;
+  mutable std::vector<lexer::TokenKind> kinds_;
+  mutable std::vector<std::optional<lexer::NumericLiteral>> numbers_;
+  mutable size_t begin_ = 0;
+  mutable size_t end_ = 0;
+  mutable bool finished_ = false;
+  mutable std::optional<lexer::LexerError> error_;
+  mutable lexer::TokenView last_view_{};
+
+  size_t index_ = 0;
+  TokenPtr last_;
+};
+
+} // namespace ovum::compiler::parser
+
+#endif // PARSER_LEXERTOKENSTREAM_HPP_
@@ -0,0 +1,152 @@
+#include "lib/parser/tokens/token_streams/TokenBufferStream.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+#include "lib/lexer/token_materializer.hpp"
+
+namespace ovum::compiler::parser {
+
+namespace {
+
+size_t RingCapacity(size_t window, size_t size) {
+  return std::bit_ceil(std::max<size_t>(2, std::min(window, size)));
+}
+
+} // namespace
+
+TokenBufferStream::TokenBufferStream(const lexer::TokenBuffer& tokens, size_t window) :
+    tokens_(tokens), size_(tokens.Size()), ring_(RingCapacity(window, size_)) {
+}
+
+TokenBufferStream::TokenBufferStream(const lexer::TokenBuffer& tokens, size_t begin, size_t end, size_t window) :
+    tokens_(tokens), begin_(begin), size_(end - begin + 1), ring_(RingCapacity(window, size_)) {
+}
+
+const Token& TokenBufferStream::Peek(size_t k) {
+  if (const Token* token = TryPeek(k); token != nullptr) {
+    return *token;
+  }
+
+  if (last_) {
+    return *last_;
+  }
+
+  if (size_ != 0) {
+    return *SlotAt(size_ - 1).token;
+  }
+
+  throw std::out_of_range("TokenBufferStream::Peek out of range");
+}
+
+TokenPtr TokenBufferStream::Consume() {
+  if (index_ < size_) {
+    last_ = SlotAt(index_++).token;
+    return last_;
+  }
+
+  last_.reset();
+  return nullptr;
+}
+
+size_t TokenBufferStream::Position() const {
+  return index_;
+}
+
+void TokenBufferStream::Rewind(size_t n) {
+  if (n > index_) {
+    index_ = 0;
+  } else {
+    index_ -= n;
+  }
+
+  last_.reset();
+}
+
+void TokenBufferStream::Skip(size_t n) {
+  if (n == 0 || IsEof()) {
+    return;
+  }
+
+  index_ = std::min(index_ + n, size_ - 1);
+  last_ = SlotAt(index_ - 1).token;
+}
+
+bool TokenBufferStream::IsEof() const {
+  return size_ == 0 || index_ >= size_ - 1;
+}
+
+const Token* TokenBufferStream::LastConsumed() const {
+  return last_.get();
+}
+
+const Token* TokenBufferStream::TryPeek(size_t k) {
+  if (const size_t pos = index_ + k; pos < size_) {
+    return SlotAt(pos).token.get();
+  }
+
+  return nullptr;
+}
+
+std::optional<lexer::TokenKind> TokenBufferStream::PeekKind(size_t k) const {
+  if (const size_t pos = index_ + k; pos < size_) {
+    return tokens_.Kind(BufferIndex(pos));
+  }
+
+  return std::nullopt;
+}
+
+std::optional<lexer::NumericLiteral> TokenBufferStream::PeekNumber(size_t k) {
+  if (const size_t pos = index_ + k; pos < size_) {
+    return SlotAt(pos).number;
+  }
+
+  return std::nullopt;
+}
+
+size_t TokenBufferStream::Size() const {
+  return size_;
+}
+
+size_t TokenBufferStream::Capacity() const noexcept {
+  return ring_.size();
+}
+
+const TokenBufferStream::Slot& TokenBufferStream::SlotAt(size_t pos) {
+  Slot* slot = &ring_[pos & (ring_.size() - 1)];
+
+  if (slot->token && slot->pos == pos) {
+    return *slot;
+  }
+
+  // Tokens between the cursor and pos may still be referenced through Peek; ones behind the cursor, or left past pos
+  // by a Rewind, are given up.
+  if (slot->token && slot->pos >= index_ && slot->pos < pos) {
+    Grow();
+    slot = &ring_[pos & (ring_.size() - 1)];
+  }
+
+  const size_t index = BufferIndex(pos);
+  slot->pos = pos;
+  slot->token = lexer::MaterializeToken(tokens_.View(index), tokens_.Source(tokens_.SourceOf(index)), &slot->number);
+  return *slot;
+}
+
+void TokenBufferStream::Grow() {
+  std::vector<Slot> ring(ring_.size() * 2);
+
+  for (Slot& slot : ring_) {
+    if (slot.token) {
+      ring[slot.pos & (ring.size() - 1)] = std::move(slot);
+    }
+  }
+
+  ring_ = std::move(ring);
+}
+
+size_t TokenBufferStream::BufferIndex(size_t pos) const noexcept {
+  return pos + 1 == size_ ? tokens_.Size() - 1 : begin_ + pos;
+}
+
+} // namespace ovum::compiler::parser
@@ -0,0 +1,76 @@
+#ifndef PARSER_TOKENBUFFERSTREAM_HPP_
+#define PARSER_TOKENBUFFERSTREAM_HPP_
+
+#include <optional>
+#include <vector>
+
+#include <tokens/Token.hpp>
+
+#include "ITokenStream.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+
+namespace ovum::compiler::parser {
+
+inline constexpr size_t kDefaultTokenBufferStreamWindow = 256;
+
+// Token stream over a struct-of-arrays lexer::TokenBuffer. Like ViewTokenStream, Token objects are only built for
+// positions the parser looks at; a numeric literal's decoded value is kept next to its token for PeekNumber.
+// Built tokens live in a ring of about window slots, so a token behind the cursor is freed once a later position takes
+// its slot; the ring grows instead when the parser looks further ahead. Rewinding past the ring builds the token again
+// from the buffer. The buffer and its sources must outlive the stream.
+class TokenBufferStream : public ITokenStream {
+public:
+  explicit TokenBufferStream(const lexer::TokenBuffer& tokens, size_t window = kDefaultTokenBufferStreamWindow);
+
+  // Only tokens [begin, end) of the buffer, followed by its final (end of file) token, which must not be in the range.
+  TokenBufferStream(const lexer::TokenBuffer& tokens,
+                    size_t begin,
+                    size_t end,
+                    size_t window = kDefaultTokenBufferStreamWindow);
+
+  const Token& Peek(size_t k = 0) override;
+
+  TokenPtr Consume() override;
+
+  [[nodiscard]] size_t Position() const override;
+
+  void Rewind(size_t n) override;
+
+  void Skip(size_t n) override;
+
+  [[nodiscard]] bool IsEof() const override;
+
+  [[nodiscard]] const Token* LastConsumed() const override;
+
+  const Token* TryPeek(size_t k = 0) override;
+
+  [[nodiscard]] std::optional<lexer::TokenKind> PeekKind(size_t k = 0) const override;
+
+  [[nodiscard]] std::optional<lexer::NumericLiteral> PeekNumber(size_t k = 0) override;
+
+  [[nodiscard]] size_t Size() const;
+
+  [[nodiscard]] size_t Capacity() const noexcept;
+
+private:
+  struct Slot {
+    size_t pos = 0;
+    TokenPtr token;
+    std::optional<lexer::NumericLiteral> number;
+  };
+
+  const Slot& SlotAt(size_t pos);
+  void Grow();
+  [[nodiscard]] size_t BufferIndex(size_t pos) const noexcept;
+
+  const lexer::TokenBuffer& tokens_;
+  size_t begin_ = 0;
+  size_t size_ = 0;
+  std::vector<Slot> ring_;
+  size_t index_ = 0;
+  TokenPtr last_;
+};
+
+} // namespace ovum::compiler::parser
+
+#endif // PARSER_TOKENBUFFERSTREAM_HPP_
@@ -3,9 +3,16 @@
 #include <stdexcept>
 #include <utility>
 
+#include "lib/lexer/token_materializer.hpp"
+
 namespace ovum::compiler::parser {
 
 VectorTokenStream::VectorTokenStream(std::vector<TokenPtr> tokens) : tokens_(std::move(tokens)) {
+  kinds_.reserve(tokens_.size());
+
+  for (const TokenPtr& token : tokens_) {
+    kinds_.push_back(lexer::TokenKindFromString(token->GetStringType()));
+  }
 }
 
 const Token& VectorTokenStream::Peek(size_t k) {
@@ -64,6 +71,14 @@ const Token* VectorTokenStream::TryPeek(size_t k) {
   return nullptr;
 }
 
+std::optional<lexer::TokenKind> VectorTokenStream::PeekKind(size_t k) const {
+  if (const size_t pos = index_ + k; pos < kinds_.size()) {
+    return kinds_[pos];
+  }
+
+  return std::nullopt;
+}
+
 size_t VectorTokenStream::Size() const {
   return tokens_.size();
 }
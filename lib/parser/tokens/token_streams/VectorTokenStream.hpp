@@ -1,6 +1,7 @@
 #ifndef PARSER_VECTORTOKENSTREAM_HPP_
 #define PARSER_VECTORTOKENSTREAM_HPP_
 
+#include <optional>
 #include <vector>
 
 #include <tokens/Token.hpp>
@@ -9,6 +10,7 @@
 
 namespace ovum::compiler::parser {
 
+// Token stream over already materialized tokens. Token kinds are resolved from the type strings once, up front.
 class VectorTokenStream : public ITokenStream {
 public:
   explicit VectorTokenStream(std::vector<TokenPtr> tokens);
@@ -27,10 +29,13 @@ public:
 
   const Token* TryPeek(size_t k = 0) override;
 
+  [[nodiscard]] std::optional<lexer::TokenKind> PeekKind(size_t k = 0) const override;
+
   [[nodiscard]] size_t Size() const;
 
 private:
   std::vector<TokenPtr> tokens_;
+  std::vector<std::optional<lexer::TokenKind>> kinds_;
   size_t index_ = 0;
   const Token* last_ = nullptr;
 };
@@ -0,0 +1,101 @@
+#include "lib/parser/tokens/token_streams/ViewTokenStream.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#include "lib/lexer/token_materializer.hpp"
+
+namespace ovum::compiler::parser {
+
+ViewTokenStream::ViewTokenStream(std::vector<lexer::TokenView> views, std::string_view src) :
+    views_(std::move(views)), src_(src), materialized_(views_.size()) {
+}
+
+const Token& ViewTokenStream::Peek(size_t k) {
+  if (const Token* token = TryPeek(k); token != nullptr) {
+    return *token;
+  }
+
+  if (last_ != nullptr) {
+    return *last_;
+  }
+
+  if (!views_.empty()) {
+    return *TokenAt(views_.size() - 1);
+  }
+
+  throw std::out_of_range("ViewTokenStream::Peek out of range");
+}
+
+TokenPtr ViewTokenStream::Consume() {
+  if (index_ < views_.size()) {
+    const TokenPtr& token = TokenAt(index_++);
+    last_ = token.get();
+    return token;
+  }
+
+  last_ = nullptr;
+  return nullptr;
+}
+
+size_t ViewTokenStream::Position() const {
+  return index_;
+}
+
+void ViewTokenStream::Rewind(size_t n) {
+  if (n > index_) {
+    index_ = 0;
+  } else {
+    index_ -= n;
+  }
+
+  last_ = nullptr;
+}
+
+bool ViewTokenStream::IsEof() const {
+  return index_ >= views_.size() - 1;
+}
+
+const Token* ViewTokenStream::LastConsumed() const {
+  return last_;
+}
+
+const Token* ViewTokenStream::TryPeek(size_t k) {
+  if (const size_t pos = index_ + k; pos < views_.size()) {
+    return TokenAt(pos).get();
+  }
+
+  return nullptr;
+}
+
+std::optional<lexer::TokenKind> ViewTokenStream::PeekKind(size_t k) const {
+  if (const size_t pos = index_ + k; pos < views_.size()) {
+    return views_[pos].kind;
+  }
+
+  return std::nullopt;
+}
+
+const lexer::TokenView* ViewTokenStream::TryPeekView(size_t k) const {
+  if (const size_t pos = index_ + k; pos < views_.size()) {
+    return &views_[pos];
+  }
+
+  return nullptr;
+}
+
+size_t ViewTokenStream::Size() const {
+  return views_.size();
+}
+
+const TokenPtr& ViewTokenStream::TokenAt(size_t pos) {
+  TokenPtr& slot = materialized_[pos];
+
+  if (!slot) {
+    slot = lexer::MaterializeToken(views_[pos], src_);
+  }
+
+  return slot;
+}
+
+} // namespace ovum::compiler::parser
@@ -0,0 +1,54 @@
+#ifndef PARSER_VIEWTOKENSTREAM_HPP_
+#define PARSER_VIEWTOKENSTREAM_HPP_
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <tokens/Token.hpp>
+
+#include "ITokenStream.hpp"
+#include "lib/lexer/TokenView.hpp"
+
+namespace ovum::compiler::parser {
+
+// Token stream over lexer::TokenView records. Token objects are only built for positions the parser
+// actually looks at, and are cached so repeated Peek/Rewind cycles stay cheap.
+// The source buffer must outlive the stream.
+class ViewTokenStream : public ITokenStream {
+public:
+  ViewTokenStream(std::vector<lexer::TokenView> views, std::string_view src);
+
+  const Token& Peek(size_t k = 0) override;
+
+  TokenPtr Consume() override;
+
+  [[nodiscard]] size_t Position() const override;
+
+  void Rewind(size_t n) override;
+
+  [[nodiscard]] bool IsEof() const override;
+
+  [[nodiscard]] const Token* LastConsumed() const override;
+
+  const Token* TryPeek(size_t k = 0) override;
+
+  [[nodiscard]] std::optional<lexer::TokenKind> PeekKind(size_t k = 0) const override;
+
+  [[nodiscard]] const lexer::TokenView* TryPeekView(size_t k = 0) const;
+
+  [[nodiscard]] size_t Size() const;
+
+private:
+  const TokenPtr& TokenAt(size_t pos);
+
+  std::vector<lexer::TokenView> views_;
+  std::string_view src_;
+  std::vector<TokenPtr> materialized_;
+  size_t index_ = 0;
+  const Token* last_ = nullptr;
+};
+
+} // namespace ovum::compiler::parser
+
+#endif // PARSER_VIEWTOKENSTREAM_HPP_
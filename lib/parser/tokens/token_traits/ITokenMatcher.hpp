@@ -1,6 +1,9 @@
 #ifndef PARSER_ITOKENMATCHER_HPP_
 #define PARSER_ITOKENMATCHER_HPP_
 
+#include <optional>
+
+#include "lib/lexer/TokenKind.hpp"
 #include "tokens/Token.hpp"
 
 namespace ovum::compiler::parser {
@@ -9,6 +12,12 @@ class ITokenMatcher { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
   virtual ~ITokenMatcher() = default;
   [[nodiscard]] virtual bool TryMatch(const Token& token) const = 0;
+
+  // Same answer as TryMatch, for callers that already know the token kind (see ITokenStream::PeekKind); this lets
+  // matchers skip the type and lexeme strings. A nullopt kind always falls back to TryMatch.
+  [[nodiscard]] virtual bool TryMatchKind(const Token& token, std::optional<lexer::TokenKind> /* kind */) const {
+    return TryMatch(token);
+  }
 };
 
 } // namespace ovum::compiler::parser
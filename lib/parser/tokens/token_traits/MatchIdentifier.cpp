@@ -7,4 +7,12 @@ bool MatchIdentifier::TryMatch(const Token& token) const {
   return type == "IDENT";
 }
 
+bool MatchIdentifier::TryMatchKind(const Token& token, const std::optional<lexer::TokenKind> kind) const {
+  if (kind.has_value()) {
+    return *kind == lexer::TokenKind::kIdent;
+  }
+
+  return TryMatch(token);
+}
+
 } // namespace ovum::compiler::parser
@@ -1,6 +1,8 @@
 #ifndef PARSER_MATCHIDENTIFIER_HPP_
 #define PARSER_MATCHIDENTIFIER_HPP_
 
+#include <optional>
+
 #include "ITokenMatcher.hpp"
 #include "tokens/Token.hpp"
 
@@ -9,6 +11,7 @@ namespace ovum::compiler::parser {
 class MatchIdentifier : public ITokenMatcher {
 public:
   [[nodiscard]] bool TryMatch(const Token& token) const override;
+  [[nodiscard]] bool TryMatchKind(const Token& token, std::optional<lexer::TokenKind> kind) const override;
 };
 
 } // namespace ovum::compiler::parser
@@ -1,12 +1,35 @@
 #include "MatchLexeme.hpp"
 
+#include "lib/lexer/char_class.hpp"
+
 namespace ovum::compiler::parser {
 
-MatchLexeme::MatchLexeme(const std::string_view lexeme) : lexeme_(lexeme) {
+namespace {
+
+bool IsWordKind(const lexer::TokenKind kind) noexcept {
+  return kind == lexer::TokenKind::kIdent || kind == lexer::TokenKind::kKeyword ||
+         kind == lexer::TokenKind::kBoolLiteral;
+}
+
+} // namespace
+
+MatchLexeme::MatchLexeme(const std::string_view lexeme) :
+    lexeme_(lexeme),
+    word_like_(!lexeme.empty() && lexer::ClassifyChar(lexeme.front()) == lexer::CharClass::kIdentStart) {
 }
 
 bool MatchLexeme::TryMatch(const Token& token) const {
   return token.GetLexeme() == lexeme_;
 }
 
+bool MatchLexeme::TryMatchKind(const Token& token, const std::optional<lexer::TokenKind> kind) const {
+  // Identifiers, keywords and bool literals start with an identifier character and other kinds never do (float
+  // literals aside: Inf and NaN), so a kind on the wrong side of that line cannot carry this lexeme.
+  if (kind.has_value() && *kind != lexer::TokenKind::kFloatLiteral && IsWordKind(*kind) != word_like_) {
+    return false;
+  }
+
+  return TryMatch(token);
+}
+
 } // namespace ovum::compiler::parser
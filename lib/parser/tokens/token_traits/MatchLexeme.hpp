@@ -1,6 +1,7 @@
 #ifndef PARSER_MATCHLEXEME_HPP_
 #define PARSER_MATCHLEXEME_HPP_
 
+#include <optional>
 #include <string_view>
 
 #include "ITokenMatcher.hpp"
@@ -12,9 +13,11 @@ class MatchLexeme : public ITokenMatcher {
 public:
   explicit MatchLexeme(std::string_view lexeme);
   [[nodiscard]] bool TryMatch(const Token& token) const override;
+  [[nodiscard]] bool TryMatchKind(const Token& token, std::optional<lexer::TokenKind> kind) const override;
 
 private:
   std::string_view lexeme_;
+  bool word_like_;
 };
 
 } // namespace ovum::compiler::parser
@@ -10,4 +10,12 @@ bool MatchLiteral::TryMatch(const Token& token) const {
   return type.starts_with("LITERAL:");
 }
 
+bool MatchLiteral::TryMatchKind(const Token& token, const std::optional<lexer::TokenKind> kind) const {
+  if (kind.has_value()) {
+    return lexer::IsLiteralKind(*kind);
+  }
+
+  return TryMatch(token);
+}
+
 } // namespace ovum::compiler::parser
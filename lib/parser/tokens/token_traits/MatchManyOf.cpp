@@ -14,4 +14,13 @@ bool MatchAnyOf::TryMatch(const Token& token) const {
   return false;
 }
 
+bool MatchAnyOf::TryMatchKind(const Token& token, const std::optional<lexer::TokenKind> kind) const {
+  for (const auto& m : matchers_) {
+    if (m && m->TryMatchKind(token, kind)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 } // namespace ovum::compiler::parser
@@ -2,6 +2,7 @@
 #define PARSER_MATCHMANYOF_HPP_
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "ITokenMatcher.hpp"
@@ -13,6 +14,7 @@ class MatchAnyOf : public ITokenMatcher {
 public:
   explicit MatchAnyOf(std::vector<std::unique_ptr<ITokenMatcher>> matchers);
   [[nodiscard]] bool TryMatch(const Token& token) const override;
+  [[nodiscard]] bool TryMatchKind(const Token& token, std::optional<lexer::TokenKind> kind) const override;
 
 private:
   std::vector<std::unique_ptr<ITokenMatcher>> matchers_;
@@ -1,12 +1,24 @@
 #include "MatchType.hpp"
 
+#include "lib/lexer/token_materializer.hpp"
+
 namespace ovum::compiler::parser {
 
-MatchType::MatchType(const std::string_view type_name) : type_(type_name) {
+MatchType::MatchType(const std::string_view type_name) :
+    type_(type_name), kind_(lexer::TokenKindFromString(type_name)) {
 }
 
 bool MatchType::TryMatch(const Token& token) const {
   return token.GetStringType() == type_;
 }
 
+bool MatchType::TryMatchKind(const Token& token, const std::optional<lexer::TokenKind> kind) const {
+  // Kinds and type names map one to one, so two known kinds decide the match on their own.
+  if (kind.has_value() && kind_.has_value()) {
+    return *kind == *kind_;
+  }
+
+  return TryMatch(token);
+}
+
 } // namespace ovum::compiler::parser
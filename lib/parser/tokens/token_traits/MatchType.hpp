@@ -1,6 +1,7 @@
 #ifndef PARSER_MATCHTYPE_HPP_
 #define PARSER_MATCHTYPE_HPP_
 
+#include <optional>
 #include <string_view>
 
 #include "ITokenMatcher.hpp"
@@ -12,9 +13,11 @@ class MatchType : public ITokenMatcher {
 public:
   explicit MatchType(std::string_view type_name);
   [[nodiscard]] bool TryMatch(const Token& token) const override;
+  [[nodiscard]] bool TryMatchKind(const Token& token, std::optional<lexer::TokenKind> kind) const override;
 
 private:
   std::string_view type_;
+  std::optional<lexer::TokenKind> kind_;
 };
 
 } // namespace ovum::compiler::parser
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <optional>
 #include <string>
 
 #include "lib/parser/diagnostics/IDiagnosticSink.hpp"
@@ -12,28 +13,28 @@ namespace ovum::compiler::parser {
 
 namespace {
 
-bool IsIdentifier(const Token& token) {
+bool IsIdentifier(ITokenStream& ts) {
   const MatchIdentifier matcher;
-  return matcher.TryMatch(token);
+  return matcher.TryMatchKind(ts.Peek(), ts.PeekKind());
 }
 
-bool IsTypeNameToken(const Token& token) {
+bool IsTypeNameToken(ITokenStream& ts) {
   // Built-in types are lexed as keywords, user types as identifiers.
-  if (IsIdentifier(token)) {
+  if (IsIdentifier(ts)) {
     return true;
   }
 
   static constexpr std::array<std::string_view, 8> kBuiltins{
       "Int", "Float", "Bool", "Char", "String", "Void", "Object", "Null"};
 
-  const std::string lex = token.GetLexeme();
+  const std::string lex = ts.Peek().GetLexeme();
   return std::ranges::find(kBuiltins, lex) != kBuiltins.end();
 }
 
 void SkipTrivia(ITokenStream& ts) {
   while (!ts.IsEof()) {
-    const Token& t = ts.Peek();
-    if (const std::string type = t.GetStringType(); type == "COMMENT" || type == "NEWLINE") {
+    if (const std::optional<lexer::TokenKind> kind = ts.PeekKind();
+        kind == lexer::TokenKind::kComment || kind == lexer::TokenKind::kNewline) {
       ts.Consume();
       continue;
     }
@@ -55,15 +56,13 @@ std::unique_ptr<TypeReference> QNameTypeParser::ParseType(ITokenStream& ts, IDia
     return nullptr;
   }
 
-  const Token& start = ts.Peek();
-  if (!IsTypeNameToken(start)) {
+  if (!IsTypeNameToken(ts)) {
     diags.Error("E_TYPE_NAME", "expected type name");
     return nullptr;
   }
 
   std::vector<std::string> parts;
-  parts.emplace_back(start.GetLexeme());
-  ts.Consume();
+  parts.emplace_back(ts.Consume()->GetLexeme());
 
   SkipTrivia(ts);
   while (!ts.IsEof()) {
@@ -75,7 +74,7 @@ std::unique_ptr<TypeReference> QNameTypeParser::ParseType(ITokenStream& ts, IDia
     ts.Consume();
     SkipTrivia(ts);
 
-    if (ts.IsEof() || !IsTypeNameToken(ts.Peek())) {
+    if (ts.IsEof() || !IsTypeNameToken(ts)) {
       diags.Error("E_TYPE_QUAL", "expected identifier after namespace separator");
       return nullptr;
     }
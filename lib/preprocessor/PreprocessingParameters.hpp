@@ -1,17 +1,24 @@
 #ifndef PREPROCESSOR_PREPROCESSINGPARAMETERS_HPP_
 #define PREPROCESSOR_PREPROCESSINGPARAMETERS_HPP_
 
+#include <cstddef>
 #include <filesystem>
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_set>
 
+#include "lib/preprocessor/import_processor/IncludeResolver.hpp"
+
 namespace ovum::compiler::preprocessor {
 
 struct PreprocessingParameters {
   std::set<std::filesystem::path> include_paths;
   std::unordered_set<std::string> predefined_symbols;
   std::filesystem::path main_file;
+  std::size_t import_threads = 0; // threads reading and lexing imports; 0 picks the hardware concurrency, 1 is serial
+  std::filesystem::path token_cache_dir; // optional; imported files are lexed once per content into this directory
+  std::shared_ptr<IncludeResolver> include_resolver; // optional; share one to keep directory listings across runs
 };
 
 } // namespace ovum::compiler::preprocessor
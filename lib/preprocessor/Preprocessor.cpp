@@ -1,9 +1,10 @@
 #include "Preprocessor.hpp"
 
-#include <fstream>
 #include <utility>
 
 #include "lib/lexer/Lexer.hpp"
+#include "lib/lexer/parallel_lexer.hpp"
+#include "lib/lexer/source/SourceBuffer.hpp"
 #include "token_processor_factory.hpp"
 
 namespace ovum::compiler::preprocessor {
@@ -13,38 +14,78 @@ Preprocessor::Preprocessor(const PreprocessingParameters& parameters) :
 }
 
 std::expected<std::vector<TokenPtr>, PreprocessorError> Preprocessor::Process() {
-  std::filesystem::path file = parameters_.main_file;
+  std::expected<std::vector<TokenPtr>, PreprocessorError> tokens_result = LexMainFile();
 
-  if (!std::filesystem::exists(file)) {
-    return std::unexpected(FileNotFoundError(file.string()));
+  if (!tokens_result) {
+    return std::unexpected(tokens_result.error());
   }
 
-  std::ifstream file_stream(file, std::ios::binary);
+  std::vector<TokenPtr> tokens = std::move(tokens_result.value());
+
+  for (std::unique_ptr<TokenProcessor>& processor : token_processors_) {
+    std::expected<std::vector<TokenPtr>, PreprocessorError> processor_result = processor->Process(tokens);
+
+    if (!processor_result) {
+      return std::unexpected(processor_result.error());
+    }
 
-  if (!file_stream.is_open()) {
-    return std::unexpected(FileReadError(file.string(), "Cannot open"));
+    tokens = std::move(processor_result.value());
   }
 
-  std::string content((std::istreambuf_iterator<char>(file_stream)), std::istreambuf_iterator<char>());
+  return {std::move(tokens)};
+}
 
-  if (file_stream.bad() || file_stream.fail()) {
-    return std::unexpected(FileReadError(file.string(), "Read error"));
+std::expected<std::vector<TokenPtr>, PreprocessorError> Preprocessor::LexMainFile() const {
+  std::filesystem::path file = parameters_.main_file;
+
+  if (!std::filesystem::exists(file)) {
+    return std::unexpected(FileNotFoundError(file.string()));
   }
 
-  lexer::Lexer lexer(content, false);
+  // Tokens own their lexemes here, so the mapping only has to live until the file is lexed.
+  std::expected<std::unique_ptr<lexer::SourceBuffer>, lexer::LexerError> source_result =
+      lexer::SourceBuffer::MapFile(file);
+
+  if (!source_result) {
+    return std::unexpected(FileReadError(file.string(), source_result.error().what()));
+  }
+
+  lexer::Lexer lexer(source_result.value()->Text(), false);
+  lexer.EnableParallel();
   auto tokens_result = lexer.Tokenize();
 
   if (!tokens_result) {
     return std::unexpected(PreprocessorError(tokens_result.error().what()));
   }
 
-  std::vector<TokenPtr> tokens = std::move(tokens_result.value());
+  return {std::move(tokens_result.value())};
+}
+
+std::expected<lexer::TokenBuffer, PreprocessorError> Preprocessor::Process(lexer::SourceManager& sources) {
+  std::filesystem::path file = parameters_.main_file;
+
+  if (!std::filesystem::exists(file)) {
+    return std::unexpected(FileNotFoundError(file.string()));
+  }
+
+  std::expected<const lexer::SourceBuffer*, lexer::LexerError> source_result = sources.Load(file);
+
+  if (!source_result) {
+    return std::unexpected(FileReadError(file.string(), source_result.error().what()));
+  }
+
+  lexer::TokenBuffer tokens;
+
+  if (auto tokens_result = lexer::TokenizeIntoParallel(source_result.value()->Text(), tokens); !tokens_result) {
+    return std::unexpected(PreprocessorError(tokens_result.error().what()));
+  }
 
   for (std::unique_ptr<TokenProcessor>& processor : token_processors_) {
-    std::expected<std::vector<TokenPtr>, PreprocessorError> processor_result = std::move(processor->Process(tokens));
+    std::expected<lexer::TokenBuffer, PreprocessorError> processor_result =
+        processor->Process(std::move(tokens), sources);
 
     if (!processor_result) {
-      return processor_result;
+      return std::unexpected(processor_result.error());
     }
 
     tokens = std::move(processor_result.value());
@@ -7,6 +7,8 @@
 
 #include "PreprocessingParameters.hpp"
 #include "TokenProcessor.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+#include "lib/lexer/source/SourceManager.hpp"
 
 namespace ovum::compiler::preprocessor {
 
@@ -16,7 +18,12 @@ public:
 
   [[nodiscard]] std::expected<std::vector<TokenPtr>, PreprocessorError> Process();
 
+  // Struct-of-arrays variant: files are mapped through sources, which must outlive the returned buffer.
+  [[nodiscard]] std::expected<lexer::TokenBuffer, PreprocessorError> Process(lexer::SourceManager& sources);
+
 private:
+  [[nodiscard]] std::expected<std::vector<TokenPtr>, PreprocessorError> LexMainFile() const;
+
   PreprocessingParameters parameters_;
   std::vector<std::unique_ptr<TokenProcessor>> token_processors_;
 };
@@ -25,6 +25,12 @@ public:
   }
 };
 
+class FileWriteError : public PreprocessorError {
+public:
+  FileWriteError(const std::string& file) : PreprocessorError("Failed to write " + file) {
+  }
+};
+
 class CycleDetectedError : public PreprocessorError {
 public:
   CycleDetectedError(const std::string& cycle) : PreprocessorError("Cycle detected in dependencies: " + cycle) {
@@ -0,0 +1,33 @@
+#include "TokenProcessor.hpp"
+
+#include <utility>
+
+#include "lib/preprocessor/token_sequences/BufferTokenSequence.hpp"
+#include "lib/preprocessor/token_sequences/VectorTokenSequence.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+std::expected<lexer::TokenBuffer, PreprocessorError> TokenProcessor::Process(lexer::TokenBuffer tokens,
+                                                                              lexer::SourceManager& sources) {
+  std::expected<TokenSelection, PreprocessorError> selection = Select(BufferTokenSequence(tokens), sources);
+
+  if (!selection) {
+    return std::unexpected(selection.error());
+  }
+
+  return {selection->Apply(std::move(tokens))};
+}
+
+std::expected<std::vector<TokenPtr>, PreprocessorError> TokenProcessor::Process(const std::vector<TokenPtr>& tokens) {
+  // Tokens of the files the pass pulls in are built before the selection is dropped, so their sources can go with it.
+  lexer::SourceManager sources;
+  std::expected<TokenSelection, PreprocessorError> selection = Select(VectorTokenSequence(tokens), sources);
+
+  if (!selection) {
+    return std::unexpected(selection.error());
+  }
+
+  return {selection->Apply(tokens)};
+}
+
+} // namespace ovum::compiler::preprocessor
@@ -7,6 +7,10 @@
 #include <tokens/Token.hpp>
 
 #include "PreprocessorError.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+#include "lib/lexer/source/SourceManager.hpp"
+#include "lib/preprocessor/token_sequences/TokenSelection.hpp"
+#include "lib/preprocessor/token_sequences/TokenSequence.hpp"
 
 namespace ovum::compiler::preprocessor {
 
@@ -16,8 +20,20 @@ class TokenProcessor { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
   virtual ~TokenProcessor() = default;
 
-  [[nodiscard]] virtual std::expected<std::vector<TokenPtr>, PreprocessorError> Process(
-      const std::vector<TokenPtr>& tokens) = 0;
+  // The pass itself: reads the tokens through TokenSequence and answers with the runs to keep, so it is written once
+  // for every representation below. Files it pulls in are loaded through sources, which must outlive the selection.
+  [[nodiscard]] virtual std::expected<TokenSelection, PreprocessorError> Select(const TokenSequence& tokens,
+                                                                                lexer::SourceManager& sources) = 0;
+
+  // The entry points below are adapters over Select.
+
+  // Struct-of-arrays buffer, as the driver parses it. The buffer is taken by value, so a pass that keeps every token
+  // hands it back without a copy.
+  [[nodiscard]] std::expected<lexer::TokenBuffer, PreprocessorError> Process(lexer::TokenBuffer tokens,
+                                                                             lexer::SourceManager& sources);
+
+  // Kept tokens of the input are shared, not copied. Tokens of files the pass pulls in are built once.
+  [[nodiscard]] std::expected<std::vector<TokenPtr>, PreprocessorError> Process(const std::vector<TokenPtr>& tokens);
 };
 
 } // namespace ovum::compiler::preprocessor
@@ -0,0 +1,64 @@
+#ifndef PREPROCESSOR_BINARY_IO_HPP_
+#define PREPROCESSOR_BINARY_IO_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace ovum::compiler::preprocessor {
+
+// Native-endian helpers shared by the on-disk token formats; writers record a byte-order mark so a reader can
+// reject files from a machine of the other endianness.
+template <typename T>
+void WriteBinary(std::string& out, const T& value) {
+  const auto* bytes = reinterpret_cast<const char*>(&value); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  out.append(bytes, sizeof(T));
+}
+
+// Bounds-checked reads over a byte range; a short read leaves the value untouched and returns false.
+class BinaryReader {
+public:
+  explicit BinaryReader(std::string_view data) : data_(data) {
+  }
+
+  template <typename T>
+  bool Read(T& value) {
+    if (data_.size() - pos_ < sizeof(T)) {
+      return false;
+    }
+
+    std::memcpy(&value, data_.data() + pos_, sizeof(T));
+    pos_ += sizeof(T);
+
+    return true;
+  }
+
+  // The next size bytes, still owned by the underlying data.
+  bool ReadBytes(std::size_t size, std::string_view& bytes) {
+    if (data_.size() - pos_ < size) {
+      return false;
+    }
+
+    bytes = data_.substr(pos_, size);
+    pos_ += size;
+
+    return true;
+  }
+
+  [[nodiscard]] std::size_t Remaining() const noexcept {
+    return data_.size() - pos_;
+  }
+
+  [[nodiscard]] bool AtEnd() const noexcept {
+    return pos_ == data_.size();
+  }
+
+private:
+  std::string_view data_;
+  std::size_t pos_ = 0;
+};
+
+} // namespace ovum::compiler::preprocessor
+
+#endif // PREPROCESSOR_BINARY_IO_HPP_
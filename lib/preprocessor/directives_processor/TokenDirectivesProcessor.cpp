@@ -1,9 +1,7 @@
 #include "TokenDirectivesProcessor.hpp"
 
 #include <cstdint>
-
-#include "TokenDirectivesProcessor.hpp"
-#include "directives_chain_factory.hpp"
+#include <utility>
 
 namespace ovum::compiler::preprocessor {
 
@@ -12,26 +10,74 @@ TokenDirectivesProcessor::TokenDirectivesProcessor(const std::unordered_set<std:
     defined_symbols_.insert(symbol);
   }
 
-  directives_chain_ = CreateDirectivesChain();
+  directives_ = CreateDirectiveTable();
+}
+
+std::expected<TokenSelection, PreprocessorError> TokenDirectivesProcessor::Select(
+    const TokenSequence& tokens, lexer::SourceManager& /*sources*/) {
+  std::expected<std::vector<size_t>, PreprocessorError> kept_result = SelectTokens(tokens);
+
+  if (!kept_result) {
+    return std::unexpected(kept_result.error());
+  }
+
+  TokenSelection selection;
+  selection.KeepInput(kept_result.value());
+
+  return {std::move(selection)};
 }
 
-std::expected<std::vector<TokenPtr>, PreprocessorError> TokenDirectivesProcessor::Process(
-    const std::vector<TokenPtr>& tokens) {
-  std::vector<TokenPtr> processed_tokens;
-  size_t token_index = 0;
-  bool skipping = false;
-  int32_t skip_level = 0;
-  int32_t if_level = 0;
+std::expected<std::vector<size_t>, PreprocessorError> TokenDirectivesProcessor::SelectTokens(
+    const TokenSequence& tokens) {
+  std::vector<size_t> kept_indices;
+  kept_indices.reserve(tokens.Size());
+  DirectiveState state{.defined_symbols = defined_symbols_, .else_seen = else_seen_, .kept_indices = kept_indices};
+  size_t position = 0;
+
+  auto keep_up_to = [&state, &position](size_t end) {
+    if (!state.skipping) {
+      for (; position < end; ++position) {
+        state.kept_indices.push_back(position);
+      }
+    }
+
+    position = end;
+  };
+
+  for (const DirectiveToken& directive : FindDirectives(tokens)) {
+    // A directive's own line never holds another directive, but stay safe if a handler consumed one.
+    if (directive.index < position) {
+      continue;
+    }
 
-  while (token_index < tokens.size()) {
-    std::expected<void, PreprocessorError> handler_result = directives_chain_->Process(
-        token_index, tokens, processed_tokens, defined_symbols_, skipping, skip_level, if_level, else_seen_);
+    keep_up_to(directive.index);
 
-    if (!handler_result) {
+    if (std::expected<void, PreprocessorError> handler_result =
+            Dispatch(directive.directive, position, tokens, state);
+        !handler_result) {
       return std::unexpected(handler_result.error());
     }
   }
 
+  keep_up_to(tokens.Size());
+
+  if (std::expected<void, PreprocessorError> closed_result = CheckBlocksClosed(state.skip_level, state.if_level);
+      !closed_result) {
+    return std::unexpected(closed_result.error());
+  }
+
+  return {std::move(kept_indices)};
+}
+
+std::expected<void, PreprocessorError> TokenDirectivesProcessor::Dispatch(Directive directive,
+                                                                          size_t& position,
+                                                                          const TokenSequence& tokens,
+                                                                          DirectiveState& state) const {
+  return directives_[static_cast<size_t>(directive)]->Process(position, tokens, state);
+}
+
+std::expected<void, PreprocessorError> TokenDirectivesProcessor::CheckBlocksClosed(int32_t skip_level,
+                                                                                   int32_t if_level) const {
   if (skip_level > 0 || if_level > 0) {
     return std::unexpected(UnmatchedDirectiveError("Unmatched #if directive"));
   }
@@ -40,7 +86,7 @@ std::expected<std::vector<TokenPtr>, PreprocessorError> TokenDirectivesProcessor
     return std::unexpected(UnmatchedDirectiveError("Unmatched #if directive (else_seen stack not empty)"));
   }
 
-  return {std::move(processed_tokens)};
+  return {};
 }
 
 } // namespace ovum::compiler::preprocessor
@@ -1,6 +1,7 @@
 #ifndef PREPROCESSOR_TOKENDIRECTIVESPROCESSOR_HPP_
 #define PREPROCESSOR_TOKENDIRECTIVESPROCESSOR_HPP_
 
+#include <cstdint>
 #include <expected>
 #include <memory>
 #include <string>
@@ -11,20 +12,34 @@
 
 #include "lib/preprocessor/PreprocessorError.hpp"
 #include "lib/preprocessor/TokenProcessor.hpp"
+#include "lib/preprocessor/directives_processor/directive_table.hpp"
 #include "lib/preprocessor/directives_processor/handlers/DirectiveHandler.hpp"
 
 namespace ovum::compiler::preprocessor {
 
+// Evaluates #define, #undef, #ifdef, #ifndef, #else and #endif. Directive tokens are found in one pass and dispatched
+// through a DirectiveTable; the tokens between two directives are kept or skipped as a whole, so input without
+// directives comes back unchanged.
 class TokenDirectivesProcessor : public TokenProcessor {
 public:
   explicit TokenDirectivesProcessor(const std::unordered_set<std::string>& predefined_symbols);
 
-  [[nodiscard]] std::expected<std::vector<TokenPtr>, PreprocessorError> Process(
-      const std::vector<TokenPtr>& tokens) override;
+  [[nodiscard]] std::expected<TokenSelection, PreprocessorError> Select(const TokenSequence& tokens,
+                                                                        lexer::SourceManager& sources) override;
 
 private:
+  [[nodiscard]] std::expected<std::vector<size_t>, PreprocessorError> SelectTokens(const TokenSequence& tokens);
+
+  [[nodiscard]] std::expected<void, PreprocessorError> Dispatch(Directive directive,
+                                                                size_t& position,
+                                                                const TokenSequence& tokens,
+                                                                DirectiveState& state) const;
+
+  // Reports #ifdef/#ifndef blocks still open at the end of the input.
+  [[nodiscard]] std::expected<void, PreprocessorError> CheckBlocksClosed(int32_t skip_level, int32_t if_level) const;
+
   std::unordered_set<std::string> defined_symbols_;
-  std::unique_ptr<DirectiveHandler> directives_chain_;
+  DirectiveTable directives_;
   std::vector<bool> else_seen_;
 };
 
@@ -0,0 +1,66 @@
+#include "directive_table.hpp"
+
+#include <string_view>
+#include <utility>
+
+#include "lib/preprocessor/directives_processor/handlers/DefineHandler.hpp"
+#include "lib/preprocessor/directives_processor/handlers/ElseHandler.hpp"
+#include "lib/preprocessor/directives_processor/handlers/EndifHandler.hpp"
+#include "lib/preprocessor/directives_processor/handlers/IfdefHandler.hpp"
+#include "lib/preprocessor/directives_processor/handlers/IfndefHandler.hpp"
+#include "lib/preprocessor/directives_processor/handlers/UndefHandler.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+namespace {
+
+constexpr std::array<std::pair<std::string_view, Directive>, kDirectiveCount - 1> kDirectiveNames{{
+    {"#define", Directive::kDefine},
+    {"#undef", Directive::kUndef},
+    {"#ifdef", Directive::kIfdef},
+    {"#ifndef", Directive::kIfndef},
+    {"#else", Directive::kElse},
+    {"#endif", Directive::kEndif},
+}};
+
+} // namespace
+
+DirectiveTable CreateDirectiveTable() {
+  DirectiveTable table;
+  table[static_cast<size_t>(Directive::kDefine)] = std::make_unique<DefineHandler>();
+  table[static_cast<size_t>(Directive::kUndef)] = std::make_unique<UndefHandler>();
+  table[static_cast<size_t>(Directive::kIfdef)] = std::make_unique<IfdefHandler>();
+  table[static_cast<size_t>(Directive::kIfndef)] = std::make_unique<IfndefHandler>();
+  table[static_cast<size_t>(Directive::kElse)] = std::make_unique<ElseHandler>();
+  table[static_cast<size_t>(Directive::kEndif)] = std::make_unique<EndifHandler>();
+
+  return table;
+}
+
+Directive ClassifyDirective(const TokenSequence& tokens, size_t index) {
+  if (!tokens.IsKind(index, lexer::TokenKind::kKeyword)) {
+    return Directive::kNone;
+  }
+
+  for (const auto& [name, directive] : kDirectiveNames) {
+    if (tokens.LexemeIs(index, name)) {
+      return directive;
+    }
+  }
+
+  return Directive::kNone;
+}
+
+std::vector<DirectiveToken> FindDirectives(const TokenSequence& tokens) {
+  std::vector<DirectiveToken> directives;
+
+  for (size_t i = 0; i < tokens.Size(); ++i) {
+    if (const Directive directive = ClassifyDirective(tokens, i); directive != Directive::kNone) {
+      directives.push_back(DirectiveToken{.index = i, .directive = directive});
+    }
+  }
+
+  return directives;
+}
+
+} // namespace ovum::compiler::preprocessor
@@ -0,0 +1,38 @@
+#ifndef PREPROCESSOR_DIRECTIVE_TABLE_HPP_
+#define PREPROCESSOR_DIRECTIVE_TABLE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "lib/preprocessor/directives_processor/handlers/DirectiveHandler.hpp"
+#include "lib/preprocessor/token_sequences/TokenSequence.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+// Directives the directives pass handles; kNone for every other token, including #import.
+enum class Directive : std::uint8_t { kNone, kDefine, kUndef, kIfdef, kIfndef, kElse, kEndif };
+
+inline constexpr size_t kDirectiveCount = 7;
+
+// Handlers indexed by Directive; the kNone slot is empty.
+using DirectiveTable = std::array<std::unique_ptr<DirectiveHandler>, kDirectiveCount>;
+
+[[nodiscard]] DirectiveTable CreateDirectiveTable();
+
+// Directives are keywords, so any other kind is rejected before the lexeme is looked at.
+[[nodiscard]] Directive ClassifyDirective(const TokenSequence& tokens, size_t index);
+
+struct DirectiveToken {
+  size_t index;
+  Directive directive;
+};
+
+// Every directive token in tokens, in order; the pass dispatches these and jumps over everything in between.
+[[nodiscard]] std::vector<DirectiveToken> FindDirectives(const TokenSequence& tokens);
+
+} // namespace ovum::compiler::preprocessor
+
+#endif // PREPROCESSOR_DIRECTIVE_TABLE_HPP_
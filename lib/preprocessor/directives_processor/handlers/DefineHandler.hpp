@@ -10,18 +10,8 @@ namespace ovum::compiler::preprocessor {
 class DefineHandler : public DirectiveHandler {
 public:
   [[nodiscard]] std::expected<void, PreprocessorError> Process(size_t& position,
-                                                               const std::vector<TokenPtr>& tokens,
-                                                               std::vector<TokenPtr>& processed_tokens,
-                                                               std::unordered_set<std::string>& defined_symbols,
-                                                               bool& skipping,
-                                                               int& skip_level,
-                                                               int& if_level,
-                                                               std::vector<bool>& else_seen) override;
-
-  void SetNext(std::unique_ptr<DirectiveHandler> next) override;
-
-private:
-  std::unique_ptr<DirectiveHandler> next_;
+                                                               const TokenSequence& tokens,
+                                                               DirectiveState& state) override;
 };
 
 } // namespace ovum::compiler::preprocessor
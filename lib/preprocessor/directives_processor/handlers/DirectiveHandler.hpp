@@ -1,32 +1,36 @@
 #ifndef PREPROCESSOR_DIRECTIVE_HANDLER_HPP_
 #define PREPROCESSOR_DIRECTIVE_HANDLER_HPP_
 
+#include <cstdint>
 #include <expected>
-#include <memory>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
-#include <tokens/Token.hpp>
-
 #include "lib/preprocessor/PreprocessorError.hpp"
+#include "lib/preprocessor/token_sequences/TokenSequence.hpp"
 
 namespace ovum::compiler::preprocessor {
 
+// What the directive handlers read and update while a pass walks a token sequence. defined_symbols and else_seen
+// belong to the processor and outlive the pass.
+struct DirectiveState {
+  std::unordered_set<std::string>& defined_symbols;
+  std::vector<bool>& else_seen;
+  std::vector<size_t>& kept_indices;
+  bool skipping = false;
+  int32_t skip_level = 0;
+  int32_t if_level = 0;
+};
+
+// Handles one directive; position is at the directive token and is moved past the directive's line.
 class DirectiveHandler { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
   virtual ~DirectiveHandler() = default;
 
   [[nodiscard]] virtual std::expected<void, PreprocessorError> Process(size_t& position,
-                                                                       const std::vector<TokenPtr>& tokens,
-                                                                       std::vector<TokenPtr>& processed_tokens,
-                                                                       std::unordered_set<std::string>& defined_symbols,
-                                                                       bool& skipping,
-                                                                       int& skip_level,
-                                                                       int& if_level,
-                                                                       std::vector<bool>& else_seen) = 0;
-
-  virtual void SetNext(std::unique_ptr<DirectiveHandler> next) = 0;
+                                                                       const TokenSequence& tokens,
+                                                                       DirectiveState& state) = 0;
 };
 
 } // namespace ovum::compiler::preprocessor
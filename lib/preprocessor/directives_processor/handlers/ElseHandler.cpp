@@ -2,54 +2,36 @@
 
 namespace ovum::compiler::preprocessor {
 
-void ElseHandler::SetNext(std::unique_ptr<DirectiveHandler> next) {
-  next_ = std::move(next);
-}
-
 std::expected<void, PreprocessorError> ElseHandler::Process(size_t& position,
-                                                            const std::vector<TokenPtr>& tokens,
-                                                            std::vector<TokenPtr>& processed_tokens,
-                                                            std::unordered_set<std::string>& defined_symbols,
-                                                            bool& skipping,
-                                                            int& skip_level,
-                                                            int& if_level,
-                                                            std::vector<bool>& else_seen) {
-  if (position >= tokens.size() || tokens[position]->GetLexeme() != "#else") {
-    if (next_) {
-      return next_->Process(
-          position, tokens, processed_tokens, defined_symbols, skipping, skip_level, if_level, else_seen);
-    }
-
-    return {};
-  }
-
-  if (if_level == 0) {
+                                                            const TokenSequence& tokens,
+                                                            DirectiveState& state) {
+  if (state.if_level == 0) {
     return std::unexpected(UnmatchedDirectiveError("Mismatched #else at line " +
-                                                   std::to_string(tokens[position]->GetPosition().GetLine())));
+                                                   std::to_string(tokens.Line(position))));
   }
-  if (else_seen[if_level - 1]) {
+  if (state.else_seen[state.if_level - 1]) {
     return std::unexpected(PreprocessorError("Duplicate #else directive in the same #if block"));
   }
-  else_seen[if_level - 1] = true;
+  state.else_seen[state.if_level - 1] = true;
 
-  if (!skipping) {
-    skipping = true;
-  } else if (skip_level == 1) {
-    skipping = false;
+  if (!state.skipping) {
+    state.skipping = true;
+  } else if (state.skip_level == 1) {
+    state.skipping = false;
   }
 
-  if (tokens[position + 1]->GetStringType() == "NEWLINE" || tokens[position + 1]->GetLexeme() == ";") {
+  if (tokens.IsKind(position + 1, lexer::TokenKind::kNewline) || tokens.LexemeIs(position + 1, ";")) {
     position += 2;
 
     return {};
-  } else if (tokens[position + 1]->GetStringType() == "EOF") {
+  } else if (tokens.IsKind(position + 1, lexer::TokenKind::kEof)) {
     ++position;
 
     return {};
   }
 
   return std::unexpected(InvalidDirectiveError("#else has unexpected tokens after identifier at line " +
-                                               std::to_string(tokens[position]->GetPosition().GetLine())));
+                                               std::to_string(tokens.Line(position))));
 }
 
 } // namespace ovum::compiler::preprocessor
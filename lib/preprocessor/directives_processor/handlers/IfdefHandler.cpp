@@ -2,66 +2,45 @@
 
 namespace ovum::compiler::preprocessor {
 
-void IfdefHandler::SetNext(std::unique_ptr<DirectiveHandler> next) {
-  next_ = std::move(next);
-}
-
 std::expected<void, PreprocessorError> IfdefHandler::Process(size_t& position,
-                                                             const std::vector<TokenPtr>& tokens,
-                                                             std::vector<TokenPtr>& processed_tokens,
-                                                             std::unordered_set<std::string>& defined_symbols,
-                                                             bool& skipping,
-                                                             int& skip_level,
-                                                             int& if_level,
-                                                             std::vector<bool>& else_seen) {
-  if (position >= tokens.size() || tokens[position]->GetLexeme() != "#ifdef") {
-    if (next_) {
-      return next_->Process(
-          position, tokens, processed_tokens, defined_symbols, skipping, skip_level, if_level, else_seen);
-    }
-
-    return {};
-  }
-
-  if (position + 1 >= tokens.size()) {
-    return std::unexpected(InvalidDirectiveError("Incomplete #ifdef at line " +
-                                                 std::to_string(tokens[position]->GetPosition().GetLine())));
+                                                             const TokenSequence& tokens,
+                                                             DirectiveState& state) {
+  if (position + 1 >= tokens.Size()) {
+    return std::unexpected(InvalidDirectiveError("Incomplete #ifdef at line " + std::to_string(tokens.Line(position))));
   }
 
-  const TokenPtr& id_token = tokens[position + 1];
-
-  if (id_token->GetStringType() != "IDENT") {
+  if (!tokens.IsKind(position + 1, lexer::TokenKind::kIdent)) {
     return std::unexpected(InvalidDirectiveError("Expected identifier after #ifdef at line " +
-                                                 std::to_string(id_token->GetPosition().GetLine())));
+                                                 std::to_string(tokens.Line(position + 1))));
   }
 
-  std::string id = id_token->GetLexeme();
-  bool cond = defined_symbols.count(id) > 0;
+  std::string id = tokens.Lexeme(position + 1);
+  bool cond = state.defined_symbols.count(id) > 0;
 
-  else_seen.push_back(false);
-  ++if_level;
+  state.else_seen.push_back(false);
+  ++state.if_level;
 
-  if (skipping) {
-    ++skip_level;
+  if (state.skipping) {
+    ++state.skip_level;
   } else {
     if (!cond) {
-      skipping = true;
-      skip_level = 1;
+      state.skipping = true;
+      state.skip_level = 1;
     }
   }
 
-  if (position + 2 >= tokens.size() || tokens[position + 2]->GetStringType() == "EOF") {
+  if (position + 2 >= tokens.Size() || tokens.IsKind(position + 2, lexer::TokenKind::kEof)) {
     position += 2;
 
     return {};
-  } else if (tokens[position + 2]->GetStringType() == "NEWLINE" || tokens[position + 2]->GetLexeme() == ";") {
+  } else if (tokens.IsKind(position + 2, lexer::TokenKind::kNewline) || tokens.LexemeIs(position + 2, ";")) {
     position += 3;
 
     return {};
   }
 
   return std::unexpected(InvalidDirectiveError("#ifdef " + id + " has unexpected tokens after identifier at line " +
-                                               std::to_string(tokens[position]->GetPosition().GetLine())));
+                                               std::to_string(tokens.Line(position))));
 }
 
 } // namespace ovum::compiler::preprocessor
@@ -2,57 +2,36 @@
 
 namespace ovum::compiler::preprocessor {
 
-void UndefHandler::SetNext(std::unique_ptr<DirectiveHandler> next) {
-  next_ = std::move(next);
-}
-
 std::expected<void, PreprocessorError> UndefHandler::Process(size_t& position,
-                                                             const std::vector<TokenPtr>& tokens,
-                                                             std::vector<TokenPtr>& processed_tokens,
-                                                             std::unordered_set<std::string>& defined_symbols,
-                                                             bool& skipping,
-                                                             int& skip_level,
-                                                             int& if_level,
-                                                             std::vector<bool>& else_seen) {
-  if (position >= tokens.size() || tokens[position]->GetLexeme() != "#undef") {
-    if (next_) {
-      return next_->Process(
-          position, tokens, processed_tokens, defined_symbols, skipping, skip_level, if_level, else_seen);
-    }
-
-    return {};
+                                                             const TokenSequence& tokens,
+                                                             DirectiveState& state) {
+  if (position + 1 >= tokens.Size()) {
+    return std::unexpected(InvalidDirectiveError("Incomplete #undef at line " + std::to_string(tokens.Line(position))));
   }
 
-  if (position + 1 >= tokens.size()) {
-    return std::unexpected(InvalidDirectiveError("Incomplete #undef at line " +
-                                                 std::to_string(tokens[position]->GetPosition().GetLine())));
-  }
-
-  const TokenPtr& id_token = tokens[position + 1];
-
-  if (id_token->GetStringType() != "IDENT") {
+  if (!tokens.IsKind(position + 1, lexer::TokenKind::kIdent)) {
     return std::unexpected(InvalidDirectiveError("Expected identifier after #undef at line " +
-                                                 std::to_string(id_token->GetPosition().GetLine())));
+                                                 std::to_string(tokens.Line(position + 1))));
   }
 
-  std::string id = id_token->GetLexeme();
+  std::string id = tokens.Lexeme(position + 1);
 
-  if (!skipping) {
-    defined_symbols.erase(id);
+  if (!state.skipping) {
+    state.defined_symbols.erase(id);
   }
 
-  if (position + 2 >= tokens.size() || tokens[position + 2]->GetStringType() == "EOF") {
+  if (position + 2 >= tokens.Size() || tokens.IsKind(position + 2, lexer::TokenKind::kEof)) {
     position += 2;
 
     return {};
-  } else if (tokens[position + 2]->GetStringType() == "NEWLINE" || tokens[position + 2]->GetLexeme() == ";") {
+  } else if (tokens.IsKind(position + 2, lexer::TokenKind::kNewline) || tokens.LexemeIs(position + 2, ";")) {
     position += 3;
 
     return {};
   }
 
   return std::unexpected(InvalidDirectiveError("#undef " + id + " has unexpected tokens after identifier at line " +
-                                               std::to_string(tokens[position]->GetPosition().GetLine())));
+                                               std::to_string(tokens.Line(position))));
 }
 
 } // namespace ovum::compiler::preprocessor
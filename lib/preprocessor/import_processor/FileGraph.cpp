@@ -2,129 +2,198 @@
 
 #include <algorithm>
 #include <filesystem>
-#include <queue>
+#include <numeric>
 #include <set>
 #include <vector>
 
 namespace ovum::compiler::preprocessor {
 
+namespace {
+
+enum class VisitState : uint8_t { kUnvisited, kOnStack, kDone };
+
+} // namespace
+
 void FileGraph::AddDependency(const std::filesystem::path& from_path, const std::filesystem::path& to_path) {
-  dependency_graph_[from_path].insert(to_path);
-  nodes_.insert(from_path);
-  nodes_.insert(to_path);
+  const NodeId from = AddNode(from_path);
+  const NodeId to = AddNode(to_path);
+  edges_.emplace_back(from, to);
+  dependency_graph_stale_ = true;
 }
 
-void FileGraph::AddNode(const std::filesystem::path& node) {
-  nodes_.insert(node);
+FileGraph::NodeId FileGraph::AddNode(const std::filesystem::path& node) {
+  const auto [it, inserted] = ids_.try_emplace(node, static_cast<NodeId>(paths_.size()));
+
+  if (inserted) {
+    paths_.push_back(node);
+  }
+
+  return it->second;
 }
 
 void FileGraph::Clear() {
+  paths_.clear();
+  ids_.clear();
+  edges_.clear();
   dependency_graph_.clear();
-  nodes_.clear();
+  dependency_graph_stale_ = false;
 }
 
 const std::map<std::filesystem::path, std::set<std::filesystem::path>>& FileGraph::GetDependencyGraph() const {
+  if (dependency_graph_stale_) {
+    dependency_graph_.clear();
+
+    for (const auto& [from, to] : edges_) {
+      dependency_graph_[paths_[from]].insert(paths_[to]);
+    }
+
+    dependency_graph_stale_ = false;
+  }
+
   return dependency_graph_;
 }
 
 bool FileGraph::DetectCycles(std::vector<std::filesystem::path>& cycle_path) const {
-  std::map<std::filesystem::path, int32_t> node_colors;
+  const Adjacency adjacency = BuildAdjacency();
+  std::vector<VisitState> states(paths_.size(), VisitState::kUnvisited);
+  std::vector<std::pair<NodeId, uint32_t>> stack; // node and the next of its edges to follow
 
-  for (const std::filesystem::path& node : nodes_) {
-    if (node_colors.find(node) == node_colors.end()) {
-      if (DetectCycleDepthFirst(node, node_colors, cycle_path)) {
-        return true;
-      }
+  for (const NodeId root : adjacency.by_path) {
+    if (states[root] != VisitState::kUnvisited) {
+      continue;
     }
-  }
 
-  return false;
-}
+    states[root] = VisitState::kOnStack;
+    stack.emplace_back(root, adjacency.offsets[root]);
+
+    while (!stack.empty()) {
+      auto& [node, next_edge] = stack.back();
 
-bool FileGraph::DetectCycleDepthFirst(const std::filesystem::path& node,
-                                      std::map<std::filesystem::path, int32_t>& node_colors,
-                                      std::vector<std::filesystem::path>& cycle_path) const {
-  node_colors[node] = 1;
-  cycle_path.push_back(node);
+      if (next_edge == adjacency.offsets[node + 1]) {
+        states[node] = VisitState::kDone;
+        stack.pop_back();
+        continue;
+      }
 
-  auto dependency_iterator = dependency_graph_.find(node);
+      const NodeId neighbor = adjacency.targets[next_edge++];
 
-  if (dependency_iterator != dependency_graph_.end()) {
-    for (const std::filesystem::path& neighbor : dependency_iterator->second) {
-      auto color_iterator = node_colors.find(neighbor);
+      if (states[neighbor] == VisitState::kOnStack) {
+        // The stack from neighbor up is the cycle; anything below it only leads into the cycle.
+        auto cycle_start = std::ranges::find_if(stack, [neighbor](const auto& frame) {
+          return frame.first == neighbor;
+        });
 
-      if (color_iterator == node_colors.end()) {
-        if (DetectCycleDepthFirst(neighbor, node_colors, cycle_path)) {
-          return true;
+        for (; cycle_start != stack.end(); ++cycle_start) {
+          cycle_path.push_back(paths_[cycle_start->first]);
         }
-      } else if (color_iterator->second == 1) {
+
         return true;
       }
+
+      if (states[neighbor] == VisitState::kUnvisited) {
+        states[neighbor] = VisitState::kOnStack;
+        stack.emplace_back(neighbor, adjacency.offsets[neighbor]);
+      }
     }
   }
 
-  node_colors[node] = 2;
-  cycle_path.pop_back();
-
   return false;
 }
 
 std::expected<std::vector<std::filesystem::path>, CycleDetectedError> FileGraph::TopologicalSort() const {
-  std::map<std::filesystem::path, int32_t> in_degree;
+  const Adjacency adjacency = BuildAdjacency();
+  std::vector<uint32_t> in_degree(paths_.size(), 0);
 
-  for (const std::filesystem::path& node : nodes_) {
-    in_degree[node] = 0;
+  for (const NodeId target : adjacency.targets) {
+    ++in_degree[target];
   }
 
-  for (const auto& [_, dependencies] : dependency_graph_) {
-    for (const std::filesystem::path& vertex_to : dependencies) {
-      auto in_degree_iterator = in_degree.find(vertex_to);
+  // Kahn's algorithm with the output doubling as the queue.
+  std::vector<NodeId> order;
+  order.reserve(paths_.size());
 
-      if (in_degree_iterator != in_degree.end()) {
-        ++(in_degree_iterator->second);
-      }
+  for (const NodeId node : adjacency.by_path) {
+    if (in_degree[node] == 0) {
+      order.push_back(node);
     }
   }
 
-  std::queue<std::filesystem::path> nodes_queue;
+  for (size_t head = 0; head < order.size(); ++head) {
+    const NodeId node = order[head];
 
-  for (const auto& [node, in_degree_value] : in_degree) {
-    if (in_degree_value == 0) {
-      nodes_queue.push(node);
+    for (uint32_t edge = adjacency.offsets[node]; edge < adjacency.offsets[node + 1]; ++edge) {
+      if (--in_degree[adjacency.targets[edge]] == 0) {
+        order.push_back(adjacency.targets[edge]);
+      }
     }
   }
 
+  if (order.size() != paths_.size()) {
+    return std::unexpected(CycleDetectedError("Topological sort failed (cycle)"));
+  }
+
   std::vector<std::filesystem::path> topological_order;
+  topological_order.reserve(order.size());
 
-  while (!nodes_queue.empty()) {
-    std::filesystem::path current_node = nodes_queue.front();
-    nodes_queue.pop();
-    topological_order.push_back(current_node);
-    auto dependencies_iterator = dependency_graph_.find(current_node);
+  for (auto it = order.rbegin(); it != order.rend(); ++it) {
+    topological_order.push_back(paths_[*it]);
+  }
 
-    if (dependencies_iterator == dependency_graph_.end()) {
-      continue;
-    }
+  return topological_order;
+}
 
-    for (const std::filesystem::path& adjacent_node : dependencies_iterator->second) {
-      auto degree_iterator = in_degree.find(adjacent_node);
+FileGraph::Adjacency FileGraph::BuildAdjacency() const {
+  const size_t node_count = paths_.size();
+  Adjacency adjacency;
+  adjacency.by_path.resize(node_count);
+  std::iota(adjacency.by_path.begin(), adjacency.by_path.end(), NodeId{0});
+  std::ranges::sort(adjacency.by_path, [this](NodeId lhs, NodeId rhs) {
+    return paths_[lhs] < paths_[rhs];
+  });
 
-      if (degree_iterator != in_degree.end()) {
-        --(degree_iterator->second);
+  // Paths are compared once here; rows are then ordered by rank.
+  std::vector<uint32_t> rank(node_count);
 
-        if (degree_iterator->second == 0) {
-          nodes_queue.push(adjacent_node);
-        }
+  for (uint32_t i = 0; i < node_count; ++i) {
+    rank[adjacency.by_path[i]] = i;
+  }
+
+  std::vector<uint32_t> row_begin(node_count + 1, 0);
+
+  for (const auto& [from, to] : edges_) {
+    ++row_begin[from + 1];
+  }
+
+  std::partial_sum(row_begin.begin(), row_begin.end(), row_begin.begin());
+  std::vector<uint32_t> cursor(row_begin.begin(), row_begin.end() - 1);
+  adjacency.targets.resize(edges_.size());
+
+  for (const auto& [from, to] : edges_) {
+    adjacency.targets[cursor[from]++] = to;
+  }
+
+  // Sort each row and drop repeated imports, compacting towards the front; a row never overtakes its own start.
+  adjacency.offsets.assign(node_count + 1, 0);
+  uint32_t write = 0;
+
+  for (NodeId node = 0; node < node_count; ++node) {
+    auto row = adjacency.targets.begin();
+    std::sort(row + row_begin[node], row + row_begin[node + 1], [&rank](NodeId lhs, NodeId rhs) {
+      return rank[lhs] < rank[rhs];
+    });
+
+    for (uint32_t edge = row_begin[node]; edge < row_begin[node + 1]; ++edge) {
+      if (write == adjacency.offsets[node] || adjacency.targets[write - 1] != adjacency.targets[edge]) {
+        adjacency.targets[write++] = adjacency.targets[edge];
       }
     }
-  }
 
-  if (topological_order.size() != nodes_.size()) {
-    return std::unexpected(CycleDetectedError("Topological sort failed (cycle)"));
+    adjacency.offsets[node + 1] = write;
   }
 
-  std::ranges::reverse(topological_order);
-  return topological_order;
+  adjacency.targets.resize(write);
+
+  return adjacency;
 }
 
 } // namespace ovum::compiler::preprocessor
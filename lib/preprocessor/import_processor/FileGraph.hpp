@@ -6,29 +6,51 @@
 #include <filesystem>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "lib/preprocessor/PreprocessorError.hpp"
 
 namespace ovum::compiler::preprocessor {
 
+// Import graph over files. Paths are interned to dense ids when first seen and edges are kept as id pairs; the
+// traversals build a compressed adjacency (CSR) once and walk it iteratively, so deep import chains cannot overflow
+// the stack. Nodes and each node's dependencies are visited in path order, which keeps results independent of the
+// order files were discovered in.
 class FileGraph {
 public:
+  using NodeId = uint32_t;
+
   void AddDependency(const std::filesystem::path& from_path, const std::filesystem::path& to_path);
-  void AddNode(const std::filesystem::path& node);
+  NodeId AddNode(const std::filesystem::path& node);
   void Clear();
 
+  // On a cycle, fills cycle_path with its files, each importing the next and the last importing the first.
   [[nodiscard]] bool DetectCycles(std::vector<std::filesystem::path>& cycle_path) const;
+
+  // Files with every dependency ahead of its importers.
   [[nodiscard]] std::expected<std::vector<std::filesystem::path>, CycleDetectedError> TopologicalSort() const;
+
+  // Built from the edges on first use after a change; meant for inspection, not for the hot path.
   [[nodiscard]] const std::map<std::filesystem::path, std::set<std::filesystem::path>>& GetDependencyGraph() const;
 
 private:
-  std::map<std::filesystem::path, std::set<std::filesystem::path>> dependency_graph_;
-  std::set<std::filesystem::path> nodes_;
+  // Row i of targets is targets[offsets[i], offsets[i + 1]), sorted by path and free of duplicates.
+  struct Adjacency {
+    std::vector<uint32_t> offsets;
+    std::vector<NodeId> targets;
+    std::vector<NodeId> by_path; // every node, in path order
+  };
+
+  [[nodiscard]] Adjacency BuildAdjacency() const;
+
+  std::vector<std::filesystem::path> paths_;
+  std::unordered_map<std::filesystem::path, NodeId> ids_;
+  std::vector<std::pair<NodeId, NodeId>> edges_;
 
-  bool DetectCycleDepthFirst(const std::filesystem::path& node,
-                             std::map<std::filesystem::path, int32_t>& node_colors,
-                             std::vector<std::filesystem::path>& cycle_path) const;
+  mutable std::map<std::filesystem::path, std::set<std::filesystem::path>> dependency_graph_;
+  mutable bool dependency_graph_stale_ = false;
 };
 
 } // namespace ovum::compiler::preprocessor
@@ -0,0 +1,135 @@
+#include "IncludeResolver.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace ovum::compiler::preprocessor {
+
+namespace {
+
+bool IsAscii(std::string_view name) {
+  return std::ranges::all_of(name, [](char c) { return static_cast<unsigned char>(c) < 0x80U; });
+}
+
+std::string FlipCase(std::string_view name) {
+  std::string flipped(name);
+
+  for (char& c : flipped) {
+    if (c >= 'a' && c <= 'z') {
+      c = static_cast<char>(c - 'a' + 'A');
+    } else if (c >= 'A' && c <= 'Z') {
+      c = static_cast<char>(c - 'A' + 'a');
+    }
+  }
+
+  return flipped;
+}
+
+// Asks the filesystem for one entry under another case. Without an entry to ask about, the answer is "no", so misses
+// in that directory are left to std::filesystem::exists.
+bool IsCaseSensitive(const std::filesystem::path& directory, const std::unordered_set<std::string>& names) {
+  for (const std::string& name : names) {
+    const std::string flipped = FlipCase(name);
+
+    if (flipped == name || names.contains(flipped)) {
+      continue;
+    }
+
+    std::error_code error;
+    const bool found = std::filesystem::exists(
+        (directory.empty() ? std::filesystem::path(".") : directory) / flipped, error);
+
+    return !found && !error;
+  }
+
+  return false;
+}
+
+} // namespace
+
+std::optional<std::filesystem::path> IncludeResolver::Resolve(const std::set<std::filesystem::path>& include_paths,
+                                                               std::string_view name) {
+  for (const std::filesystem::path& include_dir : include_paths) {
+    std::filesystem::path candidate = include_dir / name;
+
+    if (Exists(candidate)) {
+      return candidate;
+    }
+  }
+
+  return std::nullopt;
+}
+
+bool IncludeResolver::Exists(const std::filesystem::path& path) {
+  const std::filesystem::path file_name = path.filename();
+
+  // "dir/", "." and ".." are not entries of their parent's listing, so ask the filesystem.
+  if (file_name.empty() || file_name == "." || file_name == "..") {
+    std::error_code error;
+
+    return std::filesystem::exists(path, error);
+  }
+
+  const std::string name = file_name.string();
+  {
+    std::lock_guard lock(mutex_);
+    const Listing& listing = ListDirectory(path.parent_path());
+
+    if (!listing.names.has_value()) {
+      return false;
+    }
+
+    if (listing.names->contains(name)) {
+      return true;
+    }
+
+    if (listing.case_sensitive && IsAscii(name)) {
+      return false;
+    }
+  }
+
+  std::error_code error;
+
+  return std::filesystem::exists(path, error);
+}
+
+std::size_t IncludeResolver::DirectoryScans() const {
+  std::lock_guard lock(mutex_);
+
+  return listings_.size();
+}
+
+void IncludeResolver::Clear() {
+  std::lock_guard lock(mutex_);
+  listings_.clear();
+}
+
+const IncludeResolver::Listing& IncludeResolver::ListDirectory(const std::filesystem::path& directory) {
+  if (auto it = listings_.find(directory); it != listings_.end()) {
+    return it->second;
+  }
+
+  Listing listing;
+  std::error_code error;
+  std::filesystem::directory_iterator entries(directory.empty() ? std::filesystem::path(".") : directory, error);
+
+  if (!error) {
+    listing.names.emplace();
+
+    for (; !error && entries != std::filesystem::directory_iterator(); entries.increment(error)) {
+      if (std::error_code status_error; entries->is_symlink(status_error) && !entries->exists(status_error)) {
+        continue;
+      }
+
+      listing.names->insert(entries->path().filename().string());
+    }
+
+    listing.case_sensitive = IsCaseSensitive(directory, *listing.names);
+  }
+
+  return listings_.emplace(directory, std::move(listing)).first->second;
+}
+
+} // namespace ovum::compiler::preprocessor
@@ -0,0 +1,52 @@
+#ifndef PREPROCESSOR_INCLUDERESOLVER_HPP_
+#define PREPROCESSOR_INCLUDERESOLVER_HPP_
+
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ovum::compiler::preprocessor {
+
+// Resolves import names against include directories from cached directory listings: each directory is read once,
+// after which a lookup is a hash probe instead of a stat per include directory. A listing answers "no" on its own
+// only for a case-sensitive directory and an ASCII name; elsewhere (case-insensitive macOS and Windows volumes,
+// names the filesystem may normalise) a miss is checked with std::filesystem::exists, so resolution follows the
+// filesystem's own matching rules. The listings are not refreshed, so one resolver should live for one compilation,
+// or for a batch of them over a tree that does not change meanwhile (call Clear() between batches otherwise). Safe
+// to use from several threads.
+class IncludeResolver {
+public:
+  // include_dir / name for the first include directory, in include_paths order, that holds name.
+  [[nodiscard]] std::optional<std::filesystem::path> Resolve(const std::set<std::filesystem::path>& include_paths,
+                                                             std::string_view name);
+
+  // Whether path names an existing entry, as std::filesystem::exists would report for an unchanged tree.
+  [[nodiscard]] bool Exists(const std::filesystem::path& path);
+
+  // Directories read so far, including ones that turned out not to exist.
+  [[nodiscard]] std::size_t DirectoryScans() const;
+
+  void Clear();
+
+private:
+  // Entry names of a directory, leaving out dangling symlinks, which std::filesystem::exists reports as missing.
+  struct Listing {
+    std::optional<std::unordered_set<std::string>> names; // nullopt when it does not exist or cannot be read
+    bool case_sensitive = false;                          // whether names can tell "Foo" and "foo" apart
+  };
+
+  [[nodiscard]] const Listing& ListDirectory(const std::filesystem::path& directory);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::filesystem::path, Listing> listings_;
+};
+
+} // namespace ovum::compiler::preprocessor
+
+#endif // PREPROCESSOR_INCLUDERESOLVER_HPP_
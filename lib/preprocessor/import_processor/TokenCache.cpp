@@ -0,0 +1,304 @@
+#include "TokenCache.hpp"
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "import_discovery.hpp"
+#include "lib/lexer/parallel_lexer.hpp"
+#include "lib/lexer/source/SourceBuffer.hpp"
+#include "lib/preprocessor/binary_io.hpp"
+#include "lib/preprocessor/token_sequences/BufferTokenSequence.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+namespace {
+
+constexpr std::array<char, 4> kEntryMagic{'O', 'V', 'T', 'C'};
+constexpr uint32_t kByteOrderMark = 0x01020304U;
+constexpr std::string_view kEntryExtension = ".otc";
+
+constexpr uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ULL;
+constexpr uint64_t kFnvPrime = 0x100000001b3ULL;
+constexpr uint64_t kWordMultiplier = 0x9e3779b97f4a7c15ULL;
+constexpr uint64_t kMixMultiplier1 = 0xff51afd7ed558ccdULL;
+constexpr uint64_t kMixMultiplier2 = 0xc4ceb9fe1a85ec53ULL;
+constexpr int kWordRotation = 31;
+constexpr int kMixShift = 33;
+constexpr int kHexDigitsPerLane = 16;
+constexpr int kBitsPerHexDigit = 4;
+
+unsigned long CurrentProcessId() noexcept {
+#ifdef _WIN32
+  return static_cast<unsigned long>(_getpid());
+#else
+  return static_cast<unsigned long>(getpid());
+#endif
+}
+
+struct ContentHash {
+  uint64_t bytes = kFnvOffsetBasis; // FNV-1a over every byte
+  uint64_t words = 0;               // multiply-rotate over 8-byte words, finalized with a murmur mix
+};
+
+uint64_t Mix(uint64_t value) noexcept {
+  value ^= value >> kMixShift;
+  value *= kMixMultiplier1;
+  value ^= value >> kMixShift;
+  value *= kMixMultiplier2;
+  value ^= value >> kMixShift;
+
+  return value;
+}
+
+// Two unrelated 64-bit lanes, so different contents rarely compete for one entry; Load compares the stored source
+// anyway, so a collision is only a miss.
+ContentHash HashContent(std::string_view text) noexcept {
+  ContentHash hash;
+
+  for (const char c : text) {
+    hash.bytes = (hash.bytes ^ static_cast<unsigned char>(c)) * kFnvPrime;
+  }
+
+  size_t pos = 0;
+
+  for (; pos + sizeof(uint64_t) <= text.size(); pos += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    std::memcpy(&word, text.data() + pos, sizeof(word));
+    hash.words = std::rotl(hash.words ^ (word * kWordMultiplier), kWordRotation) * kWordMultiplier;
+  }
+
+  uint64_t tail = 0;
+
+  if (pos < text.size()) {
+    std::memcpy(&tail, text.data() + pos, text.size() - pos);
+  }
+
+  hash.words = Mix(hash.words ^ tail ^ text.size());
+
+  return hash;
+}
+
+void AppendHex(std::string& out, uint64_t value) {
+  constexpr std::string_view kDigits = "0123456789abcdef";
+
+  for (int digit = kHexDigitsPerLane - 1; digit >= 0; --digit) {
+    out.push_back(kDigits[(value >> (digit * kBitsPerHexDigit)) & 0xFU]);
+  }
+}
+
+} // namespace
+
+TokenCache::TokenCache(std::filesystem::path directory) : directory_(std::move(directory)) {
+}
+
+std::expected<std::vector<std::size_t>, lexer::LexerError> TokenCache::TokenizeInto(
+    std::string_view text, lexer::TokenBuffer& out, const lexer::ParallelLexOptions& lex_options) {
+  const std::string key = ContentKey(text);
+
+  if (std::optional<Entry> entry = Load(key, text)) {
+    ++hits_;
+    const lexer::TokenBuffer::SourceIndex source = out.AddSource(text);
+    out.Reserve(out.Size() + entry->views.size());
+
+    for (const lexer::TokenView& view : entry->views) {
+      out.Append(view, source);
+    }
+
+    return {std::move(entry->imports)};
+  }
+
+  ++misses_;
+  lexer::TokenBuffer lexed;
+
+  if (auto lex_result = lexer::TokenizeIntoParallel(text, lexed, false, lex_options); !lex_result) {
+    return std::unexpected(lex_result.error());
+  }
+
+  Entry entry{.views = {}, .imports = FindImportTokens(BufferTokenSequence(lexed))};
+  entry.views.reserve(lexed.Size());
+
+  for (size_t i = 0; i < lexed.Size(); ++i) {
+    entry.views.push_back(
+        lexer::TokenView{.kind = lexed.Kind(i), .offset = lexed.Offset(i), .length = lexed.Length(i)});
+  }
+
+  Store(key, text, entry);
+
+  if (out.IsEmpty()) {
+    out = std::move(lexed);
+  } else {
+    out.AppendRange(lexed, 0, lexed.Size());
+  }
+
+  return {std::move(entry.imports)};
+}
+
+const std::filesystem::path& TokenCache::Directory() const noexcept {
+  return directory_;
+}
+
+std::size_t TokenCache::Hits() const noexcept {
+  return hits_.load();
+}
+
+std::size_t TokenCache::Misses() const noexcept {
+  return misses_.load();
+}
+
+std::string TokenCache::ContentKey(std::string_view text) {
+  const ContentHash hash = HashContent(text);
+  std::string key;
+  key.reserve(2 * kHexDigitsPerLane);
+  AppendHex(key, hash.bytes);
+  AppendHex(key, hash.words);
+
+  return key;
+}
+
+std::optional<TokenCache::Entry> TokenCache::Load(const std::string& key, std::string_view text) const {
+  std::expected<std::unique_ptr<lexer::SourceBuffer>, lexer::LexerError> mapped =
+      lexer::SourceBuffer::MapFile(directory_ / (key + std::string(kEntryExtension)));
+
+  if (!mapped) {
+    return std::nullopt;
+  }
+
+  const std::string_view data = mapped.value()->Text();
+  BinaryReader reader(data);
+  std::array<char, kEntryMagic.size()> magic{};
+  uint32_t version = 0;
+  uint32_t byte_order = 0;
+  uint64_t source_size = 0;
+  uint32_t token_count = 0;
+  uint32_t import_count = 0;
+
+  for (char& c : magic) {
+    if (!reader.Read(c)) {
+      return std::nullopt;
+    }
+  }
+
+  if (magic != kEntryMagic || !reader.Read(version) || version != kTokenCacheVersion || !reader.Read(byte_order) ||
+      byte_order != kByteOrderMark || !reader.Read(source_size) || source_size != text.size() ||
+      !reader.Read(token_count) || !reader.Read(import_count)) {
+    return std::nullopt;
+  }
+
+  // Another content with the same key stored its own source here.
+  if (std::string_view stored; !reader.ReadBytes(text.size(), stored) || stored != text) {
+    return std::nullopt;
+  }
+
+  // Counts come from the file, so check them against its size before allocating anything.
+  if (token_count > data.size() || import_count > data.size()) {
+    return std::nullopt;
+  }
+
+  Entry entry;
+  entry.views.resize(token_count);
+  entry.imports.resize(import_count);
+
+  for (lexer::TokenView& view : entry.views) {
+    if (!reader.Read(view.kind) || view.kind > lexer::TokenKind::kBoolLiteral) {
+      return std::nullopt;
+    }
+  }
+
+  for (lexer::TokenView& view : entry.views) {
+    if (!reader.Read(view.offset) || view.offset > text.size()) {
+      return std::nullopt;
+    }
+  }
+
+  for (lexer::TokenView& view : entry.views) {
+    if (!reader.Read(view.length) || view.length > text.size() - view.offset) {
+      return std::nullopt;
+    }
+  }
+
+  for (std::size_t& import : entry.imports) {
+    uint32_t index = 0;
+
+    if (!reader.Read(index) || index >= token_count) {
+      return std::nullopt;
+    }
+
+    import = index;
+  }
+
+  if (!reader.AtEnd()) {
+    return std::nullopt;
+  }
+
+  return entry;
+}
+
+void TokenCache::Store(const std::string& key, std::string_view text, const Entry& entry) {
+  std::string data;
+  data.reserve(kEntryMagic.size() + sizeof(uint32_t) * 4 + sizeof(uint64_t) + text.size() +
+               entry.views.size() * (sizeof(lexer::TokenKind) + sizeof(uint32_t) * 2) +
+               entry.imports.size() * sizeof(uint32_t));
+  data.append(kEntryMagic.data(), kEntryMagic.size());
+  WriteBinary(data, kTokenCacheVersion);
+  WriteBinary(data, kByteOrderMark);
+  WriteBinary(data, static_cast<uint64_t>(text.size()));
+  WriteBinary(data, static_cast<uint32_t>(entry.views.size()));
+  WriteBinary(data, static_cast<uint32_t>(entry.imports.size()));
+  data.append(text);
+
+  for (const lexer::TokenView& view : entry.views) {
+    WriteBinary(data, view.kind);
+  }
+
+  for (const lexer::TokenView& view : entry.views) {
+    WriteBinary(data, view.offset);
+  }
+
+  for (const lexer::TokenView& view : entry.views) {
+    WriteBinary(data, view.length);
+  }
+
+  for (const std::size_t import : entry.imports) {
+    WriteBinary(data, static_cast<uint32_t>(import));
+  }
+
+  std::error_code error;
+  std::filesystem::create_directories(directory_, error);
+
+  if (error) {
+    return;
+  }
+
+  // The process id tells compilers sharing the directory apart and the counter tells this cache's writers apart, so
+  // concurrent writers of the same entry never share a temporary file.
+  const std::filesystem::path temp_path =
+      directory_ / (key + ".tmp" + std::to_string(CurrentProcessId()) + "-" + std::to_string(temp_counter_++));
+  {
+    std::ofstream file_stream(temp_path, std::ios::binary | std::ios::trunc);
+
+    if (!file_stream.write(data.data(), static_cast<std::streamsize>(data.size()))) {
+      file_stream.close();
+      std::filesystem::remove(temp_path, error);
+      return;
+    }
+  }
+
+  std::filesystem::rename(temp_path, directory_ / (key + std::string(kEntryExtension)), error);
+
+  if (error) {
+    std::filesystem::remove(temp_path, error);
+  }
+}
+
+} // namespace ovum::compiler::preprocessor
@@ -0,0 +1,68 @@
+#ifndef PREPROCESSOR_TOKENCACHE_HPP_
+#define PREPROCESSOR_TOKENCACHE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "lib/lexer/LexerError.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+#include "lib/lexer/TokenView.hpp"
+#include "lib/lexer/parallel_lexer.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+// Bump whenever the lexer's output or the entry layout changes, so stale entries are ignored.
+inline constexpr uint32_t kTokenCacheVersion = 2;
+
+// On-disk cache of lexed files, named by a 128-bit hash of their content (never by path or mtime). The hash only
+// picks the file: an entry also stores the source it was lexed from and is used only when that matches byte for
+// byte, so a hash collision costs a re-lex instead of wrong tokens and entries are safe to share between checkouts
+// and machines. Besides the source, an entry holds each token's kind, offset and length plus the indices of the
+// file's #import tokens; lines and columns are recomputed from the source. Entries are written to a temporary file
+// and renamed into place, so concurrent compilers never see a partial entry. Safe to use from several threads.
+class TokenCache {
+public:
+  explicit TokenCache(std::filesystem::path directory);
+
+  // Appends the tokens of text to out exactly as lexer::TokenizeIntoParallel would, from the cache when an entry
+  // for this content exists and by lexing (and storing the entry) otherwise, with lex_options. Returns the indices of
+  // the #import tokens relative to the first appended token. A cache that cannot be read or written only costs a
+  // re-lex.
+  std::expected<std::vector<std::size_t>, lexer::LexerError> TokenizeInto(
+      std::string_view text, lexer::TokenBuffer& out, const lexer::ParallelLexOptions& lex_options = {});
+
+  [[nodiscard]] const std::filesystem::path& Directory() const noexcept;
+
+  [[nodiscard]] std::size_t Hits() const noexcept;
+
+  [[nodiscard]] std::size_t Misses() const noexcept;
+
+  // Hex name of the entry for this content.
+  [[nodiscard]] static std::string ContentKey(std::string_view text);
+
+private:
+  struct Entry {
+    std::vector<lexer::TokenView> views;
+    std::vector<std::size_t> imports;
+  };
+
+  [[nodiscard]] std::optional<Entry> Load(const std::string& key, std::string_view text) const;
+
+  void Store(const std::string& key, std::string_view text, const Entry& entry);
+
+  std::filesystem::path directory_;
+  std::atomic<std::size_t> hits_{0};
+  std::atomic<std::size_t> misses_{0};
+  std::atomic<std::size_t> temp_counter_{0};
+};
+
+} // namespace ovum::compiler::preprocessor
+
+#endif // PREPROCESSOR_TOKENCACHE_HPP_
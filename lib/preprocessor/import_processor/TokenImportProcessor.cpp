@@ -1,70 +1,126 @@
 #include "TokenImportProcessor.hpp"
 
+#include <algorithm>
 #include <filesystem>
-#include <fstream>
-#include <iterator>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <utility>
 
-#include "lib/lexer/Lexer.hpp"
+#include "lib/lexer/LexerError.hpp"
+#include "lib/lexer/parallel_lexer.hpp"
+#include "lib/lexer/source/SourceBuffer.hpp"
+#include "lib/preprocessor/token_sequences/BufferTokenSequence.hpp"
 
 namespace ovum::compiler::preprocessor {
 
-const std::unordered_map<std::filesystem::path, std::vector<TokenPtr>>& TokenImportProcessor::GetFileToTokens() const {
-  return file_to_tokens_;
+namespace {
+
+// Discovery workers already run one per core, so each lexes its file on its own thread instead of spawning more.
+constexpr lexer::ParallelLexOptions kDiscoveryWorkerLexOptions{.threads = 1};
+
+PreprocessorError MakeLexerError(const std::filesystem::path& file, const lexer::LexerError& error) {
+  return PreprocessorError("Lexer error for " + file.string() + ": " + error.what());
 }
 
+} // namespace
+
 const std::map<std::filesystem::path, std::set<std::filesystem::path>>& TokenImportProcessor::GetDependencyGraph()
     const {
   return file_graph_.GetDependencyGraph();
 }
 
-std::expected<std::string, PreprocessorError> TokenImportProcessor::ReadFileToString(
-    const std::filesystem::path& file) {
-  if (!std::filesystem::exists(file)) {
-    return std::unexpected(FileNotFoundError(file.string()));
+TokenImportProcessor::TokenImportProcessor(std::filesystem::path main_file,
+                                           const std::set<std::filesystem::path>& include_paths,
+                                           std::size_t import_threads,
+                                           const std::filesystem::path& token_cache_dir,
+                                           std::shared_ptr<IncludeResolver> include_resolver) :
+    main_file_(std::move(main_file)), include_paths_(include_paths), include_resolver_(std::move(include_resolver)),
+    import_threads_(import_threads) {
+  if (include_resolver_ == nullptr) {
+    include_resolver_ = std::make_shared<IncludeResolver>();
   }
 
-  std::ifstream file_stream(file, std::ios::binary);
-
-  if (!file_stream.is_open()) {
-    return std::unexpected(FileReadError(file.string(), "Cannot open"));
+  if (!token_cache_dir.empty()) {
+    token_cache_ = std::make_unique<TokenCache>(token_cache_dir);
   }
+}
 
-  std::string content((std::istreambuf_iterator<char>(file_stream)), std::istreambuf_iterator<char>());
+std::expected<TokenSelection, PreprocessorError> TokenImportProcessor::Select(const TokenSequence& tokens,
+                                                                              lexer::SourceManager& sources) {
+  Reset();
 
-  if (file_stream.bad() || file_stream.fail()) {
-    return std::unexpected(FileReadError(file.string(), "Read error"));
-  }
+  DependencyLoader load_dependency = [this, &sources, &load_dependency](const std::filesystem::path& dep_path)
+      -> std::expected<void, PreprocessorError> {
+    std::expected<const lexer::SourceBuffer*, lexer::LexerError> source_result = sources.Load(dep_path);
 
-  return {std::move(content)};
-}
+    if (!source_result) {
+      return std::unexpected(FileReadError(dep_path.string(), source_result.error().what()));
+    }
 
-TokenImportProcessor::TokenImportProcessor(std::filesystem::path main_file,
-                                           const std::set<std::filesystem::path>& include_paths) :
-    main_file_(std::move(main_file)), include_paths_(include_paths) {
-}
+    auto raw_tokens = std::make_shared<lexer::TokenBuffer>();
+    auto imports_result = LexImport(dep_path, source_result.value()->Text(), *raw_tokens, {});
 
-std::expected<std::vector<TokenPtr>, PreprocessorError> TokenImportProcessor::Process(
-    const std::vector<TokenPtr>& tokens) {
-  file_to_tokens_.clear();
-  file_graph_.Clear();
-  visited_.clear();
+    if (!imports_result) {
+      return std::unexpected(imports_result.error());
+    }
 
-  file_graph_.AddNode(main_file_);
+    file_to_buffer_[dep_path] = raw_tokens;
+    return GatherDependencies(dep_path, BufferTokenSequence(*raw_tokens), imports_result.value(), load_dependency);
+  };
+
+  std::mutex mutex;
+  ImportScanner scan = [this, &sources, &mutex](const std::filesystem::path& dep_path) -> DiscoveredImports {
+    std::expected<const lexer::SourceBuffer*, lexer::LexerError> source_result = sources.Load(dep_path);
+
+    if (!source_result) {
+      return {.load_error = FileReadError(dep_path.string(), source_result.error().what()), .imports = {}};
+    }
+
+    auto raw_tokens = std::make_shared<lexer::TokenBuffer>();
+    auto imports_result =
+        LexImport(dep_path, source_result.value()->Text(), *raw_tokens, kDiscoveryWorkerLexOptions);
 
-  std::expected<void, PreprocessorError> dep_result = GatherDependencies(main_file_, tokens);
+    if (!imports_result) {
+      return {.load_error = imports_result.error(), .imports = {}};
+    }
+
+    DiscoveredImports found{.load_error = std::nullopt,
+                            .imports = ScanImports(BufferTokenSequence(*raw_tokens), imports_result.value())};
+    std::lock_guard lock(mutex);
+    file_to_buffer_[dep_path] = std::move(raw_tokens);
+
+    return found;
+  };
+
+  std::expected<void, PreprocessorError> dep_result =
+      ImportThreadCount() > 1 ? GatherDependenciesInParallel(tokens, scan)
+                              : GatherDependencies(main_file_, tokens, FindImportTokens(tokens), load_dependency);
 
   if (!dep_result) {
     return std::unexpected(dep_result.error());
   }
 
-  std::set<std::filesystem::path> nodes;
-  for (const auto& [node, _] : file_to_tokens_) {
-    nodes.insert(node);
+  std::expected<std::vector<std::filesystem::path>, PreprocessorError> order_result = OrderFiles();
+
+  if (!order_result) {
+    return std::unexpected(order_result.error());
   }
 
+  return {SelectFiles(order_result.value(), tokens)};
+}
+
+void TokenImportProcessor::Reset() {
+  file_to_buffer_.clear();
+  file_graph_.Clear();
+  visited_.clear();
+
+  file_graph_.AddNode(main_file_);
+}
+
+std::expected<std::vector<std::filesystem::path>, PreprocessorError> TokenImportProcessor::OrderFiles() const {
   std::vector<std::filesystem::path> cycle_path;
 
   if (file_graph_.DetectCycles(cycle_path)) {
@@ -78,164 +134,207 @@ std::expected<std::vector<TokenPtr>, PreprocessorError> TokenImportProcessor::Pr
     return std::unexpected(CycleDetectedError("Cycle detected: " + cycle_str));
   }
 
-  std::expected<std::vector<std::filesystem::path>, PreprocessorError> order_result = file_graph_.TopologicalSort();
+  std::expected<std::vector<std::filesystem::path>, CycleDetectedError> order_result = file_graph_.TopologicalSort();
 
   if (!order_result) {
     return std::unexpected(order_result.error());
   }
 
-  std::vector<std::filesystem::path> order = order_result.value();
-  std::vector<TokenPtr> concatenated = ConcatenateTokens(order);
-  std::vector<TokenPtr> cleaned = RemoveExtraTokens(concatenated);
-
-  return {std::move(cleaned)};
+  return {std::move(order_result.value())};
 }
 
-std::expected<void, PreprocessorError> TokenImportProcessor::GatherDependencies(const std::filesystem::path& file,
-                                                                                const std::vector<TokenPtr>& tokens) {
+std::expected<void, PreprocessorError> TokenImportProcessor::GatherDependencies(
+    const std::filesystem::path& file,
+    const TokenSequence& tokens,
+    const std::vector<size_t>& import_positions,
+    const DependencyLoader& load_dependency) {
   if (visited_.count(file) != 0) {
     return {};
   }
 
   visited_.insert(file);
-  file_to_tokens_[file] = tokens;
-  size_t position = 0;
 
-  while (position < tokens.size()) {
-    const TokenPtr& token = tokens[position];
+  for (const std::expected<std::filesystem::path, PreprocessorError>& dep_path_result :
+       ScanImports(tokens, import_positions)) {
+    if (!dep_path_result) {
+      return std::unexpected(dep_path_result.error());
+    }
+
+    const std::filesystem::path& dep_path = dep_path_result.value();
+    file_graph_.AddDependency(file, dep_path);
 
-    if (token->GetLexeme() == "#import") {
-      std::expected<std::filesystem::path, PreprocessorError> dep_path_result = ResolveImportPath(position, tokens);
+    if (visited_.count(dep_path) == 0) {
+      std::expected<void, PreprocessorError> sub_result = load_dependency(dep_path);
 
-      if (!dep_path_result) {
-        return std::unexpected(dep_path_result.error());
+      if (!sub_result) {
+        return sub_result;
       }
+    }
+  }
 
-      const std::filesystem::path& dep_path = dep_path_result.value();
-      file_graph_.AddDependency(file, dep_path);
+  return {};
+}
 
-      if (file_to_tokens_.count(dep_path) == 0) {
-        std::expected<std::string, PreprocessorError> content_result = ReadFileToString(dep_path);
+std::size_t TokenImportProcessor::ImportThreadCount() const noexcept {
+  if (import_threads_ != 0) {
+    return import_threads_;
+  }
 
-        if (!content_result) {
-          return std::unexpected(content_result.error());
-        }
+  return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
 
-        std::string content_str = std::move(content_result.value());
-        std::string_view content_view(content_str);
+std::expected<void, PreprocessorError> TokenImportProcessor::GatherDependenciesInParallel(
+    const TokenSequence& main_tokens, const ImportScanner& scan) {
+  std::map<std::filesystem::path, DiscoveredImports> discovered;
+  discovered[main_file_].imports = ScanImports(main_tokens, FindImportTokens(main_tokens));
+  DiscoverImports(discovered, ImportThreadCount(), scan);
 
-        lexer::Lexer lexer(content_view, false);
-        auto raw_tokens_result = lexer.Tokenize();
+  return ReplayDiscovery(main_file_, discovered);
+}
 
-        if (!raw_tokens_result) {
-          return std::unexpected(
-              PreprocessorError("Lexer error for " + dep_path.string() + ": " + raw_tokens_result.error().what()));
-        }
+std::expected<void, PreprocessorError> TokenImportProcessor::ReplayDiscovery(
+    const std::filesystem::path& file, const std::map<std::filesystem::path, DiscoveredImports>& discovered) {
+  if (visited_.count(file) != 0) {
+    return {};
+  }
 
-        std::vector<TokenPtr> raw_tokens = std::move(raw_tokens_result.value());
+  visited_.insert(file);
 
-        std::expected<void, PreprocessorError> sub_result = GatherDependencies(dep_path, raw_tokens);
+  for (const std::expected<std::filesystem::path, PreprocessorError>& dep_path_result : discovered.at(file).imports) {
+    if (!dep_path_result) {
+      return std::unexpected(dep_path_result.error());
+    }
 
-        if (!sub_result) {
-          return sub_result;
-        }
+    const std::filesystem::path& dep_path = dep_path_result.value();
+    file_graph_.AddDependency(file, dep_path);
+
+    if (visited_.count(dep_path) == 0) {
+      if (const DiscoveredImports& dependency = discovered.at(dep_path); dependency.load_error.has_value()) {
+        return std::unexpected(dependency.load_error.value());
       }
 
-      position += 2;
-      continue;
-    }
+      std::expected<void, PreprocessorError> sub_result = ReplayDiscovery(dep_path, discovered);
 
-    ++position;
+      if (!sub_result) {
+        return sub_result;
+      }
+    }
   }
 
   return {};
 }
 
-std::vector<TokenPtr> TokenImportProcessor::ConcatenateTokens(const std::vector<std::filesystem::path>& order) const {
-  std::vector<TokenPtr> total;
+std::vector<std::expected<std::filesystem::path, PreprocessorError>> TokenImportProcessor::ScanImports(
+    const TokenSequence& tokens, const std::vector<size_t>& import_positions) const {
+  std::vector<std::expected<std::filesystem::path, PreprocessorError>> imports;
+
+  for (const size_t position : import_positions) {
+    imports.push_back(ResolveImportPath(position, tokens));
+
+    if (!imports.back()) {
+      break;
+    }
+  }
+
+  return imports;
+}
+
+std::expected<std::vector<size_t>, PreprocessorError> TokenImportProcessor::LexImport(
+    const std::filesystem::path& dep_path,
+    std::string_view text,
+    lexer::TokenBuffer& out,
+    const lexer::ParallelLexOptions& lex_options) const {
+  if (token_cache_ != nullptr) {
+    auto imports_result = token_cache_->TokenizeInto(text, out, lex_options);
+
+    if (!imports_result) {
+      return std::unexpected(MakeLexerError(dep_path, imports_result.error()));
+    }
+
+    return {std::move(imports_result.value())};
+  }
+
+  if (auto lex_result = lexer::TokenizeIntoParallel(text, out, false, lex_options); !lex_result) {
+    return std::unexpected(MakeLexerError(dep_path, lex_result.error()));
+  }
+
+  return FindImportTokens(BufferTokenSequence(out));
+}
+
+TokenSelection TokenImportProcessor::SelectFiles(const std::vector<std::filesystem::path>& order,
+                                                 const TokenSequence& main_tokens) const {
+  TokenSelection selection;
 
   for (const std::filesystem::path& path : order) {
-    auto it = file_to_tokens_.find(path);
+    const bool last = path == order.back();
 
-    if (it != file_to_tokens_.end()) {
-      total.insert(total.end(), it->second.begin(), it->second.end());
+    if (path == main_file_) {
+      selection.KeepInput(SelectNonImportTokens(main_tokens, last));
+    } else if (auto it = file_to_buffer_.find(path); it != file_to_buffer_.end()) {
+      selection.Keep(it->second, SelectNonImportTokens(BufferTokenSequence(*it->second), last));
     }
   }
 
-  return total;
+  return selection;
 }
 
-std::vector<TokenPtr> TokenImportProcessor::RemoveExtraTokens(const std::vector<TokenPtr>& tokens) const {
-  std::vector<TokenPtr> cleaned;
+std::vector<size_t> TokenImportProcessor::SelectNonImportTokens(const TokenSequence& tokens, bool keep_final_eof) {
+  std::vector<size_t> kept;
+  kept.reserve(tokens.Size());
   size_t i = 0;
 
-  while (i < tokens.size()) {
-    const TokenPtr& token = tokens[i];
-
-    if (token->GetLexeme() == "#import") {
-      if (i + 1 < tokens.size() && tokens[i + 1]->GetStringType() == "LITERAL:String") {
-        if (i + 2 >= tokens.size() || tokens[i + 2]->GetStringType() == "EOF") {
+  while (i < tokens.Size()) {
+    if (tokens.LexemeIs(i, "#import")) {
+      if (i + 1 < tokens.Size() && tokens.IsKind(i + 1, lexer::TokenKind::kStringLiteral)) {
+        if (i + 2 >= tokens.Size() || tokens.IsKind(i + 2, lexer::TokenKind::kEof)) {
           i += 2;
         } else {
           i += 3;
         }
       } else {
-        cleaned.push_back(token);
+        kept.push_back(i);
         ++i;
       }
     } else {
-      if (token->GetStringType() != "EOF" || i == tokens.size() - 1) {
-        cleaned.push_back(token);
+      if (!tokens.IsKind(i, lexer::TokenKind::kEof) || (keep_final_eof && i == tokens.Size() - 1)) {
+        kept.push_back(i);
       }
 
       ++i;
     }
   }
 
-  return cleaned;
+  return kept;
 }
 
 std::expected<std::filesystem::path, PreprocessorError> TokenImportProcessor::ResolveImportPath(
-    size_t pos, const std::vector<TokenPtr>& tokens) {
-  const TokenPtr& token = tokens[pos];
+    size_t pos, const TokenSequence& tokens) const {
+  const std::string location = std::to_string(tokens.Line(pos)) + ":" + std::to_string(tokens.Column(pos));
 
-  if (pos + 1 >= tokens.size()) {
-    return std::unexpected(InvalidImportError("Missing path after #import at " +
-                                              std::to_string(token->GetPosition().GetLine()) + ":" +
-                                              std::to_string(token->GetPosition().GetColumn())));
+  if (pos + 1 >= tokens.Size()) {
+    return std::unexpected(InvalidImportError("Missing path after #import at " + location));
   }
 
-  const TokenPtr& path_token = tokens[pos + 1];
-
-  if (path_token->GetStringType() != "LITERAL:String") {
-    return std::unexpected(InvalidImportError("Expected string literal after #import at " +
-                                              std::to_string(token->GetPosition().GetLine()) + ":" +
-                                              std::to_string(token->GetPosition().GetColumn())));
+  if (!tokens.IsKind(pos + 1, lexer::TokenKind::kStringLiteral)) {
+    return std::unexpected(InvalidImportError("Expected string literal after #import at " + location));
   }
 
-  if (pos + 2 >= tokens.size() ||
-      !(tokens[pos + 2]->GetStringType() == "EOF" || tokens[pos + 2]->GetStringType() == "NEWLINE" ||
-        tokens[pos + 2]->GetLexeme() == ";")) {
-    return std::unexpected(InvalidImportError("Unexpected token after #import at " +
-                                              std::to_string(token->GetPosition().GetLine()) + ":" +
-                                              std::to_string(token->GetPosition().GetColumn())));
+  if (pos + 2 >= tokens.Size() ||
+      !(tokens.IsKind(pos + 2, lexer::TokenKind::kEof) || tokens.IsKind(pos + 2, lexer::TokenKind::kNewline) ||
+        tokens.LexemeIs(pos + 2, ";"))) {
+    return std::unexpected(InvalidImportError("Unexpected token after #import at " + location));
   }
 
-  const std::string& import_lexeme = path_token->GetLexeme();
+  const std::string import_lexeme = tokens.Lexeme(pos + 1);
 
   if (import_lexeme.size() < 2 || import_lexeme[0] != '"' || import_lexeme.back() != import_lexeme[0]) {
     return std::unexpected(InvalidImportError("Invalid quote in " + import_lexeme));
   }
 
   std::string name = import_lexeme.substr(1, import_lexeme.size() - 2);
-  std::filesystem::path candidate;
 
-  for (const std::filesystem::path& inc : include_paths_) {
-    candidate = inc / name;
-
-    if (std::filesystem::exists(candidate)) {
-      return candidate;
-    }
+  if (std::optional<std::filesystem::path> resolved = include_resolver_->Resolve(include_paths_, name)) {
+    return {std::move(resolved.value())};
   }
 
   return std::unexpected(PreprocessorError("Import not found: " + name));
@@ -1,52 +1,108 @@
 #ifndef PREPROCESSOR_TOKENIMPORTPROCESSOR_HPP_
 #define PREPROCESSOR_TOKENIMPORTPROCESSOR_HPP_
 
+#include <cstddef>
 #include <expected>
 #include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
-#include <tokens/Token.hpp>
-
 #include "FileGraph.hpp"
+#include "IncludeResolver.hpp"
+#include "TokenCache.hpp"
+#include "import_discovery.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+#include "lib/lexer/parallel_lexer.hpp"
 #include "lib/preprocessor/PreprocessorError.hpp"
 #include "lib/preprocessor/TokenProcessor.hpp"
+#include "lib/preprocessor/token_sequences/TokenSelection.hpp"
+#include "lib/preprocessor/token_sequences/TokenSequence.hpp"
 
 namespace ovum::compiler::preprocessor {
 
+// Replaces #import lines by emitting every reachable file once, dependencies first. Imports are unconditional: an
+// imported file lands ahead of its importer, outside any #ifdef around the #import, so directives never decide
+// whether a file is loaded. Imported files are lexed into token buffers loaded through the given SourceManager.
 class TokenImportProcessor : public TokenProcessor {
 public:
-  TokenImportProcessor(std::filesystem::path main_file, const std::set<std::filesystem::path>& include_paths);
-
-  [[nodiscard]] std::expected<std::vector<TokenPtr>, PreprocessorError> Process(
-      const std::vector<TokenPtr>& tokens) override;
-
-  [[nodiscard]] const std::unordered_map<std::filesystem::path, std::vector<TokenPtr>>& GetFileToTokens() const;
+  // With import_threads other than 1, imports are read and lexed on a work queue of that many threads (0 picks
+  // std::thread::hardware_concurrency()); the result, including which error is reported, matches serial discovery.
+  // A non-empty token_cache_dir serves imports whose content was lexed before from a TokenCache there. Imports are
+  // resolved through include_resolver, or through a resolver of this processor's own when it is null.
+  TokenImportProcessor(std::filesystem::path main_file,
+                       const std::set<std::filesystem::path>& include_paths,
+                       std::size_t import_threads = 1,
+                       const std::filesystem::path& token_cache_dir = {},
+                       std::shared_ptr<IncludeResolver> include_resolver = nullptr);
+
+  // The imported files' buffers are shared with the selection, so nothing is concatenated here.
+  [[nodiscard]] std::expected<TokenSelection, PreprocessorError> Select(const TokenSequence& tokens,
+                                                                        lexer::SourceManager& sources) override;
 
   [[nodiscard]] const std::map<std::filesystem::path, std::set<std::filesystem::path>>& GetDependencyGraph() const;
 
 private:
+  // Lexes a newly discovered dependency, stores its tokens and gathers its own dependencies.
+  using DependencyLoader = std::function<std::expected<void, PreprocessorError>(const std::filesystem::path&)>;
+
   std::filesystem::path main_file_;
   std::set<std::filesystem::path> include_paths_;
+  std::shared_ptr<IncludeResolver> include_resolver_;
+  std::size_t import_threads_;
+  std::unique_ptr<TokenCache> token_cache_;
 
-  std::unordered_map<std::filesystem::path, std::vector<TokenPtr>> file_to_tokens_;
+  std::unordered_map<std::filesystem::path, std::shared_ptr<lexer::TokenBuffer>> file_to_buffer_;
   FileGraph file_graph_;
   std::unordered_set<std::filesystem::path> visited_;
 
-  [[nodiscard]] std::expected<std::string, PreprocessorError> ReadFileToString(const std::filesystem::path& file);
+  void Reset();
+
+  [[nodiscard]] std::expected<std::vector<std::filesystem::path>, PreprocessorError> OrderFiles() const;
 
   [[nodiscard]] std::expected<void, PreprocessorError> GatherDependencies(const std::filesystem::path& file,
-                                                                          const std::vector<TokenPtr>& tokens);
+                                                                          const TokenSequence& tokens,
+                                                                          const std::vector<size_t>& import_positions,
+                                                                          const DependencyLoader& load_dependency);
+
+  [[nodiscard]] std::size_t ImportThreadCount() const noexcept;
+
+  // Discovers the whole import graph on the work queue, then replays it in the order GatherDependencies walks it.
+  [[nodiscard]] std::expected<void, PreprocessorError> GatherDependenciesInParallel(const TokenSequence& main_tokens,
+                                                                                    const ImportScanner& scan);
+
+  [[nodiscard]] std::expected<void, PreprocessorError> ReplayDiscovery(
+      const std::filesystem::path& file, const std::map<std::filesystem::path, DiscoveredImports>& discovered);
+
+  // Resolves the imports at import_positions (see FindImportTokens), stopping at the first that fails.
+  [[nodiscard]] std::vector<std::expected<std::filesystem::path, PreprocessorError>> ScanImports(
+      const TokenSequence& tokens, const std::vector<size_t>& import_positions) const;
+
+  // Lexes an imported file with lex_options, through the token cache when there is one, and returns its #import
+  // positions.
+  [[nodiscard]] std::expected<std::vector<size_t>, PreprocessorError> LexImport(
+      const std::filesystem::path& dep_path,
+      std::string_view text,
+      lexer::TokenBuffer& out,
+      const lexer::ParallelLexOptions& lex_options) const;
 
-  [[nodiscard]] std::vector<TokenPtr> ConcatenateTokens(const std::vector<std::filesystem::path>& order) const;
+  // Keeps the tokens of every file in order, main_tokens standing for main_file_, without their #import lines and
+  // all but the final end of file token.
+  [[nodiscard]] TokenSelection SelectFiles(const std::vector<std::filesystem::path>& order,
+                                           const TokenSequence& main_tokens) const;
 
-  [[nodiscard]] std::vector<TokenPtr> RemoveExtraTokens(const std::vector<TokenPtr>& tokens) const;
+  // Indices of the tokens left once #import lines and end of file tokens are dropped; the final end of file token
+  // stays when keep_final_eof is set.
+  [[nodiscard]] static std::vector<size_t> SelectNonImportTokens(const TokenSequence& tokens, bool keep_final_eof);
 
   [[nodiscard]] std::expected<std::filesystem::path, PreprocessorError> ResolveImportPath(
-      size_t token_index, const std::vector<TokenPtr>& tokens);
+      size_t token_index, const TokenSequence& tokens) const;
 };
 
 } // namespace ovum::compiler::preprocessor
@@ -0,0 +1,96 @@
+#include "import_discovery.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace ovum::compiler::preprocessor {
+
+std::vector<std::size_t> FindImportTokens(const TokenSequence& tokens) {
+  std::vector<std::size_t> imports;
+  std::size_t position = 0;
+
+  while (position < tokens.Size()) {
+    if (tokens.LexemeIs(position, "#import")) {
+      imports.push_back(position);
+      position += 2;
+      continue;
+    }
+
+    ++position;
+  }
+
+  return imports;
+}
+
+void DiscoverImports(std::map<std::filesystem::path, DiscoveredImports>& discovered,
+                     std::size_t threads,
+                     const ImportScanner& scan) {
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::deque<std::filesystem::path> queue;
+  std::size_t in_flight = 0;
+
+  // Called with the mutex held once workers are running.
+  auto enqueue_new = [&discovered, &queue](const DiscoveredImports& found) {
+    for (const auto& import : found.imports) {
+      if (import && discovered.try_emplace(import.value()).second) {
+        queue.push_back(import.value());
+      }
+    }
+  };
+
+  std::vector<const DiscoveredImports*> seeds;
+
+  for (const auto& [_, found] : discovered) {
+    seeds.push_back(&found);
+  }
+
+  for (const DiscoveredImports* found : seeds) {
+    enqueue_new(*found);
+  }
+
+  auto worker = [&]() {
+    std::unique_lock lock(mutex);
+
+    while (true) {
+      changed.wait(lock, [&]() { return !queue.empty() || in_flight == 0; });
+
+      if (queue.empty()) {
+        return;
+      }
+
+      std::filesystem::path file = std::move(queue.front());
+      queue.pop_front();
+      ++in_flight;
+      lock.unlock();
+
+      DiscoveredImports found = scan(file);
+
+      lock.lock();
+      --in_flight;
+      enqueue_new(found);
+      discovered[file] = std::move(found);
+      changed.notify_all();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  const std::size_t used_threads = std::max<std::size_t>(1, threads);
+  workers.reserve(used_threads - 1);
+
+  for (std::size_t i = 1; i < used_threads; ++i) {
+    workers.emplace_back(worker);
+  }
+
+  worker();
+
+  for (std::thread& thread : workers) {
+    thread.join();
+  }
+}
+
+} // namespace ovum::compiler::preprocessor
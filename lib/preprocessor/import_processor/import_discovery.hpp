@@ -0,0 +1,39 @@
+#ifndef PREPROCESSOR_IMPORT_DISCOVERY_HPP_
+#define PREPROCESSOR_IMPORT_DISCOVERY_HPP_
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "lib/preprocessor/PreprocessorError.hpp"
+#include "lib/preprocessor/token_sequences/TokenSequence.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+// What reading, lexing and scanning one file found. imports are in source order and end at the first import that
+// could not be resolved, which is then the last entry.
+struct DiscoveredImports {
+  std::optional<PreprocessorError> load_error;
+  std::vector<std::expected<std::filesystem::path, PreprocessorError>> imports;
+};
+
+// Indices of the #import directives in tokens, in source order.
+[[nodiscard]] std::vector<std::size_t> FindImportTokens(const TokenSequence& tokens);
+
+// Reads, lexes and scans one file; called concurrently for different files.
+using ImportScanner = std::function<DiscoveredImports(const std::filesystem::path&)>;
+
+// Scans every file reachable through the imports already recorded in discovered, on up to threads threads: a worker
+// takes a file from the queue, scans it and queues the imports nobody has seen yet. Each file is scanned once and
+// stored by path, so the result does not depend on scheduling.
+void DiscoverImports(std::map<std::filesystem::path, DiscoveredImports>& discovered,
+                     std::size_t threads,
+                     const ImportScanner& scan);
+
+} // namespace ovum::compiler::preprocessor
+
+#endif // PREPROCESSOR_IMPORT_DISCOVERY_HPP_
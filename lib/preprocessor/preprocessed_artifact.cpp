@@ -0,0 +1,172 @@
+#include "preprocessed_artifact.hpp"
+
+#include <array>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "lib/preprocessor/binary_io.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+namespace {
+
+constexpr std::array<char, 4> kArtifactMagic{'O', 'V', 'P', 'P'};
+constexpr uint32_t kByteOrderMark = 0x01020304U;
+
+FileReadError MalformedArtifactError(const std::filesystem::path& file, const std::string& reason) {
+  return FileReadError(file.string(), "not a usable preprocessed token file (" + reason + ")");
+}
+
+} // namespace
+
+std::expected<void, PreprocessorError> WritePreprocessedArtifact(const lexer::TokenBuffer& tokens,
+                                                                 const std::filesystem::path& file) {
+  std::string data;
+  size_t source_bytes = 0;
+
+  for (lexer::TokenBuffer::SourceIndex source = 0; source < tokens.SourceCount(); ++source) {
+    source_bytes += sizeof(uint64_t) + tokens.Source(source).size();
+  }
+
+  data.reserve(kArtifactMagic.size() + sizeof(uint32_t) * 3 + sizeof(uint64_t) + source_bytes +
+               tokens.Size() * (sizeof(lexer::TokenKind) + sizeof(uint32_t) * 3));
+  data.append(kArtifactMagic.data(), kArtifactMagic.size());
+  WriteBinary(data, kPreprocessedArtifactVersion);
+  WriteBinary(data, kByteOrderMark);
+  WriteBinary(data, static_cast<uint32_t>(tokens.SourceCount()));
+  WriteBinary(data, static_cast<uint64_t>(tokens.Size()));
+
+  for (lexer::TokenBuffer::SourceIndex source = 0; source < tokens.SourceCount(); ++source) {
+    const std::string_view text = tokens.Source(source);
+    WriteBinary(data, static_cast<uint64_t>(text.size()));
+    data.append(text);
+  }
+
+  for (size_t i = 0; i < tokens.Size(); ++i) {
+    WriteBinary(data, tokens.Kind(i));
+  }
+
+  for (size_t i = 0; i < tokens.Size(); ++i) {
+    WriteBinary(data, tokens.Offset(i));
+  }
+
+  for (size_t i = 0; i < tokens.Size(); ++i) {
+    WriteBinary(data, tokens.Length(i));
+  }
+
+  for (size_t i = 0; i < tokens.Size(); ++i) {
+    WriteBinary(data, tokens.SourceOf(i));
+  }
+
+  std::ofstream file_stream(file, std::ios::binary | std::ios::trunc);
+
+  if (!file_stream.is_open() || !file_stream.write(data.data(), static_cast<std::streamsize>(data.size()))) {
+    return std::unexpected(FileWriteError(file.string()));
+  }
+
+  return {};
+}
+
+std::expected<lexer::TokenBuffer, PreprocessorError> ReadPreprocessedArtifact(const std::filesystem::path& file,
+                                                                             lexer::SourceManager& sources) {
+  if (!std::filesystem::exists(file)) {
+    return std::unexpected(FileNotFoundError(file.string()));
+  }
+
+  std::expected<const lexer::SourceBuffer*, lexer::LexerError> load_result = sources.Load(file);
+
+  if (!load_result) {
+    return std::unexpected(FileReadError(file.string(), load_result.error().what()));
+  }
+
+  BinaryReader reader(load_result.value()->Text());
+  std::array<char, kArtifactMagic.size()> magic{};
+  uint32_t version = 0;
+  uint32_t byte_order = 0;
+  uint32_t source_count = 0;
+  uint64_t token_count = 0;
+
+  for (char& c : magic) {
+    if (!reader.Read(c)) {
+      return std::unexpected(MalformedArtifactError(file, "truncated header"));
+    }
+  }
+
+  if (magic != kArtifactMagic || !reader.Read(version) || !reader.Read(byte_order) || byte_order != kByteOrderMark) {
+    return std::unexpected(MalformedArtifactError(file, "bad header"));
+  }
+
+  if (version != kPreprocessedArtifactVersion) {
+    return std::unexpected(MalformedArtifactError(file, "version " + std::to_string(version) + ", expected " +
+                                                            std::to_string(kPreprocessedArtifactVersion)));
+  }
+
+  // Counts come from the file, so check them against its size before allocating anything.
+  if (!reader.Read(source_count) || !reader.Read(token_count) || source_count > reader.Remaining() ||
+      token_count > reader.Remaining()) {
+    return std::unexpected(MalformedArtifactError(file, "bad counts"));
+  }
+
+  lexer::TokenBuffer tokens;
+  std::vector<std::string_view> texts(source_count);
+
+  for (std::string_view& text : texts) {
+    uint64_t size = 0;
+
+    if (!reader.Read(size) || size > reader.Remaining() || !reader.ReadBytes(size, text)) {
+      return std::unexpected(MalformedArtifactError(file, "truncated source"));
+    }
+
+    tokens.AddSource(text);
+  }
+
+  std::vector<lexer::TokenView> views(token_count);
+  std::vector<lexer::TokenBuffer::SourceIndex> source_of(token_count);
+
+  for (lexer::TokenView& view : views) {
+    if (!reader.Read(view.kind) || view.kind > lexer::TokenKind::kBoolLiteral) {
+      return std::unexpected(MalformedArtifactError(file, "bad token kind"));
+    }
+  }
+
+  // The parser reads up to the end of file token, so a buffer without one cannot be parsed.
+  if (views.empty() || views.back().kind != lexer::TokenKind::kEof) {
+    return std::unexpected(MalformedArtifactError(file, "missing end of file token"));
+  }
+
+  for (lexer::TokenView& view : views) {
+    if (!reader.Read(view.offset)) {
+      return std::unexpected(MalformedArtifactError(file, "truncated offsets"));
+    }
+  }
+
+  for (lexer::TokenView& view : views) {
+    if (!reader.Read(view.length)) {
+      return std::unexpected(MalformedArtifactError(file, "truncated lengths"));
+    }
+  }
+
+  for (size_t i = 0; i < views.size(); ++i) {
+    if (!reader.Read(source_of[i]) || source_of[i] >= source_count || views[i].offset > texts[source_of[i]].size() ||
+        views[i].length > texts[source_of[i]].size() - views[i].offset) {
+      return std::unexpected(MalformedArtifactError(file, "token outside its source"));
+    }
+  }
+
+  if (!reader.AtEnd()) {
+    return std::unexpected(MalformedArtifactError(file, "trailing bytes"));
+  }
+
+  tokens.Reserve(views.size());
+
+  for (size_t i = 0; i < views.size(); ++i) {
+    tokens.Append(views[i], source_of[i]);
+  }
+
+  return {std::move(tokens)};
+}
+
+} // namespace ovum::compiler::preprocessor
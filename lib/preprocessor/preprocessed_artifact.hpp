@@ -0,0 +1,30 @@
+#ifndef PREPROCESSOR_PREPROCESSED_ARTIFACT_HPP_
+#define PREPROCESSOR_PREPROCESSED_ARTIFACT_HPP_
+
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+
+#include "lib/lexer/TokenBuffer.hpp"
+#include "lib/lexer/source/SourceManager.hpp"
+#include "lib/preprocessor/PreprocessorError.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+// Bump whenever the lexer's output or the artifact layout changes; older artifacts are then rejected.
+inline constexpr uint32_t kPreprocessedArtifactVersion = 1;
+
+// Writes the output of Preprocessor::Process as a binary artifact: every source the tokens point into, followed by
+// each token's kind, offset, length and source as four arrays. Lines and columns are recomputed from the sources
+// on load, so lexemes, kinds and positions come back exactly.
+[[nodiscard]] std::expected<void, PreprocessorError> WritePreprocessedArtifact(const lexer::TokenBuffer& tokens,
+                                                                               const std::filesystem::path& file);
+
+// Maps an artifact through sources, which must outlive the returned buffer; token text is read from the mapping
+// in place. Every count, offset and length is checked, so a truncated or foreign file is an error, never a crash.
+[[nodiscard]] std::expected<lexer::TokenBuffer, PreprocessorError> ReadPreprocessedArtifact(
+    const std::filesystem::path& file, lexer::SourceManager& sources);
+
+} // namespace ovum::compiler::preprocessor
+
+#endif // PREPROCESSOR_PREPROCESSED_ARTIFACT_HPP_
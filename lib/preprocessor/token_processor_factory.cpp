@@ -9,7 +9,11 @@ std::vector<std::unique_ptr<TokenProcessor>> MakeTokenProcessors(const Preproces
   std::vector<std::unique_ptr<TokenProcessor>> processors;
 
   std::unique_ptr<TokenImportProcessor> import_processor =
-      std::make_unique<TokenImportProcessor>(parameters.main_file, parameters.include_paths);
+      std::make_unique<TokenImportProcessor>(parameters.main_file,
+                                             parameters.include_paths,
+                                             parameters.import_threads,
+                                             parameters.token_cache_dir,
+                                             parameters.include_resolver);
   processors.push_back(std::move(import_processor));
 
   std::unique_ptr<TokenDirectivesProcessor> directives_processor =
@@ -0,0 +1,32 @@
+#include "BufferTokenSequence.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+BufferTokenSequence::BufferTokenSequence(const lexer::TokenBuffer& tokens) : tokens_(tokens) {
+}
+
+size_t BufferTokenSequence::Size() const {
+  return tokens_.Size();
+}
+
+bool BufferTokenSequence::IsKind(size_t index, lexer::TokenKind kind) const {
+  return tokens_.Kind(index) == kind;
+}
+
+bool BufferTokenSequence::LexemeIs(size_t index, std::string_view lexeme) const {
+  return tokens_.Lexeme(index) == lexeme;
+}
+
+std::string BufferTokenSequence::Lexeme(size_t index) const {
+  return std::string(tokens_.Lexeme(index));
+}
+
+int32_t BufferTokenSequence::Line(size_t index) const {
+  return tokens_.Line(index);
+}
+
+int32_t BufferTokenSequence::Column(size_t index) const {
+  return tokens_.Column(index);
+}
+
+} // namespace ovum::compiler::preprocessor
@@ -0,0 +1,31 @@
+#ifndef PREPROCESSOR_BUFFERTOKENSEQUENCE_HPP_
+#define PREPROCESSOR_BUFFERTOKENSEQUENCE_HPP_
+
+#include "TokenSequence.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+class BufferTokenSequence : public TokenSequence {
+public:
+  explicit BufferTokenSequence(const lexer::TokenBuffer& tokens);
+
+  [[nodiscard]] size_t Size() const override;
+
+  [[nodiscard]] bool IsKind(size_t index, lexer::TokenKind kind) const override;
+
+  [[nodiscard]] bool LexemeIs(size_t index, std::string_view lexeme) const override;
+
+  [[nodiscard]] std::string Lexeme(size_t index) const override;
+
+  [[nodiscard]] int32_t Line(size_t index) const override;
+
+  [[nodiscard]] int32_t Column(size_t index) const override;
+
+private:
+  const lexer::TokenBuffer& tokens_;
+};
+
+} // namespace ovum::compiler::preprocessor
+
+#endif // PREPROCESSOR_BUFFERTOKENSEQUENCE_HPP_
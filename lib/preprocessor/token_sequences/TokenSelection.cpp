@@ -0,0 +1,103 @@
+#include "TokenSelection.hpp"
+
+#include <utility>
+
+#include "lib/lexer/token_materializer.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+void TokenSelection::KeepInput(const std::vector<size_t>& indices) {
+  AddRun(nullptr, indices);
+}
+
+void TokenSelection::Keep(std::shared_ptr<const lexer::TokenBuffer> file, const std::vector<size_t>& indices) {
+  AddRun(file.get(), indices);
+
+  if (files_.empty() || files_.back() != file) {
+    files_.push_back(std::move(file));
+  }
+}
+
+const std::vector<TokenSelection::Run>& TokenSelection::Runs() const noexcept {
+  return runs_;
+}
+
+size_t TokenSelection::Size() const noexcept {
+  return size_;
+}
+
+bool TokenSelection::IsWholeInput(size_t input_size) const noexcept {
+  if (runs_.empty()) {
+    return input_size == 0;
+  }
+
+  return runs_.size() == 1 && runs_[0].file == nullptr && runs_[0].begin == 0 && runs_[0].end == input_size;
+}
+
+lexer::TokenBuffer TokenSelection::Apply(lexer::TokenBuffer input) const {
+  if (IsWholeInput(input.Size())) {
+    return input;
+  }
+
+  // Select shares the input's sources, where AppendRange would register them again for every run.
+  if (files_.empty()) {
+    return input.Select(InputIndices());
+  }
+
+  lexer::TokenBuffer result;
+  result.Reserve(size_);
+
+  for (const Run& run : runs_) {
+    result.AppendRange(run.file != nullptr ? *run.file : input, run.begin, run.end);
+  }
+
+  return result;
+}
+
+std::vector<ovum::TokenPtr> TokenSelection::Apply(const std::vector<ovum::TokenPtr>& input) const {
+  if (IsWholeInput(input.size())) {
+    return input;
+  }
+
+  std::vector<ovum::TokenPtr> result;
+  result.reserve(size_);
+
+  for (const Run& run : runs_) {
+    for (size_t index = run.begin; index < run.end; ++index) {
+      if (run.file == nullptr) {
+        result.push_back(input[index]);
+      } else {
+        result.push_back(lexer::MaterializeToken(run.file->View(index), run.file->Source(run.file->SourceOf(index))));
+      }
+    }
+  }
+
+  return result;
+}
+
+void TokenSelection::AddRun(const lexer::TokenBuffer* file, const std::vector<size_t>& indices) {
+  for (const size_t index : indices) {
+    if (!runs_.empty() && runs_.back().file == file && runs_.back().end == index) {
+      ++runs_.back().end;
+    } else {
+      runs_.push_back(Run{.file = file, .begin = index, .end = index + 1});
+    }
+  }
+
+  size_ += indices.size();
+}
+
+std::vector<size_t> TokenSelection::InputIndices() const {
+  std::vector<size_t> indices;
+  indices.reserve(size_);
+
+  for (const Run& run : runs_) {
+    for (size_t index = run.begin; index < run.end; ++index) {
+      indices.push_back(index);
+    }
+  }
+
+  return indices;
+}
+
+} // namespace ovum::compiler::preprocessor
@@ -0,0 +1,56 @@
+#ifndef PREPROCESSOR_TOKENSELECTION_HPP_
+#define PREPROCESSOR_TOKENSELECTION_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <tokens/Token.hpp>
+
+#include "lib/lexer/TokenBuffer.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+// What a preprocessing pass keeps, in output order: runs of the sequence it was given and runs of token buffers it
+// brought in itself (imported files), which the selection keeps alive. Each representation builds its result from
+// the runs through Apply, so a pass is written once for all of them.
+class TokenSelection {
+public:
+  struct Run {
+    const lexer::TokenBuffer* file; // nullptr for the pass's input
+    size_t begin;
+    size_t end;
+  };
+
+  // Keeps the input tokens at the given strictly increasing indices.
+  void KeepInput(const std::vector<size_t>& indices);
+
+  // Keeps the tokens of file at the given strictly increasing indices.
+  void Keep(std::shared_ptr<const lexer::TokenBuffer> file, const std::vector<size_t>& indices);
+
+  [[nodiscard]] const std::vector<Run>& Runs() const noexcept;
+
+  [[nodiscard]] size_t Size() const noexcept;
+
+  // True when the selection is all of an input of input_size tokens, in order.
+  [[nodiscard]] bool IsWholeInput(size_t input_size) const noexcept;
+
+  // One flat buffer: the input itself when it is kept whole, otherwise each run copied once.
+  [[nodiscard]] lexer::TokenBuffer Apply(lexer::TokenBuffer input) const;
+
+  // Kept input tokens are shared with input, not copied; tokens of the pass's own buffers are built here.
+  [[nodiscard]] std::vector<ovum::TokenPtr> Apply(const std::vector<ovum::TokenPtr>& input) const;
+
+private:
+  void AddRun(const lexer::TokenBuffer* file, const std::vector<size_t>& indices);
+
+  [[nodiscard]] std::vector<size_t> InputIndices() const;
+
+  std::vector<std::shared_ptr<const lexer::TokenBuffer>> files_;
+  std::vector<Run> runs_;
+  size_t size_ = 0;
+};
+
+} // namespace ovum::compiler::preprocessor
+
+#endif // PREPROCESSOR_TOKENSELECTION_HPP_
@@ -0,0 +1,34 @@
+#ifndef PREPROCESSOR_TOKENSEQUENCE_HPP_
+#define PREPROCESSOR_TOKENSEQUENCE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "lib/lexer/TokenKind.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+// Index-based read access to the tokens a preprocessing pass walks, so every pass is written once and runs over
+// both std::vector<TokenPtr> and lexer::TokenBuffer. Passes report which indices survive instead of copying tokens.
+class TokenSequence { // NOLINT(cppcoreguidelines-special-member-functions)
+public:
+  virtual ~TokenSequence() = default;
+
+  [[nodiscard]] virtual size_t Size() const = 0;
+
+  [[nodiscard]] virtual bool IsKind(size_t index, lexer::TokenKind kind) const = 0;
+
+  [[nodiscard]] virtual bool LexemeIs(size_t index, std::string_view lexeme) const = 0;
+
+  [[nodiscard]] virtual std::string Lexeme(size_t index) const = 0;
+
+  [[nodiscard]] virtual int32_t Line(size_t index) const = 0;
+
+  [[nodiscard]] virtual int32_t Column(size_t index) const = 0;
+};
+
+} // namespace ovum::compiler::preprocessor
+
+#endif // PREPROCESSOR_TOKENSEQUENCE_HPP_
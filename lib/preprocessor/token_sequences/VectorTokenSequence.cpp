@@ -0,0 +1,39 @@
+#include "VectorTokenSequence.hpp"
+
+#include "lib/lexer/token_materializer.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+VectorTokenSequence::VectorTokenSequence(const std::vector<ovum::TokenPtr>& tokens) : tokens_(tokens) {
+  kinds_.reserve(tokens_.size());
+
+  for (const ovum::TokenPtr& token : tokens_) {
+    kinds_.push_back(lexer::TokenKindFromString(token->GetStringType()));
+  }
+}
+
+size_t VectorTokenSequence::Size() const {
+  return tokens_.size();
+}
+
+bool VectorTokenSequence::IsKind(size_t index, lexer::TokenKind kind) const {
+  return kinds_[index] == kind;
+}
+
+bool VectorTokenSequence::LexemeIs(size_t index, std::string_view lexeme) const {
+  return tokens_[index]->GetLexeme() == lexeme;
+}
+
+std::string VectorTokenSequence::Lexeme(size_t index) const {
+  return tokens_[index]->GetLexeme();
+}
+
+int32_t VectorTokenSequence::Line(size_t index) const {
+  return static_cast<int32_t>(tokens_[index]->GetPosition().GetLine());
+}
+
+int32_t VectorTokenSequence::Column(size_t index) const {
+  return static_cast<int32_t>(tokens_[index]->GetPosition().GetColumn());
+}
+
+} // namespace ovum::compiler::preprocessor
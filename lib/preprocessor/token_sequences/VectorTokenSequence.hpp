@@ -0,0 +1,37 @@
+#ifndef PREPROCESSOR_VECTORTOKENSEQUENCE_HPP_
+#define PREPROCESSOR_VECTORTOKENSEQUENCE_HPP_
+
+#include <optional>
+#include <vector>
+
+#include <tokens/Token.hpp>
+
+#include "TokenSequence.hpp"
+
+namespace ovum::compiler::preprocessor {
+
+// Token kinds are resolved from the type strings once, when the sequence is built.
+class VectorTokenSequence : public TokenSequence {
+public:
+  explicit VectorTokenSequence(const std::vector<ovum::TokenPtr>& tokens);
+
+  [[nodiscard]] size_t Size() const override;
+
+  [[nodiscard]] bool IsKind(size_t index, lexer::TokenKind kind) const override;
+
+  [[nodiscard]] bool LexemeIs(size_t index, std::string_view lexeme) const override;
+
+  [[nodiscard]] std::string Lexeme(size_t index) const override;
+
+  [[nodiscard]] int32_t Line(size_t index) const override;
+
+  [[nodiscard]] int32_t Column(size_t index) const override;
+
+private:
+  const std::vector<ovum::TokenPtr>& tokens_;
+  std::vector<std::optional<lexer::TokenKind>> kinds_;
+};
+
+} // namespace ovum::compiler::preprocessor
+
+#endif // PREPROCESSOR_VECTORTOKENSEQUENCE_HPP_
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "lib/lexer/Lexer.hpp"
+#include "lib/lexer/ViewLexer.hpp"
+#include "lib/lexer/scan_kernels.hpp"
+
+using ovum::compiler::lexer::ActiveSimdLevel;
+using ovum::compiler::lexer::DetectSimdLevel;
+using ovum::compiler::lexer::Lexer;
+using ovum::compiler::lexer::LexerEngine;
+using ovum::compiler::lexer::SetActiveSimdLevel;
+using ovum::compiler::lexer::SimdLevel;
+using ovum::compiler::lexer::ViewLexer;
+
+namespace {
+
+constexpr std::size_t kBenchmarkSourceBytes = 8U << 20U;
+constexpr int32_t kBenchmarkRounds = 5;
+
+// Programs from lexer_big_programs_tests, plus the comments and strings real modules carry around them.
+const std::vector<std::string> kBenchmarkPrograms = {
+    R"OVUM(fun WhileExample(n: int): int {
+var counter: int = 0
+while (counter < n) {
+  counter = counter + 1
+  if (counter % 2 == 0) continue
+  sys::Print(counter.ToString())
+}
+return counter
+}
+)OVUM",
+    R"OVUM(// Sums the non-negative prefix of the array.
+fun ForExample(arr: IntArray): int {
+var sum: int = 0
+for (num in arr) { if (num < 0) break sum = sum + num }
+return sum
+}
+)OVUM",
+    R"OVUM(/* Prints every row of the matrix until a zero shows up,
+   at most five elements per row. */
+fun NestedLoops(matrix: IntArrayArray): Void {
+for (row in matrix) {
+var i: int = 0
+while (i < row.Length()) {
+if (row[i] == 0) { continue }
+sys::Print(row[i].ToString())
+i = i + 1
+if (i > 5) break }
+}
+}
+)OVUM",
+    R"OVUM(fun ExampleFundamentals(): Void {
+  val i: int = 42
+  val f: float = 3.14
+  val b: byte = 255
+  val c: char = 'A'
+  val bl: bool = true
+  val p: pointer = null
+  sys::Print("Fundamental values: \"" + i.ToString() + "\" and a fairly long status message\n")
+  }
+)OVUM",
+};
+
+std::string MakeBenchmarkSource() {
+  std::string src;
+  src.reserve(kBenchmarkSourceBytes + kBenchmarkSourceBytes / 8);
+
+  while (src.size() < kBenchmarkSourceBytes) {
+    for (const std::string& program : kBenchmarkPrograms) {
+      src += program;
+    }
+  }
+
+  return src;
+}
+
+template<typename TokenizeFn>
+double MeasureMegabytesPerSecond(const std::string& src, TokenizeFn tokenize) {
+  double best_seconds = 0.0;
+
+  for (int32_t round = 0; round < kBenchmarkRounds; ++round) {
+    const auto start = std::chrono::steady_clock::now();
+    tokenize();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (round == 0 || elapsed.count() < best_seconds) {
+      best_seconds = elapsed.count();
+    }
+  }
+
+  return static_cast<double>(src.size()) / (1024.0 * 1024.0) / best_seconds;
+}
+
+const char* SimdLevelName(SimdLevel level) {
+  switch (level) {
+    case SimdLevel::kScalar:
+      return "scalar";
+    case SimdLevel::kSse2:
+      return "sse2";
+    case SimdLevel::kAvx2:
+      return "avx2";
+  }
+
+  return "unknown";
+}
+
+} // namespace
+
+// Run with --gtest_also_run_disabled_tests --gtest_filter='*LexerThroughput*' to print the numbers.
+TEST(LexerUnitTestSuite, DISABLED_LexerThroughput) {
+  const std::string src = MakeBenchmarkSource();
+  const SimdLevel detected = DetectSimdLevel();
+
+  for (const SimdLevel level : {SimdLevel::kScalar, SimdLevel::kSse2, SimdLevel::kAvx2}) {
+    SetActiveSimdLevel(level);
+
+    if (ActiveSimdLevel() != level) {
+      continue;
+    }
+
+    const double handlers_mbps = MeasureMegabytesPerSecond(src, [&src]() {
+      Lexer lexer(src, false, LexerEngine::kHandlers);
+      ASSERT_TRUE(lexer.Tokenize().has_value());
+    });
+    const double table_mbps = MeasureMegabytesPerSecond(src, [&src]() {
+      Lexer lexer(src, false, LexerEngine::kTable);
+      ASSERT_TRUE(lexer.Tokenize().has_value());
+    });
+    const double view_lexer_mbps = MeasureMegabytesPerSecond(src, [&src]() {
+      ViewLexer lexer(src);
+      ASSERT_TRUE(lexer.Tokenize().has_value());
+    });
+
+    std::cout << SimdLevelName(level) << ": Lexer (handlers) " << handlers_mbps << " MB/s, Lexer (table) "
+              << table_mbps << " MB/s, ViewLexer " << view_lexer_mbps << " MB/s\n";
+  }
+
+  SetActiveSimdLevel(detected);
+}
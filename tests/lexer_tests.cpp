@@ -1,10 +1,38 @@
 #include <gtest/gtest.h>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 #include "lib/lexer/Lexer.hpp"
+#include "lib/lexer/LineIndex.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+#include "lib/lexer/ViewLexer.hpp"
+#include "lib/lexer/parallel_lexer.hpp"
+#include "lib/lexer/handlers/PunctHandler.hpp"
+#include "lib/lexer/literal_decoder.hpp"
+#include "lib/lexer/scan_kernels.hpp"
+#include "lib/lexer/source/SourceManager.hpp"
+#include "lib/lexer/token_materializer.hpp"
 #include "test_suites/LexerUnitTestSuite.hpp"
 
+using ovum::compiler::lexer::DetectSimdLevel;
+using ovum::compiler::lexer::GetScanKernels;
 using ovum::compiler::lexer::Lexer;
+using ovum::compiler::lexer::LexerEngine;
+using ovum::compiler::lexer::LineIndex;
+using ovum::compiler::lexer::MaterializeTokens;
+using ovum::compiler::lexer::ParallelLexOptions;
+using ovum::compiler::lexer::ScanKernels;
+using ovum::compiler::lexer::ScanRun;
+using ovum::compiler::lexer::SetActiveSimdLevel;
+using ovum::compiler::lexer::SimdLevel;
+using ovum::compiler::lexer::SourceBuffer;
+using ovum::compiler::lexer::SourceManager;
+using ovum::compiler::lexer::TokenBuffer;
+using ovum::compiler::lexer::ViewLexer;
 
 TEST(LexerUnitTestSuite, EmptyString) {
   const std::string src = "";
@@ -455,3 +483,400 @@ fun Main(): Void {
   auto result = lexer.Tokenize();
   ASSERT_FALSE(result.has_value()) << "Expected lexer error";
 }
+
+TEST(LexerUnitTestSuite, ViewLexerMatchesLexer) {
+  const std::string src = R"OVUM(#import "sys"
+// line comment
+fun Main(args: StringArray): int {
+  val x: float = .5e3 + 1.25 - 2e-2 * Inf / NaN
+  val b: byte = 300b
+  val h: int = 0xFF << 0b101 >> 3
+  var s: String = "tab\t\"quoted\"\n"
+  val c: char = '\''
+  if (x >= 1 && !(x != 2) || x?.Foo() ?: null) { x += 1; x -= 2; x *= 3 }
+  /* block
+     comment */ sys::Print(s)
+  a := b
+  return 0
+})OVUM";
+  for (bool keep_comments : {false, true}) {
+    Lexer lexer(src, keep_comments);
+    auto expected = lexer.Tokenize();
+    ASSERT_TRUE(expected.has_value()) << expected.error().what();
+    ViewLexer view_lexer(src, keep_comments);
+    auto views = view_lexer.Tokenize();
+    ASSERT_TRUE(views.has_value()) << views.error().what();
+    LexerUnitTestSuite::AssertSameTokens(expected.value(), MaterializeTokens(views.value(), src));
+  }
+}
+
+TEST(LexerUnitTestSuite, ViewLexerReportsSameErrors) {
+  const std::vector<std::string> sources = {
+      "val x = 1e", "0x", "0b2", "0x1.5", "12abc", "1.2.3", "'ab'", "'\\z'", "\"abc", "\"a\nb\"", "#invalid", "@",
+      "/* open", "99999999999999999999"};
+  for (const auto& src : sources) {
+    Lexer lexer(src);
+    auto expected = lexer.Tokenize();
+    ViewLexer view_lexer(src);
+    auto views = view_lexer.Tokenize();
+    ASSERT_FALSE(expected.has_value()) << src;
+    ASSERT_FALSE(views.has_value()) << src;
+    EXPECT_STREQ(expected.error().what(), views.error().what()) << src;
+  }
+}
+
+TEST(LexerUnitTestSuite, SourceManagerLoadsFile) {
+  const std::filesystem::path path = std::filesystem::temp_directory_path() / "ovum_source_manager_test.ovum";
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << "val x: int = 42\n";
+  }
+  SourceManager manager;
+  auto buffer = manager.Load(path);
+  ASSERT_TRUE(buffer.has_value()) << buffer.error().what();
+  EXPECT_EQ(buffer.value()->Text(), "val x: int = 42\n");
+  EXPECT_EQ(manager.Load(path).value(), buffer.value());
+  EXPECT_EQ(manager.Size(), 1U);
+  EXPECT_FALSE(manager.Load(path.string() + ".missing").has_value());
+  std::filesystem::remove(path);
+}
+
+TEST(LexerUnitTestSuite, SourceBufferMapsRegularFilesAndReadsTheRest) {
+  const std::filesystem::path path = std::filesystem::temp_directory_path() / "ovum_source_buffer_test.ovum";
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << "fun Main(): int { return 0 }\n";
+  }
+  auto mapped = SourceBuffer::MapFile(path);
+  ASSERT_TRUE(mapped.has_value()) << mapped.error().what();
+  EXPECT_TRUE(mapped.value()->IsMapped());
+  EXPECT_EQ(mapped.value()->Text(), "fun Main(): int { return 0 }\n");
+  std::filesystem::remove(path);
+  auto special = SourceBuffer::MapFile("/dev/null");
+  ASSERT_TRUE(special.has_value()) << special.error().what();
+  EXPECT_FALSE(special.value()->IsMapped());
+  EXPECT_TRUE(special.value()->Text().empty());
+}
+
+TEST(LexerUnitTestSuite, NearKeywordsAreIdentifiers) {
+  const std::string src = "funs Class iff thiss nulls infinit NAN Nan True calls interfaces";
+  Lexer lexer(src);
+  auto tokens_result = lexer.Tokenize();
+  ASSERT_TRUE(tokens_result.has_value()) << "Tokenize failed: " << tokens_result.error().what();
+  auto items = LexerUnitTestSuite::ExtractLexemesAndTypes(tokens_result.value());
+  std::vector<std::string> expected_lexemes = {
+      "funs", "Class", "iff", "thiss", "nulls", "infinit", "NAN", "Nan", "True", "calls", "interfaces"};
+  std::vector<std::string> expected_types(expected_lexemes.size(), "IDENT");
+  LexerUnitTestSuite::AssertLexemesAndTypesEqual(items, expected_lexemes, expected_types);
+}
+
+TEST(LexerUnitTestSuite, ScanKernelsAgreeAcrossSimdLevels) {
+  const std::string src =
+      "identifier_with_a_rather_long_name_0123456789 \t\r \t\r \t\r \t\r \t\r \t\r \t\r \t\r x"
+      "\"a plain string body that is longer than one vector\\n\" tail\n"
+      "/* first\nsecond\n\n third line of a comment that keeps going for a while ** / */ end \x80\xff";
+  const ScanKernels& scalar = GetScanKernels(SimdLevel::kScalar);
+  for (const SimdLevel level : {SimdLevel::kSse2, SimdLevel::kAvx2}) {
+    const ScanKernels& vector = GetScanKernels(level);
+    for (size_t pos = 0; pos <= src.size(); ++pos) {
+      EXPECT_EQ(scalar.identifier_end(src, pos), vector.identifier_end(src, pos)) << pos;
+      EXPECT_EQ(scalar.whitespace_end(src, pos), vector.whitespace_end(src, pos)) << pos;
+      EXPECT_EQ(scalar.string_special(src, pos), vector.string_special(src, pos)) << pos;
+      EXPECT_EQ(scalar.line_end(src, pos), vector.line_end(src, pos)) << pos;
+      const ScanRun expected = scalar.next_star(src, pos);
+      const ScanRun actual = vector.next_star(src, pos);
+      EXPECT_EQ(expected.end, actual.end) << pos;
+      EXPECT_EQ(expected.newlines, actual.newlines) << pos;
+      if (expected.newlines != 0) {
+        EXPECT_EQ(expected.last_newline, actual.last_newline) << pos;
+      }
+    }
+  }
+}
+
+TEST(LexerUnitTestSuite, LexerOutputIndependentOfSimdLevel) {
+  const std::string src = R"OVUM(// a line comment that is long enough to cover several vector widths
+fun LongIdentifiersAndStrings(argument_number_one: int): String {
+  /* a block comment
+     spanning ** several
+     lines */ val message: String = "a string literal long enough to need more than one chunk \"quoted\" end"
+  return message
+})OVUM";
+  SetActiveSimdLevel(SimdLevel::kScalar);
+  Lexer scalar_lexer(src, true);
+  auto expected = scalar_lexer.Tokenize();
+  ASSERT_TRUE(expected.has_value()) << expected.error().what();
+  SetActiveSimdLevel(DetectSimdLevel());
+  Lexer lexer(src, true);
+  auto actual = lexer.Tokenize();
+  ASSERT_TRUE(actual.has_value()) << actual.error().what();
+  LexerUnitTestSuite::AssertSameTokens(expected.value(), actual.value());
+}
+
+TEST(LexerUnitTestSuite, TableEngineMatchesHandlerEngine) {
+  const std::string src = R"OVUM(#import "sys"
+// line comment
+fun Main(args: StringArray): int {
+  val x: float = .5e3 + 1.25 - 2e-2 * Inf / NaN % infinity
+  val b: byte = 300b
+  val h: int = 0xFF << 0b101 >> 3 ^ ~h
+  var s: String = "tab\t\"quoted\"\n"
+  val c: char = '\''
+  if (x >= 1 && !(x != 2) || x?.Foo() ?: null) { x += 1; x -= 2; x *= 3; x /= 4 }
+  /* block
+     comment */ sys::Print(s)
+  a := b == c <= d
+  return 0
+})OVUM";
+  for (bool keep_comments : {false, true}) {
+    Lexer handler_lexer(src, keep_comments, LexerEngine::kHandlers);
+    auto expected = handler_lexer.Tokenize();
+    ASSERT_TRUE(expected.has_value()) << expected.error().what();
+    Lexer table_lexer(src, keep_comments, LexerEngine::kTable);
+    auto actual = table_lexer.Tokenize();
+    ASSERT_TRUE(actual.has_value()) << actual.error().what();
+    LexerUnitTestSuite::AssertSameTokens(expected.value(), actual.value());
+  }
+}
+
+TEST(LexerUnitTestSuite, TableEngineReportsSameErrors) {
+  const std::vector<std::string> sources = {
+      "val x = 1e", "0x", "0b2", "0x1.5", "12abc", "1.2.3", "'ab'", "'\\z'", "\"abc", "\"a\nb\"", "#invalid", "@",
+      "/* open", "99999999999999999999", "val \x80"};
+  for (const auto& src : sources) {
+    Lexer handler_lexer(src, false, LexerEngine::kHandlers);
+    auto expected = handler_lexer.Tokenize();
+    Lexer table_lexer(src, false, LexerEngine::kTable);
+    auto actual = table_lexer.Tokenize();
+    ASSERT_FALSE(expected.has_value()) << src;
+    ASSERT_FALSE(actual.has_value()) << src;
+    EXPECT_STREQ(expected.error().what(), actual.error().what()) << src;
+  }
+}
+
+TEST(LexerUnitTestSuite, TableEngineHonoursCustomHandlers) {
+  const std::string src = "a @ b";
+  Lexer lexer(src, false, LexerEngine::kTable);
+  lexer.SetHandler('@', std::make_unique<ovum::compiler::lexer::PunctHandler>());
+  auto tokens_result = lexer.Tokenize();
+  ASSERT_TRUE(tokens_result.has_value()) << "Tokenize failed: " << tokens_result.error().what();
+  auto items = LexerUnitTestSuite::ExtractLexemesAndTypes(tokens_result.value());
+  std::vector<std::string> expected_lexemes = {"a", "@", "b"};
+  std::vector<std::string> expected_types = {"IDENT", "PUNCT", "IDENT"};
+  LexerUnitTestSuite::AssertLexemesAndTypesEqual(items, expected_lexemes, expected_types);
+}
+
+TEST(LexerUnitTestSuite, DecodeNumericLexemeWithoutExceptions) {
+  using ovum::compiler::lexer::DecodeNumericLexeme;
+  using ovum::compiler::lexer::NumericLiteralKind;
+  EXPECT_EQ(DecodeNumericLexeme("0x1B", false)->kind, NumericLiteralKind::kInt);
+  EXPECT_EQ(DecodeNumericLexeme("0x1B", false)->int_value, 27);
+  EXPECT_EQ(DecodeNumericLexeme("0b101", false)->int_value, 5);
+  EXPECT_EQ(DecodeNumericLexeme("300b", false)->kind, NumericLiteralKind::kByte);
+  EXPECT_EQ(DecodeNumericLexeme("300b", false)->int_value, 255);
+  EXPECT_DOUBLE_EQ(DecodeNumericLexeme(".5e3", true)->float_value, 500.0);
+  EXPECT_EQ(DecodeNumericLexeme("0.1", true)->float_value, 0.1L);
+  EXPECT_TRUE(std::isinf(DecodeNumericLexeme("Infinity", true)->float_value));
+  EXPECT_TRUE(std::isnan(DecodeNumericLexeme("NaN", true)->float_value));
+  EXPECT_FALSE(DecodeNumericLexeme("0xFFFFFFFFFFFFFFFFF", false).has_value());
+  EXPECT_FALSE(DecodeNumericLexeme("99999999999999999999", false).has_value());
+  EXPECT_FALSE(DecodeNumericLexeme("1e999", true).has_value());
+}
+
+TEST(LexerUnitTestSuite, MaterializeTokenHandsBackDecodedNumbers) {
+  using ovum::compiler::lexer::MaterializeToken;
+  using ovum::compiler::lexer::NumericLiteral;
+  using ovum::compiler::lexer::NumericLiteralKind;
+  const std::string src = "x = 0x1B + 300b * 3.5 + \"9\"";
+  auto views = ViewLexer(src).Tokenize();
+  ASSERT_TRUE(views.has_value()) << views.error().what();
+  for (const auto& view : views.value()) {
+    std::optional<NumericLiteral> number = NumericLiteral{};
+    const auto token = MaterializeToken(view, src, &number);
+    const std::string lexeme = token->GetLexeme();
+    if (lexeme == "0x1B") {
+      ASSERT_TRUE(number.has_value());
+      EXPECT_EQ(number->kind, NumericLiteralKind::kInt);
+      EXPECT_EQ(number->int_value, 27);
+    } else if (lexeme == "300b") {
+      ASSERT_TRUE(number.has_value());
+      EXPECT_EQ(number->kind, NumericLiteralKind::kByte);
+      EXPECT_EQ(number->int_value, 255);
+    } else if (lexeme == "3.5") {
+      ASSERT_TRUE(number.has_value());
+      EXPECT_EQ(number->kind, NumericLiteralKind::kFloat);
+      EXPECT_DOUBLE_EQ(number->float_value, 3.5);
+    } else {
+      EXPECT_FALSE(number.has_value()) << lexeme;
+    }
+  }
+}
+
+TEST(LexerUnitTestSuite, TokenBufferMatchesLexer) {
+  const std::string src = "fun Main(): int {\n  val s: String = \"hi\" // note\n  return 0x1F + 2.5e1\n}";
+  Lexer lexer(src);
+  auto expected = lexer.Tokenize();
+  ASSERT_TRUE(expected.has_value()) << expected.error().what();
+  TokenBuffer buffer;
+  ViewLexer view_lexer(src);
+  auto result = view_lexer.TokenizeInto(buffer);
+  ASSERT_TRUE(result.has_value()) << result.error().what();
+  ASSERT_EQ(buffer.SourceCount(), 1U);
+  LexerUnitTestSuite::AssertSameTokens(expected.value(), MaterializeTokens(buffer));
+  EXPECT_EQ(buffer.Lexeme(0), "fun");
+  EXPECT_EQ(buffer.Line(buffer.Size() - 2), 4);
+  EXPECT_GE(buffer.MemoryUsage(), buffer.Size() * 13);
+}
+
+TEST(LexerUnitTestSuite, TokenBufferAppendAndSelect) {
+  const std::string first = "a + b";
+  const std::string second = "c * d";
+  TokenBuffer lhs;
+  TokenBuffer rhs;
+  ASSERT_TRUE(ViewLexer(first).TokenizeInto(lhs).has_value());
+  ASSERT_TRUE(ViewLexer(second).TokenizeInto(rhs).has_value());
+  TokenBuffer joined;
+  joined.AppendRange(lhs, 0, lhs.Size() - 1);
+  joined.AppendRange(rhs, 0, rhs.Size());
+  joined.AppendRange(lhs, 1, 2);
+  ASSERT_EQ(joined.Size(), 8U);
+  EXPECT_EQ(joined.SourceCount(), 2U);
+  std::vector<std::string> lexemes;
+  for (size_t i = 0; i < joined.Size(); ++i) {
+    lexemes.emplace_back(joined.Lexeme(i));
+  }
+  EXPECT_EQ(lexemes, (std::vector<std::string>{"a", "+", "b", "c", "*", "d", "", "+"}));
+  TokenBuffer selected = joined.Select({0, 4, 7});
+  ASSERT_EQ(selected.Size(), 3U);
+  EXPECT_EQ(selected.Lexeme(0), "a");
+  EXPECT_EQ(selected.Lexeme(1), "*");
+  EXPECT_EQ(selected.Lexeme(2), "+");
+  EXPECT_EQ(selected.Kind(1), joined.Kind(4));
+}
+
+TEST(LexerUnitTestSuite, LineIndexMatchesTrackedPositions) {
+  std::string src = "fun Main(): int {\r\n\tval s = \"x\" // tail\n\n  return 0\n}\n";
+  src += std::string(70, ' ') + "x = 1\n";
+  ViewLexer tracked(src, true);
+  auto expected = tracked.Tokenize();
+  ASSERT_TRUE(expected.has_value()) << expected.error().what();
+  ViewLexer untracked(src, true, false);
+  auto views = untracked.Tokenize();
+  ASSERT_TRUE(views.has_value()) << views.error().what();
+  ASSERT_EQ(expected->size(), views->size());
+  const LineIndex lines(src);
+  EXPECT_EQ(lines.LineCount(), 7U);
+  EXPECT_EQ(lines.LineStart(2), src.find('\t'));
+  for (size_t i = 0; i < views->size(); ++i) {
+    const auto& view = views->at(i);
+    EXPECT_EQ(view.line, 0);
+    EXPECT_EQ(view.offset, expected->at(i).offset);
+    const auto position = lines.Locate(view.offset);
+    EXPECT_EQ(position.line, expected->at(i).line) << "token " << i;
+    if (view.kind != ovum::compiler::lexer::TokenKind::kComment) {
+      EXPECT_EQ(position.column, expected->at(i).column) << "token " << i;
+    }
+  }
+  TokenBuffer buffer;
+  ASSERT_TRUE(ViewLexer(src, true).TokenizeInto(buffer).has_value());
+  ASSERT_EQ(buffer.Size(), expected->size());
+  for (size_t i = 0; i < buffer.Size(); ++i) {
+    EXPECT_EQ(buffer.Line(i), expected->at(i).line) << "token " << i;
+    EXPECT_EQ(buffer.Column(i), expected->at(i).column) << "token " << i;
+  }
+  EXPECT_EQ(lines.Locate(src.size() + 10).line, 7);
+  EXPECT_EQ(LineIndex("").Locate(0).column, 1);
+}
+
+TEST(LexerUnitTestSuite, TokenBufferPlacesBlockCommentsLikeLexer) {
+  const std::string src = "val a = 1\n  /* first\n  second\n  third */ val b = 2 // tail\n";
+  auto expected = Lexer(src, true).Tokenize();
+  ASSERT_TRUE(expected.has_value()) << expected.error().what();
+  TokenBuffer buffer;
+  ASSERT_TRUE(ViewLexer(src, true).TokenizeInto(buffer).has_value());
+  ASSERT_EQ(buffer.Size(), expected->size());
+  for (size_t i = 0; i < buffer.Size(); ++i) {
+    EXPECT_EQ(buffer.Line(i), expected->at(i)->GetPosition().GetLine()) << "token " << i;
+    EXPECT_EQ(buffer.Column(i), expected->at(i)->GetPosition().GetColumn()) << "token " << i;
+  }
+  EXPECT_EQ(buffer.Kind(5), ovum::compiler::lexer::TokenKind::kComment);
+  EXPECT_EQ(buffer.Line(5), 4);
+  EXPECT_EQ(buffer.Column(5), 3);
+}
+
+namespace {
+
+std::string MakeParallelLexSource() {
+  std::string src;
+  for (int i = 0; i < 60; ++i) {
+    src += "fun F" + std::to_string(i) + "(x: int): float {\n";
+    src += "  val s = \"/* not a comment \\\" // still a string\"\n";
+    src += "  /* block\n   spanning \"lines\"\n */ val c = '\\''\n";
+    src += "  return x * 0x1F + 2.5e1 // tail\n}\n";
+  }
+  return src;
+}
+
+constexpr ParallelLexOptions kSmallChunks{.threshold = 0, .min_chunk = 64, .threads = 4};
+
+} // namespace
+
+TEST(LexerUnitTestSuite, ParallelViewsMatchSerialViews) {
+  const std::string src = MakeParallelLexSource();
+  auto expected = ViewLexer(src, true).Tokenize();
+  ASSERT_TRUE(expected.has_value()) << expected.error().what();
+  auto views = ovum::compiler::lexer::TokenizeViewsParallel(src, true, kSmallChunks);
+  ASSERT_TRUE(views.has_value()) << views.error().what();
+  ASSERT_EQ(views->size(), expected->size());
+  for (size_t i = 0; i < views->size(); ++i) {
+    EXPECT_EQ(views->at(i).kind, expected->at(i).kind) << "token " << i;
+    EXPECT_EQ(views->at(i).offset, expected->at(i).offset) << "token " << i;
+    EXPECT_EQ(views->at(i).length, expected->at(i).length) << "token " << i;
+    EXPECT_EQ(views->at(i).line, expected->at(i).line) << "token " << i;
+    EXPECT_EQ(views->at(i).column, expected->at(i).column) << "token " << i;
+  }
+  TokenBuffer serial;
+  TokenBuffer parallel;
+  ASSERT_TRUE(ViewLexer(src).TokenizeInto(serial).has_value());
+  ASSERT_TRUE(ovum::compiler::lexer::TokenizeIntoParallel(src, parallel, false, kSmallChunks).has_value());
+  LexerUnitTestSuite::AssertSameTokens(MaterializeTokens(serial), MaterializeTokens(parallel));
+}
+
+TEST(LexerUnitTestSuite, ParallelLexerMatchesSerialLexer) {
+  const std::string src = MakeParallelLexSource();
+  Lexer serial(src);
+  auto expected = serial.Tokenize();
+  ASSERT_TRUE(expected.has_value()) << expected.error().what();
+  Lexer parallel(src);
+  parallel.EnableParallel(kSmallChunks);
+  auto tokens = parallel.Tokenize();
+  ASSERT_TRUE(tokens.has_value()) << tokens.error().what();
+  LexerUnitTestSuite::AssertSameTokens(expected.value(), tokens.value());
+}
+
+TEST(LexerUnitTestSuite, ParallelLexerReportsSerialErrors) {
+  const std::string src = MakeParallelLexSource() + "val bad = \"unterminated\n" + MakeParallelLexSource();
+  auto expected = ViewLexer(src).Tokenize();
+  ASSERT_FALSE(expected.has_value());
+  auto views = ovum::compiler::lexer::TokenizeViewsParallel(src, false, kSmallChunks);
+  ASSERT_FALSE(views.has_value());
+  EXPECT_STREQ(views.error().what(), expected.error().what());
+}
+
+TEST(LexerUnitTestSuite, ParallelChunksNeverStartInsideComments) {
+  const std::string src = MakeParallelLexSource();
+  const auto starts = ovum::compiler::lexer::FindLexChunkStarts(src, 16);
+  ASSERT_GT(starts.size(), 1U);
+  EXPECT_EQ(starts.front().offset, 0U);
+  const LineIndex lines(src);
+  for (size_t i = 1; i < starts.size(); ++i) {
+    EXPECT_GT(starts[i].offset, starts[i - 1].offset);
+    EXPECT_EQ(src[starts[i].offset - 1], '\n');
+    EXPECT_EQ(lines.Locate(starts[i].offset).line, starts[i].line);
+    const size_t open = src.rfind("/*", starts[i].offset);
+    const size_t close = src.rfind("*/", starts[i].offset);
+    if (open != std::string::npos && src.compare(open - 9, 9, "val s = \"") != 0) {
+      EXPECT_TRUE(close != std::string::npos && close > open) << "chunk " << i;
+    }
+  }
+}
@@ -12,10 +12,13 @@ static const std::string kHelpMessage =
     "Ovum Compiler that compiles Ovum source code to Ovum Intermediate Language.\n\n"
     "OPTIONS:\n"
     "-D,  --define-symbols=<string>:  Defined symbols [repeated]\n"
+    "-E,  --emit-preprocessed=<CompositeString>:  Write the preprocessed tokens to this file and stop [repeated]\n"
     "-I,  --include-dirs=<CompositeString>:  Path to directories where include files are located [repeated]\n"
     "-m,  --main-file=<CompositeString>:  Path to the main file\n"
     "-o,  --output-file=<CompositeString>:  Path to the output file [default = Same as input file but with .oil "
     "extension]\n"
+    "-c,  --token-cache=<CompositeString>:  Directory where lexed imports are cached by content hash [repeated]\n"
+    "-P,  --from-preprocessed:  Main file is a token file written by --emit-preprocessed [repeated]\n"
     "-n,  --no-lint:  Disable linter [repeated]\n\n"
     "-h,  --help:  Display this help and exit\n";
 
@@ -124,3 +127,7 @@ TEST_F(ProjectIntegrationTestSuite, ExampleFileFile) {
 TEST_F(ProjectIntegrationTestSuite, IntegrationalFileQuadratic) {
   CompileAndCompareIntegrational("quadratic");
 }
+
+TEST_F(ProjectIntegrationTestSuite, IntegrationalFileQuadraticFromPreprocessed) {
+  CompileAndCompareIntegrationalFromPreprocessed("quadratic");
+}
@@ -0,0 +1,438 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "lib/lexer/TokenBuffer.hpp"
+#include "lib/lexer/parallel_lexer.hpp"
+#include "lib/parser/ParserFsm.hpp"
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
+#include "lib/parser/ast/nodes/class_members/MethodDecl.hpp"
+#include "lib/parser/ast/nodes/decls/ClassDecl.hpp"
+#include "lib/parser/ast/nodes/decls/FunctionDecl.hpp"
+#include "lib/parser/ast/BuilderAstFactory.hpp"
+#include "lib/parser/ast/visitors/BytecodeVisitor.hpp"
+#include "lib/parser/diagnostics/DiagnosticCollector.hpp"
+#include "lib/parser/parallel_parser.hpp"
+#include "lib/parser/pratt/DefaultOperatorResolver.hpp"
+#include "lib/parser/pratt/PrattExpressionParser.hpp"
+#include "lib/parser/type_parser/QNameTypeParser.hpp"
+
+using ovum::compiler::lexer::TokenBuffer;
+using ovum::compiler::lexer::TokenizeIntoParallel;
+using ovum::compiler::parser::AstAllocation;
+using ovum::compiler::parser::AstArena;
+using ovum::compiler::parser::BuilderAstFactory;
+using ovum::compiler::parser::BytecodeVisitor;
+using ovum::compiler::parser::Cast;
+using ovum::compiler::parser::ClassDecl;
+using ovum::compiler::parser::DefaultOperatorResolver;
+using ovum::compiler::parser::DiagnosticCollector;
+using ovum::compiler::parser::FindTopLevelDeclStarts;
+using ovum::compiler::parser::FunctionDecl;
+using ovum::compiler::parser::MakeDefaultParserComponents;
+using ovum::compiler::parser::MethodDecl;
+using ovum::compiler::parser::Module;
+using ovum::compiler::parser::NodeKind;
+using ovum::compiler::parser::ParallelParseOptions;
+using ovum::compiler::parser::ParserComponents;
+using ovum::compiler::parser::ParserFsm;
+using ovum::compiler::parser::PrattExpressionParser;
+using ovum::compiler::parser::QNameTypeParser;
+using ovum::compiler::parser::SourceSpan;
+using ovum::compiler::parser::TryParseParallel;
+
+namespace {
+
+constexpr std::size_t kBenchmarkFunctions = 20000;
+constexpr std::size_t kParityFunctions = 50;
+constexpr ParallelParseOptions kEagerParallelParse{.threshold = 0, .min_chunk = 1, .threads = 4};
+
+std::string MakeModuleSource(std::size_t functions) {
+  std::string src;
+
+  for (std::size_t i = 0; i < functions; ++i) {
+    const std::string n = std::to_string(i);
+    src += "fun Compute" + n + "(a: int, b: int): int {\n"
+           "  var sum: int = a * " + n + " + b\n"
+           "  while (sum > 100) { sum = sum - (a + b) * 2 }\n"
+           "  if (sum % 2 == 0) { return sum / 2 } else { return sum * 3 + 1 }\n"
+           "}\n";
+  }
+
+  return src;
+}
+
+// Every kind of top-level declaration, with nested braces and bracketed keywords the pre-scan must not split at.
+std::string MakeMixedModuleSource(std::size_t groups) {
+  std::string src = "// leading comment\n";
+
+  for (std::size_t i = 0; i < groups; ++i) {
+    const std::string n = std::to_string(i);
+    src += "typealias Id" + n + " = Int\n"
+           "global val kLimit" + n + ": Int = " + n + "\n"
+           "interface IShape" + n + " {\n"
+           "  fun Area(): float\n"
+           "}\n"
+           "class Box" + n + " implements IShape" + n + " {\n"
+           "  val side: float = 1.5\n"
+           "  fun Area(): float {\n"
+           "    return this.side * this.side\n"
+           "  }\n"
+           "}\n"
+           "pure fun Twice" + n + "(x: int): int { return x * 2 }\n"
+           "fun Main" + n + "(a: int): int {\n"
+           "  val y: int = 0x1F + a\n"
+           "  if (y > 3) { return Twice" + n + "(y) }\n"
+           "  return 7\n"
+           "}\n";
+  }
+
+  return src;
+}
+
+struct ParsedModule {
+  std::shared_ptr<BuilderAstFactory> factory;
+  std::unique_ptr<Module> module;
+};
+
+ParsedModule ParseModule(const TokenBuffer& tokens, AstAllocation allocation) {
+  auto factory = std::make_shared<BuilderAstFactory>(allocation);
+  auto type_parser = std::make_unique<QNameTypeParser>(*factory);
+  auto expr_parser = std::make_unique<PrattExpressionParser>(
+      std::make_unique<DefaultOperatorResolver>(), factory, type_parser.get());
+  ParserFsm parser(std::move(expr_parser), std::move(type_parser), factory);
+  DiagnosticCollector diags;
+  std::unique_ptr<Module> module = parser.Parse(tokens, diags);
+  EXPECT_EQ(diags.ErrorCount(), 0U);
+
+  return {.factory = std::move(factory), .module = std::move(module)};
+}
+
+struct SerialAndParallel {
+  std::unique_ptr<Module> serial;
+  std::unique_ptr<Module> parallel;
+};
+
+SerialAndParallel ParseBothWays(const TokenBuffer& tokens, const ParallelParseOptions& options) {
+  SerialAndParallel result;
+  ParsedModule serial = ParseModule(tokens, AstAllocation::kArena);
+  result.serial = std::move(serial.module);
+
+  ParserComponents components = MakeDefaultParserComponents();
+  ParserFsm parser(std::move(components.expr), std::move(components.type), std::move(components.factory));
+  parser.EnableParallelParse(MakeDefaultParserComponents, options);
+  DiagnosticCollector diags;
+  result.parallel = parser.Parse(tokens, diags);
+  EXPECT_EQ(diags.Count(), 0U);
+
+  return result;
+}
+
+ParsedModule ParseModuleLazily(const TokenBuffer& tokens, DiagnosticCollector& diags) {
+  ParserComponents components = MakeDefaultParserComponents();
+  auto factory = std::dynamic_pointer_cast<BuilderAstFactory>(components.factory);
+  ParserFsm parser(std::move(components.expr), std::move(components.type), std::move(components.factory));
+  parser.EnableLazyBodies(MakeDefaultParserComponents);
+
+  return {.factory = std::move(factory), .module = parser.Parse(tokens, diags)};
+}
+
+// Function, method and call bodies of module still waiting to be parsed.
+std::size_t CountDeferredBodies(const Module& module) {
+  std::size_t deferred = 0;
+
+  for (const auto& decl : module.Decls()) {
+    switch (decl->Kind()) {
+      case NodeKind::kFunctionDecl:
+        deferred += Cast<FunctionDecl>(*decl).HasDeferredBody() ? 1 : 0;
+        break;
+      case NodeKind::kClassDecl:
+        for (const auto& member : Cast<ClassDecl>(*decl).Members()) {
+          if (member->Kind() == NodeKind::kMethodDecl) {
+            deferred += Cast<MethodDecl>(*member).HasDeferredBody() ? 1 : 0;
+          }
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  return deferred;
+}
+
+std::string Bytecode(Module& module) {
+  std::ostringstream out;
+  BytecodeVisitor visitor(out);
+  module.Accept(visitor);
+
+  return out.str();
+}
+
+} // namespace
+
+TEST(ParserArenaTest, ArenaAndHeapBuildTheSameModule) {
+  const std::string src = MakeModuleSource(kParityFunctions);
+  TokenBuffer tokens;
+  ASSERT_TRUE(TokenizeIntoParallel(src, tokens).has_value());
+
+  ParsedModule heap = ParseModule(tokens, AstAllocation::kHeap);
+  ParsedModule arena = ParseModule(tokens, AstAllocation::kArena);
+  ASSERT_NE(heap.module, nullptr);
+  ASSERT_NE(arena.module, nullptr);
+  EXPECT_EQ(heap.factory->Arena(), nullptr);
+  ASSERT_NE(arena.factory->Arena(), nullptr);
+  EXPECT_GT(arena.factory->Arena()->AllocationCount(), kParityFunctions);
+  EXPECT_EQ(Bytecode(*arena.module), Bytecode(*heap.module));
+
+  // The module keeps its arena alive after the factory that filled it is gone.
+  arena.factory.reset();
+  EXPECT_EQ(Bytecode(*arena.module), Bytecode(*heap.module));
+
+  // Nodes made outside a module go to an arena started for them.
+  BuilderAstFactory builder;
+  const std::shared_ptr<AstArena> started = builder.StartArena();
+  ASSERT_NE(started, nullptr);
+  EXPECT_EQ(builder.Arena(), started.get());
+  const auto block = builder.MakeBlock({}, SourceSpan{});
+  EXPECT_GT(started->AllocationCount(), 0U);
+  EXPECT_EQ(BuilderAstFactory(AstAllocation::kHeap).StartArena(), nullptr);
+}
+
+TEST(ParallelParserTest, PreScanSplitsAtTopLevelDeclarationsOnly) {
+  const std::string src = "fun A(): int {\n  val x: int = 1\n  return x\n}\n"
+                          "class B {\n  fun C(): int { return 2 }\n}\n"
+                          "global var d: Int = 3\n"
+                          "fun E(): int { return (4) }";
+  TokenBuffer tokens;
+  ASSERT_TRUE(TokenizeIntoParallel(src, tokens).has_value());
+
+  const std::vector<std::size_t> starts = FindTopLevelDeclStarts(tokens);
+  ASSERT_EQ(starts.size(), 4U);
+  EXPECT_EQ(starts[0], 0U);
+  EXPECT_EQ(tokens.Lexeme(starts[1]), "class");
+  EXPECT_EQ(tokens.Lexeme(starts[2]), "global");
+  EXPECT_EQ(tokens.Lexeme(starts[3]), "fun");
+  EXPECT_EQ(tokens.Lexeme(starts[3] + 1), "E");
+}
+
+TEST(ParallelParserTest, ParallelParseMatchesSerialParse) {
+  for (const std::string& src : {MakeModuleSource(kParityFunctions), MakeMixedModuleSource(kParityFunctions)}) {
+    TokenBuffer tokens;
+    ASSERT_TRUE(TokenizeIntoParallel(src, tokens).has_value());
+    ASSERT_GE(FindTopLevelDeclStarts(tokens).size(), kParityFunctions);
+
+    for (const std::size_t threads : {2U, 4U, 7U}) {
+      ParallelParseOptions options = kEagerParallelParse;
+      options.threads = threads;
+      SerialAndParallel parsed = ParseBothWays(tokens, options);
+      ASSERT_NE(parsed.serial, nullptr);
+      ASSERT_NE(parsed.parallel, nullptr);
+      EXPECT_EQ(parsed.parallel->Decls().size(), parsed.serial->Decls().size());
+      EXPECT_EQ(Bytecode(*parsed.parallel), Bytecode(*parsed.serial));
+    }
+  }
+}
+
+TEST(ParallelParserTest, ErrorsFallBackToTheSerialDiagnostics) {
+  std::string src = MakeModuleSource(kParityFunctions);
+  src += "fun Broken(a: int): int {\n  return a +\n}\n";
+  src += MakeModuleSource(2);
+  TokenBuffer tokens;
+  ASSERT_TRUE(TokenizeIntoParallel(src, tokens).has_value());
+
+  DiagnosticCollector chunk_diags;
+  EXPECT_FALSE(TryParseParallel(tokens, nullptr, chunk_diags, MakeDefaultParserComponents, kEagerParallelParse)
+                   .has_value());
+  EXPECT_EQ(chunk_diags.Count(), 0U);
+
+  auto render = [](const DiagnosticCollector& diags) {
+    std::string out;
+
+    for (const auto& diagnostic : diags.All()) {
+      out += diagnostic.GetCode() + ": " + diagnostic.GetDiagnosticsMessage() + "\n";
+    }
+
+    return out;
+  };
+
+  ParserComponents serial_components = MakeDefaultParserComponents();
+  ParserFsm serial(std::move(serial_components.expr), std::move(serial_components.type),
+                   std::move(serial_components.factory));
+  DiagnosticCollector serial_diags;
+  serial.Parse(tokens, serial_diags);
+
+  ParserComponents parallel_components = MakeDefaultParserComponents();
+  ParserFsm parallel(std::move(parallel_components.expr), std::move(parallel_components.type),
+                     std::move(parallel_components.factory));
+  parallel.EnableParallelParse(MakeDefaultParserComponents, kEagerParallelParse);
+  DiagnosticCollector parallel_diags;
+  parallel.Parse(tokens, parallel_diags);
+
+  EXPECT_GT(serial_diags.ErrorCount(), 0U);
+  EXPECT_EQ(render(parallel_diags), render(serial_diags));
+}
+
+TEST(ParallelParserTest, SmallModulesStaySerial) {
+  TokenBuffer tokens;
+  ASSERT_TRUE(TokenizeIntoParallel(MakeModuleSource(kParityFunctions), tokens).has_value());
+  DiagnosticCollector diags;
+  EXPECT_FALSE(TryParseParallel(tokens, nullptr, diags, MakeDefaultParserComponents, {}).has_value());
+}
+
+TEST(LazyBodyTest, LazyParseMatchesEagerParse) {
+  for (const std::string& src : {MakeModuleSource(kParityFunctions), MakeMixedModuleSource(kParityFunctions)}) {
+    TokenBuffer tokens;
+    ASSERT_TRUE(TokenizeIntoParallel(src, tokens).has_value());
+
+    ParsedModule eager = ParseModule(tokens, AstAllocation::kArena);
+    DiagnosticCollector diags;
+    ParsedModule lazy = ParseModuleLazily(tokens, diags);
+    ASSERT_NE(eager.module, nullptr);
+    ASSERT_NE(lazy.module, nullptr);
+    EXPECT_EQ(CountDeferredBodies(*eager.module), 0U);
+    EXPECT_GE(CountDeferredBodies(*lazy.module), kParityFunctions);
+    EXPECT_EQ(lazy.module->Decls().size(), eager.module->Decls().size());
+
+    // Emitting asks for every body; the bodies outlive the parser that skipped them.
+    lazy.factory.reset();
+    EXPECT_EQ(Bytecode(*lazy.module), Bytecode(*eager.module));
+    EXPECT_EQ(CountDeferredBodies(*lazy.module), 0U);
+    EXPECT_EQ(diags.Count(), 0U);
+  }
+}
+
+TEST(LazyBodyTest, BodiesAreParsedOnlyWhenAskedFor) {
+  const std::string src = "fun Broken(a: int): int {\n  return a +\n}\n"
+                          "fun Fine(a: int): int {\n  return a\n}\n";
+  TokenBuffer tokens;
+  ASSERT_TRUE(TokenizeIntoParallel(src, tokens).has_value());
+  DiagnosticCollector diags;
+  ParsedModule parsed = ParseModuleLazily(tokens, diags);
+  ASSERT_NE(parsed.module, nullptr);
+  ASSERT_EQ(parsed.module->Decls().size(), 2U);
+  EXPECT_EQ(CountDeferredBodies(*parsed.module), 2U);
+
+  // Signatures are there without touching a body, and the broken body has not been looked at yet.
+  auto& broken = Cast<FunctionDecl>(*parsed.module->Decls()[0]);
+  auto& fine = Cast<FunctionDecl>(*parsed.module->Decls()[1]);
+  EXPECT_EQ(broken.Name(), "Broken");
+  EXPECT_EQ(fine.Params().size(), 1U);
+  EXPECT_EQ(diags.Count(), 0U);
+
+  ASSERT_NE(fine.Body(), nullptr);
+  EXPECT_EQ(fine.Body()->GetStatements().size(), 1U);
+  EXPECT_FALSE(fine.HasDeferredBody());
+  EXPECT_TRUE(broken.HasDeferredBody());
+  EXPECT_EQ(diags.Count(), 0U);
+
+  (void) broken.Body();
+  EXPECT_FALSE(broken.HasDeferredBody());
+  EXPECT_GT(diags.ErrorCount(), 0U);
+}
+
+TEST(LazyBodyTest, UnbalancedBodyIsParsedEagerly) {
+  const std::string src = "fun Open(a: int): int {\n  return a\n";
+  TokenBuffer tokens;
+  ASSERT_TRUE(TokenizeIntoParallel(src, tokens).has_value());
+
+  DiagnosticCollector eager_diags;
+  ParserComponents components = MakeDefaultParserComponents();
+  ParserFsm eager(std::move(components.expr), std::move(components.type), std::move(components.factory));
+  std::unique_ptr<Module> eager_module = eager.Parse(tokens, eager_diags);
+
+  DiagnosticCollector lazy_diags;
+  ParsedModule lazy = ParseModuleLazily(tokens, lazy_diags);
+  ASSERT_NE(lazy.module, nullptr);
+  EXPECT_EQ(CountDeferredBodies(*lazy.module), 0U);
+  EXPECT_EQ(lazy_diags.Count(), eager_diags.Count());
+  EXPECT_EQ(lazy.module->Decls().size(), eager_module->Decls().size());
+}
+
+// Run with --gtest_also_run_disabled_tests --gtest_filter='*LazyParseTime*' to print the numbers.
+TEST(LazyBodyTest, DISABLED_LazyParseTime) {
+  const std::string src = MakeModuleSource(kBenchmarkFunctions);
+  TokenBuffer tokens;
+  ASSERT_TRUE(TokenizeIntoParallel(src, tokens).has_value());
+
+  for (const bool lazy : {false, true}) {
+    DiagnosticCollector diags;
+    const auto start = std::chrono::steady_clock::now();
+    ParsedModule parsed = lazy ? ParseModuleLazily(tokens, diags)
+                               : ParseModule(tokens, AstAllocation::kArena);
+    const auto parsed_at = std::chrono::steady_clock::now();
+    ASSERT_NE(parsed.module, nullptr);
+    const std::string bytecode = Bytecode(*parsed.module);
+    const auto emitted_at = std::chrono::steady_clock::now();
+
+    const std::chrono::duration<double, std::milli> parse_ms = parsed_at - start;
+    const std::chrono::duration<double, std::milli> emit_ms = emitted_at - parsed_at;
+    std::cout << (lazy ? "lazy" : "eager") << ": parse " << parse_ms.count() << " ms, parse + emit "
+              << (parse_ms + emit_ms).count() << " ms\n";
+  }
+}
+
+// Run with --gtest_also_run_disabled_tests --gtest_filter='*ParallelParseTime*' to print the numbers.
+TEST(ParallelParserTest, DISABLED_ParallelParseTime) {
+  const std::string src = MakeModuleSource(kBenchmarkFunctions);
+  TokenBuffer tokens;
+  ASSERT_TRUE(TokenizeIntoParallel(src, tokens).has_value());
+
+  for (const bool parallel : {false, true}) {
+    ParserComponents components = MakeDefaultParserComponents();
+    ParserFsm parser(std::move(components.expr), std::move(components.type), std::move(components.factory));
+
+    if (parallel) {
+      parser.EnableParallelParse(MakeDefaultParserComponents);
+    }
+
+    DiagnosticCollector diags;
+    const auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<Module> module = parser.Parse(tokens, diags);
+    const auto end = std::chrono::steady_clock::now();
+    ASSERT_NE(module, nullptr);
+    EXPECT_EQ(diags.ErrorCount(), 0U);
+
+    const std::chrono::duration<double, std::milli> parse_ms = end - start;
+    std::cout << (parallel ? "parallel" : "serial") << ": parse " << parse_ms.count() << " ms, "
+              << module->Decls().size() << " declarations\n";
+  }
+}
+
+// Run with --gtest_also_run_disabled_tests --gtest_filter='*ArenaParseTime*' to print the numbers.
+TEST(ParserArenaTest, DISABLED_ArenaParseTime) {
+  const std::string src = MakeModuleSource(kBenchmarkFunctions);
+  TokenBuffer tokens;
+  ASSERT_TRUE(TokenizeIntoParallel(src, tokens).has_value());
+
+  for (const AstAllocation allocation : {AstAllocation::kHeap, AstAllocation::kArena}) {
+    const auto parse_start = std::chrono::steady_clock::now();
+    ParsedModule parsed = ParseModule(tokens, allocation);
+    const auto parse_end = std::chrono::steady_clock::now();
+    ASSERT_NE(parsed.module, nullptr);
+    const ovum::compiler::parser::AstArena* arena = parsed.factory->Arena();
+    const std::size_t nodes = arena != nullptr ? arena->AllocationCount() : 0;
+    const std::size_t blocks = arena != nullptr ? arena->BlockCount() : 0;
+    parsed.factory.reset();
+    const auto teardown_start = std::chrono::steady_clock::now();
+    parsed.module.reset();
+    const auto teardown_end = std::chrono::steady_clock::now();
+
+    const std::chrono::duration<double, std::milli> parse_ms = parse_end - parse_start;
+    const std::chrono::duration<double, std::milli> teardown_ms = teardown_end - teardown_start;
+    std::cout << (allocation == AstAllocation::kArena ? "arena" : "heap") << ": parse " << parse_ms.count()
+              << " ms, teardown " << teardown_ms.count() << " ms";
+
+    if (arena != nullptr) {
+      std::cout << ", " << nodes << " nodes in " << blocks << " block allocations";
+    }
+
+    std::cout << "\n";
+  }
+}
@@ -1,5 +1,20 @@
 #include <gtest/gtest.h>
 
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lib/lexer/Lexer.hpp"
+#include "lib/lexer/ViewLexer.hpp"
+#include "lib/parser/tokens/token_streams/LexerTokenStream.hpp"
+#include "lib/parser/tokens/token_streams/TokenBufferStream.hpp"
+#include "lib/parser/tokens/token_streams/VectorTokenStream.hpp"
+#include "lib/parser/tokens/token_streams/ViewTokenStream.hpp"
+#include "lib/parser/tokens/token_traits/MatchIdentifier.hpp"
+#include "lib/parser/tokens/token_traits/MatchLexeme.hpp"
+#include "lib/parser/tokens/token_traits/MatchLiteral.hpp"
+#include "lib/parser/tokens/token_traits/MatchType.hpp"
 #include "test_suites/ParserBytecodeTestSuite.hpp"
 
 TEST_F(ParserBytecodeTestSuite, PushInt) {
@@ -48,6 +63,199 @@ fun test(): byte {
   EXPECT_NE(bc.find("PushByte"), std::string::npos);
 }
 
+TEST_F(ParserBytecodeTestSuite, PushNumericLiteralValues) {
+  const std::string bc = GenerateBytecode(R"(
+fun test(): Void {
+    val h: int = 0x1B
+    val m: int = 0b101
+    val b: byte = 300b
+    val f: float = 2.5
+}
+)");
+  EXPECT_NE(bc.find("PushInt 27"), std::string::npos);
+  EXPECT_NE(bc.find("PushInt 5"), std::string::npos);
+  EXPECT_NE(bc.find("PushByte 255"), std::string::npos);
+  EXPECT_NE(bc.find("PushFloat 2.5"), std::string::npos);
+}
+
+TEST_F(ParserBytecodeTestSuite, TokenBufferParsesLikeTokenVector) {
+  const std::string code = R"(
+#define FAST
+fun Square(x: int): int {
+#ifdef FAST
+    return x * x
+#else
+    return x
+#endif
+}
+
+fun Main(args: StringArray): int {
+    val b: byte = 300b
+    val h: int = 0x1B
+    return Square(h) + 2
+}
+)";
+  const std::string expected = GenerateBytecode(code);
+  ASSERT_FALSE(expected.empty());
+  EXPECT_EQ(GenerateBytecodeFromBuffer(code), expected);
+}
+
+TEST_F(ParserBytecodeTestSuite, LexerTokenStreamParsesLikeTokenVector) {
+  const std::string code = R"(
+class Point implements IStringConvertible {
+    public val X: int
+    private var Y: float
+
+    public override fun ToString(): String {
+        return "point"
+    }
+}
+
+fun Square(x: int): int {
+    return x * x
+}
+
+fun Main(args: StringArray): int {
+    val b: byte = 300b
+    val h: int = 0x1B
+    return Square(h) + 2
+}
+)";
+  const std::string expected = GenerateBytecode(code);
+  ASSERT_FALSE(expected.empty());
+  EXPECT_EQ(GenerateBytecodeStreaming(code, {}), expected);
+  EXPECT_EQ(GenerateBytecodeStreaming(code, {.window = 8, .batch = 3}), expected);
+  EXPECT_EQ(GenerateBytecodeStreaming(code, {.window = 8, .lex_ahead = true, .batch = 5, .max_batches = 2}), expected);
+}
+
+TEST_F(ParserBytecodeTestSuite, LexerTokenStreamParsesModifiersBeforeLongTrivia) {
+  const std::string code = "class A {\n    public" + std::string(300, '\n') + "    fun F(): int {\n        return 1\n    }\n}\n";
+  const std::string expected = GenerateBytecode(code);
+  ASSERT_FALSE(expected.empty());
+  EXPECT_EQ(GenerateBytecodeStreaming(code, {}), expected);
+}
+
+TEST_F(ParserBytecodeTestSuite, LexerTokenStreamKeepsBoundedWindow) {
+  using ovum::compiler::parser::LexerTokenStream;
+  const std::string src = "a b c d e f g h";
+  LexerTokenStream stream(src, {.window = 3, .batch = 2});
+  EXPECT_EQ(stream.Capacity(), 4U);
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_NE(stream.Consume(), nullptr);
+  }
+  EXPECT_EQ(stream.LastConsumed()->GetLexeme(), "f");
+  EXPECT_EQ(stream.Peek().GetLexeme(), "g");
+  stream.Rewind(2);
+  EXPECT_EQ(stream.Peek().GetLexeme(), "e");
+  EXPECT_THROW(stream.Rewind(4), std::out_of_range);
+  EXPECT_EQ(stream.Peek(4).GetStringType(), "EOF");
+  EXPECT_EQ(stream.TryPeek(5), nullptr);
+  EXPECT_FALSE(stream.PeekKind(5).has_value());
+  EXPECT_FALSE(stream.IsEof());
+  stream.Rewind(0);
+  EXPECT_EQ(stream.Peek().GetPosition().GetColumn(), 9);
+
+  LexerTokenStream lookahead(src, {.window = 2});
+  EXPECT_EQ(lookahead.Peek(5).GetLexeme(), "f");
+  EXPECT_GE(lookahead.Capacity(), 6U);
+
+  const std::string bad = "val s = \"unterminated\nval t = 1";
+  for (const bool lex_ahead : {false, true}) {
+    LexerTokenStream errors(bad, {.lex_ahead = lex_ahead, .batch = 1});
+    while (!errors.IsEof()) {
+      errors.Consume();
+    }
+    EXPECT_EQ(errors.Peek().GetStringType(), "EOF");
+    ASSERT_TRUE(errors.Error().has_value());
+    EXPECT_STREQ(errors.Error()->what(), ovum::compiler::lexer::ViewLexer(bad).Tokenize().error().what());
+  }
+}
+
+TEST_F(ParserBytecodeTestSuite, TokenBufferStreamKeepsBoundedWindow) {
+  using ovum::compiler::parser::TokenBufferStream;
+  const std::string src = "a b c d e f g h";
+  ovum::compiler::lexer::TokenBuffer buffer;
+  ASSERT_TRUE(ovum::compiler::lexer::ViewLexer(src).TokenizeInto(buffer).has_value());
+  TokenBufferStream stream(buffer, 3);
+  EXPECT_EQ(stream.Capacity(), 4U);
+  std::weak_ptr<ovum::Token> first = stream.Consume();
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_NE(stream.Consume(), nullptr);
+  }
+  EXPECT_EQ(stream.LastConsumed()->GetLexeme(), "f");
+  EXPECT_EQ(stream.Peek().GetLexeme(), "g");
+  EXPECT_TRUE(first.expired());
+  stream.Rewind(6);
+  EXPECT_EQ(stream.Peek().GetLexeme(), "a");
+  EXPECT_EQ(stream.Capacity(), 4U);
+  const ovum::Token& a = stream.Peek();
+  for (size_t k = 1; k < 6; ++k) {
+    EXPECT_EQ(stream.Peek(k).GetLexeme(), std::string(1, static_cast<char>('a' + k)));
+  }
+  EXPECT_EQ(a.GetLexeme(), "a");
+  EXPECT_GE(stream.Capacity(), 6U);
+
+  const ovum::compiler::lexer::TokenBuffer empty;
+  TokenBufferStream none(empty);
+  EXPECT_TRUE(none.IsEof());
+  EXPECT_EQ(none.TryPeek(), nullptr);
+  EXPECT_EQ(none.Consume(), nullptr);
+}
+
+TEST_F(ParserBytecodeTestSuite, StreamsKeepDecodedNumbersWithTheirTokens) {
+  using ovum::compiler::lexer::NumericLiteralKind;
+  const std::string src = "x = 0x1B + 300b * 2.5";
+  ovum::compiler::lexer::TokenBuffer buffer;
+  ASSERT_TRUE(ovum::compiler::lexer::ViewLexer(src).TokenizeInto(buffer).has_value());
+  ovum::compiler::parser::TokenBufferStream from_buffer(buffer);
+  ovum::compiler::parser::LexerTokenStream from_lexer(src);
+  for (ovum::compiler::parser::ITokenStream* stream :
+       std::initializer_list<ovum::compiler::parser::ITokenStream*>{&from_buffer, &from_lexer}) {
+    EXPECT_FALSE(stream->PeekNumber(0).has_value());
+    ASSERT_TRUE(stream->PeekNumber(2).has_value());
+    EXPECT_EQ(stream->PeekNumber(2)->kind, NumericLiteralKind::kInt);
+    EXPECT_EQ(stream->PeekNumber(2)->int_value, 27);
+    EXPECT_EQ(stream->PeekNumber(4)->kind, NumericLiteralKind::kByte);
+    EXPECT_EQ(stream->PeekNumber(4)->int_value, 255);
+    EXPECT_EQ(stream->PeekNumber(6)->kind, NumericLiteralKind::kFloat);
+    EXPECT_EQ(stream->PeekNumber(6)->float_value, 2.5L);
+    EXPECT_FALSE(stream->PeekNumber(8).has_value());
+  }
+}
+
+TEST_F(ParserBytecodeTestSuite, TokenKindFastPathsAgreeWithStrings) {
+  using namespace ovum::compiler::parser;
+  const std::string src = "// c\nfun f(x: Int): float { return x + 1 * 2.5 - Inf; val s = \"a\"; c := 'z' == true }";
+  auto tokens = ovum::compiler::lexer::Lexer(src, true).Tokenize();
+  ASSERT_TRUE(tokens.has_value());
+  auto views = ovum::compiler::lexer::ViewLexer(src, true).Tokenize();
+  ASSERT_TRUE(views.has_value());
+  VectorTokenStream vector_stream(tokens.value());
+  ViewTokenStream view_stream(views.value(), src);
+  const MatchIdentifier ident;
+  const MatchLiteral literal;
+  const std::vector<MatchLexeme> lexemes{MatchLexeme("fun"), MatchLexeme("("), MatchLexeme("Inf"), MatchLexeme("x")};
+  const std::vector<MatchType> types{MatchType("IDENT"), MatchType("NEWLINE"), MatchType("LITERAL:Float"),
+                                     MatchType("LITERAL:Byte"), MatchType("COMMENT")};
+  while (vector_stream.TryPeek() != nullptr) {
+    const auto& token = vector_stream.Peek();
+    const auto kind = vector_stream.PeekKind();
+    ASSERT_TRUE(kind.has_value()) << token.GetStringType();
+    EXPECT_EQ(kind, view_stream.PeekKind()) << token.GetLexeme();
+    EXPECT_EQ(ident.TryMatchKind(token, kind), ident.TryMatch(token)) << token.GetLexeme();
+    EXPECT_EQ(literal.TryMatchKind(token, kind), literal.TryMatch(token)) << token.GetLexeme();
+    for (const auto& matcher : lexemes) {
+      EXPECT_EQ(matcher.TryMatchKind(token, kind), matcher.TryMatch(token)) << token.GetLexeme();
+    }
+    for (const auto& matcher : types) {
+      EXPECT_EQ(matcher.TryMatchKind(token, kind), matcher.TryMatch(token)) << token.GetLexeme();
+    }
+    vector_stream.Consume();
+    view_stream.Consume();
+  }
+  EXPECT_FALSE(view_stream.PeekKind().has_value());
+}
+
 TEST_F(ParserBytecodeTestSuite, PushString) {
   const std::string bc = GenerateBytecode(R"(
 fun test(): String {
@@ -1,7 +1,25 @@
 #include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <string>
-
+#include <vector>
+
+#include "lib/lexer/Lexer.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+#include "lib/preprocessor/directives_processor/TokenDirectivesProcessor.hpp"
+#include "lib/preprocessor/directives_processor/directive_table.hpp"
+#include "lib/preprocessor/import_processor/FileGraph.hpp"
+#include "lib/preprocessor/import_processor/IncludeResolver.hpp"
+#include "lib/preprocessor/import_processor/TokenCache.hpp"
+#include "lib/preprocessor/import_processor/import_discovery.hpp"
+#include "lib/preprocessor/Preprocessor.hpp"
+#include "lib/preprocessor/preprocessed_artifact.hpp"
+#include "lib/preprocessor/token_sequences/VectorTokenSequence.hpp"
 #include "test_suites/PreprocessorUnitTestSuite.hpp"
 
 namespace ovum::compiler::preprocessor {
@@ -650,6 +668,17 @@ TEST(PreprocessorUnitTestSuite, ImportInvalid) {
   PreprocessorUnitTestSuite::RunSingleTest(input_src, expected_src);
 }
 
+// Imported files are placed ahead of the importing file rather than at the #import, so an import inside an inactive
+// block still contributes its tokens and has to be loaded.
+TEST(PreprocessorUnitTestSuite, ImportInInactiveBlock) {
+  const std::string file_name = "Test11_ImportInInactiveBlock.txt";
+  const std::string dir_name = "import";
+  const std::filesystem::path input_src = GetInputFilePath(dir_name, file_name);
+  const std::filesystem::path expected_src = GetExpectedFilePath(dir_name, file_name);
+
+  PreprocessorUnitTestSuite::RunSingleTest(input_src, expected_src);
+}
+
 // Complex tests
 TEST(PreprocessorUnitTestSuite, Complex1) {
   const std::string file_name = "Test01_Complex1.txt";
@@ -669,4 +698,244 @@ TEST(PreprocessorUnitTestSuite, Complex2) {
   PreprocessorUnitTestSuite::RunSingleTest(input_src, expected_src);
 }
 
+
+TEST(PreprocessorUnitTestSuite, ImportDiscoveryScansEachFileOnce) {
+  std::map<std::filesystem::path, std::vector<std::filesystem::path>> graph;
+  for (int i = 0; i < 64; ++i) {
+    graph["f" + std::to_string(i)] = {"f" + std::to_string((i + 1) % 64), "f" + std::to_string((i * 3 + 2) % 64)};
+  }
+  std::mutex mutex;
+  std::map<std::filesystem::path, int> scans;
+  auto scan = [&](const std::filesystem::path& file) {
+    {
+      std::lock_guard lock(mutex);
+      ++scans[file];
+    }
+    DiscoveredImports found;
+    for (const auto& dep : graph.at(file)) {
+      found.imports.emplace_back(dep);
+    }
+    return found;
+  };
+  std::map<std::filesystem::path, DiscoveredImports> discovered;
+  discovered["main"].imports.emplace_back("f0");
+  DiscoverImports(discovered, 8, scan);
+  EXPECT_EQ(discovered.size(), graph.size() + 1);
+  for (const auto& [file, count] : scans) {
+    EXPECT_EQ(count, 1) << file;
+  }
+  EXPECT_EQ(scans.size(), graph.size());
+  EXPECT_EQ(discovered.at("f5").imports.size(), 2U);
+}
+
+TEST(PreprocessorUnitTestSuite, TokenCacheServesEntriesByContent) {
+  const std::filesystem::path dir = std::filesystem::temp_directory_path() / "ovum_token_cache_unit";
+  std::filesystem::remove_all(dir);
+  const std::string text = "#import \"a.ovum\"\nfun F(): int {\n  return 0x1F // note\n}\n#import \"b.ovum\"\n";
+  TokenCache cache(dir);
+  lexer::TokenBuffer cold;
+  auto cold_imports = cache.TokenizeInto(text, cold);
+  ASSERT_TRUE(cold_imports.has_value()) << cold_imports.error().what();
+  EXPECT_EQ(cache.Misses(), 1U);
+  EXPECT_EQ(cold_imports->size(), 2U);
+  const std::filesystem::path entry = dir / (TokenCache::ContentKey(text) + ".otc");
+  ASSERT_TRUE(std::filesystem::exists(entry));
+
+  lexer::TokenBuffer warm;
+  auto warm_imports = cache.TokenizeInto(text, warm);
+  ASSERT_TRUE(warm_imports.has_value());
+  EXPECT_EQ(cache.Hits(), 1U);
+  EXPECT_EQ(warm_imports.value(), cold_imports.value());
+  ASSERT_EQ(warm.Size(), cold.Size());
+  for (size_t i = 0; i < warm.Size(); ++i) {
+    EXPECT_EQ(warm.Kind(i), cold.Kind(i)) << i;
+    EXPECT_EQ(warm.Lexeme(i), cold.Lexeme(i)) << i;
+    EXPECT_EQ(warm.Line(i), cold.Line(i)) << i;
+    EXPECT_EQ(warm.Column(i), cold.Column(i)) << i;
+  }
+
+  EXPECT_NE(TokenCache::ContentKey(text), TokenCache::ContentKey(text + " "));
+  EXPECT_EQ(TokenCache::ContentKey(text).size(), 32U);
+
+  std::filesystem::resize_file(entry, std::filesystem::file_size(entry) - 1);
+  lexer::TokenBuffer truncated;
+  ASSERT_TRUE(cache.TokenizeInto(text, truncated).has_value());
+  EXPECT_EQ(cache.Misses(), 2U);
+  EXPECT_EQ(truncated.Size(), cold.Size());
+  lexer::TokenBuffer rewritten;
+  ASSERT_TRUE(cache.TokenizeInto(text, rewritten).has_value());
+  EXPECT_EQ(cache.Hits(), 2U);
+
+  // An entry of another content of the same size under this key, as a hash collision would leave it.
+  std::string other = text;
+  other[other.find('F')] = 'G';
+  lexer::TokenBuffer other_tokens;
+  ASSERT_TRUE(cache.TokenizeInto(other, other_tokens).has_value());
+  std::filesystem::copy_file(
+      dir / (TokenCache::ContentKey(other) + ".otc"), entry, std::filesystem::copy_options::overwrite_existing);
+  lexer::TokenBuffer collided;
+  ASSERT_TRUE(cache.TokenizeInto(text, collided).has_value());
+  EXPECT_EQ(cache.Misses(), 4U);
+  ASSERT_EQ(collided.Size(), cold.Size());
+  for (size_t i = 0; i < collided.Size(); ++i) {
+    EXPECT_EQ(collided.Lexeme(i), cold.Lexeme(i)) << i;
+  }
+
+  EXPECT_FALSE(cache.TokenizeInto("val s = \"open\n", truncated).has_value());
+  std::filesystem::remove_all(dir);
+}
+
+TEST(PreprocessorUnitTestSuite, DirectiveTableClassifiesOnlyKeywordDirectives) {
+  const std::string src = "#define A\n#import \"x.txt\"\nval s = \"#ifdef\"\n#ifdef A\nval x = 1\n#else\n#endif\n";
+  auto tokens = lexer::Lexer(src, false).Tokenize();
+  ASSERT_TRUE(tokens.has_value());
+  const VectorTokenSequence sequence(tokens.value());
+
+  std::vector<Directive> found;
+  for (const DirectiveToken& directive : FindDirectives(sequence)) {
+    EXPECT_EQ(ClassifyDirective(sequence, directive.index), directive.directive);
+    found.push_back(directive.directive);
+  }
+  EXPECT_EQ(found,
+            (std::vector<Directive>{Directive::kDefine, Directive::kIfdef, Directive::kElse, Directive::kEndif}));
+
+  auto plain = lexer::Lexer("val a: int = 1\nval b: int = 2\n", false).Tokenize();
+  ASSERT_TRUE(plain.has_value());
+  auto processed = TokenDirectivesProcessor({}).Process(plain.value());
+  ASSERT_TRUE(processed.has_value());
+  EXPECT_EQ(processed.value(), plain.value());
+}
+
+TEST(PreprocessorUnitTestSuite, IncludeResolverKeepsFirstMatchAndCachesListings) {
+  const std::filesystem::path dir = std::filesystem::temp_directory_path() / "ovum_include_resolver_test";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir / "a" / "sub");
+  std::filesystem::create_directories(dir / "b");
+  std::ofstream(dir / "a" / "sub" / "both.txt") << "INCLUDE 1\n";
+  std::ofstream(dir / "b" / "only_b.txt") << "INCLUDE 2\n";
+  std::ofstream(dir / "b" / "both.txt") << "INCLUDE 3\n";
+  const std::set<std::filesystem::path> include_paths{dir / "a" / "sub", dir / "b"};
+
+  IncludeResolver resolver;
+  EXPECT_EQ(resolver.Resolve(include_paths, "both.txt"), dir / "a" / "sub" / "both.txt");
+  EXPECT_EQ(resolver.Resolve(include_paths, "only_b.txt"), dir / "b" / "only_b.txt");
+  EXPECT_EQ(resolver.Resolve(include_paths, "missing.txt"), std::nullopt);
+  EXPECT_EQ(resolver.Resolve({dir}, "a/sub/both.txt"), dir / "a" / "sub" / "both.txt");
+  EXPECT_EQ(resolver.Resolve({dir}, "b/nowhere/x.txt"), std::nullopt);
+  const std::size_t scans = resolver.DirectoryScans();
+  EXPECT_EQ(scans, 3U); // a/sub, b and the missing b/nowhere
+
+  EXPECT_EQ(resolver.Resolve(include_paths, "only_b.txt"), dir / "b" / "only_b.txt");
+  EXPECT_EQ(resolver.Resolve(include_paths, "missing.txt"), std::nullopt);
+  EXPECT_EQ(resolver.DirectoryScans(), scans);
+
+  // Listings are not refreshed until cleared.
+  std::ofstream(dir / "a" / "sub" / "missing.txt") << "INCLUDE 4\n";
+  EXPECT_EQ(resolver.Resolve(include_paths, "missing.txt"), std::nullopt);
+  resolver.Clear();
+  EXPECT_EQ(resolver.Resolve(include_paths, "missing.txt"), dir / "a" / "sub" / "missing.txt");
+
+  // A dangling symlink does not shadow a later include directory, and a name in another case resolves exactly when
+  // the filesystem says it exists.
+  std::filesystem::create_symlink(dir / "nowhere.txt", dir / "a" / "sub" / "only_b.txt");
+  resolver.Clear();
+  EXPECT_EQ(resolver.Resolve(include_paths, "only_b.txt"), dir / "b" / "only_b.txt");
+  const bool upper_exists = std::filesystem::exists(dir / "a" / "sub" / "BOTH.TXT");
+  EXPECT_EQ(resolver.Resolve(include_paths, "BOTH.TXT").has_value(), upper_exists);
+  std::filesystem::remove_all(dir);
+}
+
+TEST(PreprocessorUnitTestSuite, FileGraphOrdersAndReportsCycles) {
+  FileGraph graph;
+  graph.AddNode("main");
+  graph.AddDependency("main", "b");
+  graph.AddDependency("main", "a");
+  graph.AddDependency("b", "a");
+  graph.AddDependency("main", "b");
+  auto order = graph.TopologicalSort();
+  ASSERT_TRUE(order.has_value());
+  EXPECT_EQ(order.value(), (std::vector<std::filesystem::path>{"a", "b", "main"}));
+  std::vector<std::filesystem::path> cycle;
+  EXPECT_FALSE(graph.DetectCycles(cycle));
+  EXPECT_EQ(graph.GetDependencyGraph().at("main"), (std::set<std::filesystem::path>{"a", "b"}));
+
+  // Only the files on the cycle are reported, not the path leading into it.
+  graph.AddDependency("a", "c");
+  graph.AddDependency("c", "b");
+  ASSERT_TRUE(graph.DetectCycles(cycle));
+  EXPECT_EQ(cycle, (std::vector<std::filesystem::path>{"a", "c", "b"}));
+  EXPECT_FALSE(graph.TopologicalSort().has_value());
+
+  // Deep chains are walked without recursion.
+  constexpr size_t kChainLength = 200000;
+  FileGraph chain;
+  for (size_t i = 0; i + 1 < kChainLength; ++i) {
+    chain.AddDependency(std::to_string(i), std::to_string(i + 1));
+  }
+  cycle.clear();
+  EXPECT_FALSE(chain.DetectCycles(cycle));
+  auto chain_order = chain.TopologicalSort();
+  ASSERT_TRUE(chain_order.has_value());
+  ASSERT_EQ(chain_order->size(), kChainLength);
+  EXPECT_EQ(chain_order->front(), std::to_string(kChainLength - 1));
+  EXPECT_EQ(chain_order->back(), "0");
+  chain.AddDependency(std::to_string(kChainLength - 1), "0");
+  ASSERT_TRUE(chain.DetectCycles(cycle));
+  EXPECT_EQ(cycle.size(), kChainLength);
+}
+
+TEST(PreprocessorUnitTestSuite, PreprocessedArtifactRoundTripsTokens) {
+  const std::filesystem::path dir = std::filesystem::temp_directory_path() / "ovum_preprocessed_artifact_test";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  std::ofstream(dir / "lib.ovum") << "// helper\nfun Twice(x: int): int {\n  return x * 2\n}\n";
+  std::ofstream(dir / "main.ovum") << "#import \"lib.ovum\"\n#ifdef DEBUG\nval d = 1\n#endif\n"
+                                   << "fun Main(args: StringArray): int {\n\treturn Twice(21) + 0x10\n}\n";
+  lexer::SourceManager sources;
+  Preprocessor preprocessor(PreprocessingParameters{.include_paths = {dir},
+                                                    .predefined_symbols = {},
+                                                    .main_file = dir / "main.ovum",
+                                                    .import_threads = 1,
+                                                    .token_cache_dir = {},
+                                                    .include_resolver = nullptr});
+  auto processed = preprocessor.Process(sources);
+  ASSERT_TRUE(processed.has_value()) << processed.error().what();
+  const lexer::TokenBuffer& tokens = processed.value();
+  ASSERT_GT(tokens.SourceCount(), 1U);
+
+  const std::filesystem::path artifact = dir / "main.ovpp";
+  ASSERT_TRUE(WritePreprocessedArtifact(tokens, artifact).has_value());
+  lexer::SourceManager artifact_sources;
+  auto loaded = ReadPreprocessedArtifact(artifact, artifact_sources);
+  ASSERT_TRUE(loaded.has_value()) << loaded.error().what();
+  ASSERT_EQ(loaded->Size(), tokens.Size());
+  for (size_t i = 0; i < tokens.Size(); ++i) {
+    EXPECT_EQ(loaded->Kind(i), tokens.Kind(i)) << i;
+    EXPECT_EQ(loaded->Lexeme(i), tokens.Lexeme(i)) << i;
+    EXPECT_EQ(loaded->Line(i), tokens.Line(i)) << i;
+    EXPECT_EQ(loaded->Column(i), tokens.Column(i)) << i;
+  }
+
+  // Truncated and foreign files are rejected, not read past their end.
+  std::ifstream artifact_stream(artifact, std::ios::binary);
+  const std::string bytes((std::istreambuf_iterator<char>(artifact_stream)), std::istreambuf_iterator<char>());
+  std::ofstream(dir / "truncated.ovpp", std::ios::binary) << bytes.substr(0, bytes.size() - 1);
+  EXPECT_FALSE(ReadPreprocessedArtifact(dir / "truncated.ovpp", artifact_sources).has_value());
+  std::ofstream(dir / "source.ovpp", std::ios::binary) << "fun Main(): int { return 0 }\n";
+  EXPECT_FALSE(ReadPreprocessedArtifact(dir / "source.ovpp", artifact_sources).has_value());
+  EXPECT_FALSE(ReadPreprocessedArtifact(dir / "missing.ovpp", artifact_sources).has_value());
+
+  // Well-formed files the parser could not read to an end of file token are rejected too.
+  const lexer::TokenBuffer empty;
+  ASSERT_TRUE(WritePreprocessedArtifact(empty, dir / "empty.ovpp").has_value());
+  EXPECT_FALSE(ReadPreprocessedArtifact(dir / "empty.ovpp", artifact_sources).has_value());
+  lexer::TokenBuffer unterminated;
+  unterminated.Append(lexer::TokenView{.kind = lexer::TokenKind::kIdent, .offset = 0, .length = 1, .line = 1,
+                                       .column = 1},
+                      unterminated.AddSource("x"));
+  ASSERT_TRUE(WritePreprocessedArtifact(unterminated, dir / "unterminated.ovpp").has_value());
+  EXPECT_FALSE(ReadPreprocessedArtifact(dir / "unterminated.ovpp", artifact_sources).has_value());
+  std::filesystem::remove_all(dir);
+}
+
 } // namespace ovum::compiler::preprocessor
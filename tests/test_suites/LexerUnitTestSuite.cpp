@@ -87,3 +87,16 @@ void LexerUnitTestSuite::AssertLexemesAndTypesEqual(const std::vector<std::pair<
   ASSERT_EQ(actual.size(), expected_lexemes.size());
   ASSERT_EQ(actual.size(), expected_type_substrs.size());
 }
+
+void LexerUnitTestSuite::AssertSameTokens(const std::vector<ovum::TokenPtr>& expected,
+                                          const std::vector<ovum::TokenPtr>& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i]->GetStringType(), actual[i]->GetStringType()) << "type mismatch at index " << i;
+    EXPECT_EQ(expected[i]->GetLexeme(), actual[i]->GetLexeme()) << "lexeme mismatch at index " << i;
+    EXPECT_EQ(expected[i]->GetPosition().GetLine(), actual[i]->GetPosition().GetLine())
+        << "line mismatch at index " << i;
+    EXPECT_EQ(expected[i]->GetPosition().GetColumn(), actual[i]->GetPosition().GetColumn())
+        << "column mismatch at index " << i;
+  }
+}
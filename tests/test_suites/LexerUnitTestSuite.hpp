@@ -16,6 +16,8 @@ public:
                                          const std::vector<std::string>& expected_lexemes,
                                          const std::vector<std::string>& expected_type_substrs);
 
+  static void AssertSameTokens(const std::vector<ovum::TokenPtr>& expected, const std::vector<ovum::TokenPtr>& actual);
+
   void SetUp() override; // method that is called at the beginning of every test
 
   void TearDown() override; // method that is called at the end of every test
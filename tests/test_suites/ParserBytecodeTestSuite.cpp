@@ -5,9 +5,13 @@
 #include <sstream>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <tokens/Token.hpp>
 #include "lib/lexer/Lexer.hpp"
+#include "lib/lexer/TokenBuffer.hpp"
+#include "lib/lexer/ViewLexer.hpp"
+#include "lib/lexer/source/SourceManager.hpp"
 #include "lib/parser/ParserFsm.hpp"
 #include "lib/parser/ast/BuilderAstFactory.hpp"
 #include "lib/parser/ast/visitors/BytecodeVisitor.hpp"
@@ -100,3 +104,50 @@ std::string ParserBytecodeTestSuite::GenerateBytecode(const std::string& code) {
 
   return out.str();
 }
+
+std::string ParserBytecodeTestSuite::GenerateBytecodeFromBuffer(const std::string& code) {
+  TokenBuffer tokens;
+  ViewLexer lexer(code);
+  if (!lexer.TokenizeInto(tokens).has_value()) {
+    return "";
+  }
+
+  SourceManager sources;
+  std::unordered_set<std::string> predefined;
+  TokenDirectivesProcessor directives(predefined);
+  auto processed = directives.Process(tokens, sources);
+  if (!processed.has_value()) {
+    return "";
+  }
+
+  auto module = parser_->Parse(processed.value(), diags_);
+  EXPECT_NE(module, nullptr);
+  EXPECT_EQ(diags_.ErrorCount(), 0);
+  if (!module) {
+    return "";
+  }
+
+  std::ostringstream out;
+  BytecodeVisitor visitor(out);
+  module->Accept(visitor);
+
+  return out.str();
+}
+
+std::string ParserBytecodeTestSuite::GenerateBytecodeStreaming(const std::string& code,
+                                                               const LexerTokenStreamOptions& options) {
+  LexerTokenStream stream(code, options);
+  auto module = parser_->Parse(stream, diags_);
+  EXPECT_FALSE(stream.Error().has_value());
+  EXPECT_NE(module, nullptr);
+  EXPECT_EQ(diags_.ErrorCount(), 0);
+  if (!module) {
+    return "";
+  }
+
+  std::ostringstream out;
+  BytecodeVisitor visitor(out);
+  module->Accept(visitor);
+
+  return out.str();
+}
@@ -11,6 +11,7 @@
 #include "lib/parser/ast/IAstFactory.hpp"
 #include "lib/parser/diagnostics/DiagnosticCollector.hpp"
 #include "lib/parser/pratt/IExpressionParser.hpp"
+#include "lib/parser/tokens/token_streams/LexerTokenStream.hpp"
 #include "lib/parser/type_parser/ITypeParser.hpp"
 
 using TokenPtr = ovum::TokenPtr;
@@ -23,6 +24,13 @@ protected:
 
   std::string GenerateBytecode(const std::string& code);
 
+  // Same as GenerateBytecode, but lexes into a TokenBuffer and parses through ParserFsm's buffer overload.
+  std::string GenerateBytecodeFromBuffer(const std::string& code);
+
+  // Parses straight from a LexerTokenStream, so the code must not use preprocessor directives.
+  std::string GenerateBytecodeStreaming(const std::string& code,
+                                        const ovum::compiler::parser::LexerTokenStreamOptions& options);
+
   ovum::compiler::parser::DiagnosticCollector
       diags_; // NOLINT(cppcoreguidelines-non-private-member-variables-in-classes)
   std::unique_ptr<ovum::compiler::parser::ParserFsm>
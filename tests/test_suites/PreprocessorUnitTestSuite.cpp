@@ -10,6 +10,7 @@
 #include <gtest/gtest.h>
 
 #include "lib/lexer/Lexer.hpp"
+#include "lib/lexer/token_materializer.hpp"
 #include "lib/preprocessor/Preprocessor.hpp"
 
 constexpr size_t kMaxTokenSequenceLength = 17;
@@ -36,6 +37,7 @@ void PreprocessorUnitTestSuite::RunSingleTest(const std::filesystem::path& input
       input_file.parent_path(),
       std::filesystem::path(TEST_DATA_DIR) / "preprocessor" / "for_import",
   };
+  params.import_threads = 1;
 
   Preprocessor preprocessor(params);
 
@@ -65,6 +67,97 @@ void PreprocessorUnitTestSuite::RunSingleTest(const std::filesystem::path& input
       return;
     }
   }
+
+  RunBufferTest(params, result);
+  RunParallelImportTest(params, result);
+  RunTokenCacheTest(params, result);
+}
+
+void PreprocessorUnitTestSuite::RunBufferTest(const PreprocessingParameters& params, const TestResult& result) {
+  lexer::SourceManager sources;
+  Preprocessor preprocessor(params);
+
+  auto process_result = preprocessor.Process(sources);
+
+  if (result.expected_tokens[0]->GetLexeme() == "EXPECTERROR") {
+    ASSERT_FALSE(process_result.has_value())
+        << "Test " << result.test_name << " failed: token buffer result has tokens but must be error";
+    return;
+  }
+
+  ASSERT_TRUE(process_result.has_value())
+      << "Test " << result.test_name << " failed: token buffer preprocessing failed: "
+      << GetErrorString(process_result.error());
+
+  std::vector<TokenPtr> actual_tokens = lexer::MaterializeTokens(process_result.value());
+
+  ASSERT_TRUE(CompareTokenSequences(actual_tokens, result.expected_tokens))
+      << "Test " << result.test_name << " failed on token buffer:\n"
+      << BuildDetailedComparison(actual_tokens, result.expected_tokens);
+}
+
+void PreprocessorUnitTestSuite::RunParallelImportTest(PreprocessingParameters params, const TestResult& result) {
+  auto serial_result = Preprocessor(params).Process();
+  params.import_threads = 4;
+  lexer::SourceManager sources;
+  auto vector_result = Preprocessor(params).Process();
+  auto buffer_result = Preprocessor(params).Process(sources);
+
+  if (result.expected_tokens[0]->GetLexeme() == "EXPECTERROR") {
+    ASSERT_FALSE(vector_result.has_value()) << "Test " << result.test_name << " failed: parallel import has tokens";
+    ASSERT_FALSE(buffer_result.has_value()) << "Test " << result.test_name << " failed: parallel import has tokens";
+    ASSERT_FALSE(serial_result.has_value());
+    EXPECT_EQ(GetErrorString(vector_result.error()), GetErrorString(serial_result.error())) << result.test_name;
+    EXPECT_EQ(GetErrorString(buffer_result.error()), GetErrorString(serial_result.error())) << result.test_name;
+    return;
+  }
+
+  ASSERT_TRUE(vector_result.has_value()) << "Test " << result.test_name << " failed: parallel import failed: "
+                                         << GetErrorString(vector_result.error());
+  ASSERT_TRUE(buffer_result.has_value()) << "Test " << result.test_name << " failed: parallel import failed: "
+                                         << GetErrorString(buffer_result.error());
+
+  std::vector<TokenPtr> buffer_tokens = lexer::MaterializeTokens(buffer_result.value());
+
+  ASSERT_TRUE(CompareTokenSequences(vector_result.value(), result.expected_tokens))
+      << "Test " << result.test_name << " failed with parallel import:\n"
+      << BuildDetailedComparison(vector_result.value(), result.expected_tokens);
+  ASSERT_TRUE(CompareTokenSequences(buffer_tokens, result.expected_tokens))
+      << "Test " << result.test_name << " failed with parallel import on token buffer:\n"
+      << BuildDetailedComparison(buffer_tokens, result.expected_tokens);
+}
+
+void PreprocessorUnitTestSuite::RunTokenCacheTest(PreprocessingParameters params, const TestResult& result) {
+  params.token_cache_dir = std::filesystem::temp_directory_path() / "ovum_token_cache_tests" / result.test_name;
+  std::filesystem::remove_all(params.token_cache_dir);
+
+  for (const char* run : {"cold", "warm"}) {
+    lexer::SourceManager sources;
+    auto vector_result = Preprocessor(params).Process();
+    auto buffer_result = Preprocessor(params).Process(sources);
+
+    if (result.expected_tokens[0]->GetLexeme() == "EXPECTERROR") {
+      ASSERT_FALSE(vector_result.has_value()) << "Test " << result.test_name << " failed: " << run << " cache run";
+      ASSERT_FALSE(buffer_result.has_value()) << "Test " << result.test_name << " failed: " << run << " cache run";
+      continue;
+    }
+
+    ASSERT_TRUE(vector_result.has_value()) << "Test " << result.test_name << " failed on " << run
+                                           << " cache run: " << GetErrorString(vector_result.error());
+    ASSERT_TRUE(buffer_result.has_value()) << "Test " << result.test_name << " failed on " << run
+                                           << " cache run: " << GetErrorString(buffer_result.error());
+
+    std::vector<TokenPtr> buffer_tokens = lexer::MaterializeTokens(buffer_result.value());
+
+    ASSERT_TRUE(CompareTokenSequences(vector_result.value(), result.expected_tokens))
+        << "Test " << result.test_name << " failed on " << run << " cache run:\n"
+        << BuildDetailedComparison(vector_result.value(), result.expected_tokens);
+    ASSERT_TRUE(CompareTokenSequences(buffer_tokens, result.expected_tokens))
+        << "Test " << result.test_name << " failed on " << run << " cache run on token buffer:\n"
+        << BuildDetailedComparison(buffer_tokens, result.expected_tokens);
+  }
+
+  std::filesystem::remove_all(params.token_cache_dir);
 }
 
 std::expected<std::vector<TokenPtr>, std::string> PreprocessorUnitTestSuite::TokenizeExpectedFile(
@@ -8,6 +8,7 @@
 
 #include <tokens/Token.hpp>
 
+#include "lib/preprocessor/PreprocessingParameters.hpp"
 #include "lib/preprocessor/PreprocessorError.hpp"
 
 namespace ovum::compiler::preprocessor {
@@ -25,6 +26,17 @@ public:
   static void RunSingleTest(const std::filesystem::path& input_file, const std::filesystem::path& expected_file);
 
 private:
+  // Runs the same case through the TokenBuffer pipeline, which must agree with the token vector pipeline.
+  static void RunBufferTest(const PreprocessingParameters& params, const TestResult& result);
+
+  // Runs the case with imports discovered on several threads, through both pipelines; tokens and errors must match
+  // the serial run.
+  static void RunParallelImportTest(PreprocessingParameters params, const TestResult& result);
+
+  // Runs the case twice through a fresh token cache directory, so imports are lexed on the first run and read back
+  // from the cache on the second.
+  static void RunTokenCacheTest(PreprocessingParameters params, const TestResult& result);
+
   static std::expected<std::vector<TokenPtr>, std::string> TokenizeExpectedFile(const std::filesystem::path& file_path);
 
   static bool CompareTokenSequences(const std::vector<TokenPtr>& actual, const std::vector<TokenPtr>& expected);
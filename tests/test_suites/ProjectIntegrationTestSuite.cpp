@@ -46,10 +46,42 @@ void ProjectIntegrationTestSuite::CompileAndCompareIntegrational(const std::stri
   CompileAndCompareFile(source_file, expected_output, actual_output, include_dir);
 }
 
+void ProjectIntegrationTestSuite::CompileAndCompareIntegrationalFromPreprocessed(
+    const std::string& filename_without_extension) {
+  std::filesystem::path source_dir = std::filesystem::path(TEST_DATA_DIR) / "integrational" / "positive" / "source";
+  std::filesystem::path compiled_dir = std::filesystem::path(TEST_DATA_DIR) / "integrational" / "positive" / "results";
+  std::filesystem::path include_dir = source_dir / "include";
+
+  std::filesystem::path source_file = source_dir / (filename_without_extension + ".ovum");
+  std::filesystem::path expected_output = compiled_dir / (filename_without_extension + ".oil");
+  std::filesystem::path token_file =
+      std::filesystem::path(kTemporaryDirectoryName) / (filename_without_extension + ".ovpp");
+  std::filesystem::path actual_output =
+      std::filesystem::path(kTemporaryDirectoryName) / (filename_without_extension + ".oil");
+
+  // Preprocess only
+  std::ostringstream cmd;
+  cmd << "ovumc -m " << source_file.string() << " -E " << token_file.string();
+
+  if (std::filesystem::exists(include_dir)) {
+    cmd << " -I " << include_dir.string();
+  }
+
+  std::ostringstream out;
+  std::ostringstream err;
+  ASSERT_EQ(StartCompilerConsoleUI(SplitString(cmd.str()), out, err), 0)
+      << "Preprocessing failed for " << source_file.string() << "\nError output: " << err.str();
+  ASSERT_TRUE(std::filesystem::exists(token_file)) << "Token file was not created: " << token_file.string();
+  ASSERT_FALSE(std::filesystem::exists(actual_output)) << "--emit-preprocessed must stop before code generation";
+
+  CompileAndCompareFile(token_file, expected_output, actual_output, {}, "-P");
+}
+
 void ProjectIntegrationTestSuite::CompileAndCompareFile(const std::filesystem::path& source_file,
                                                         const std::filesystem::path& expected_output_file,
                                                         const std::filesystem::path& actual_output_file,
-                                                        const std::filesystem::path& include_dir) {
+                                                        const std::filesystem::path& include_dir,
+                                                        const std::string& extra_arguments) {
   // Verify source file exists
   ASSERT_TRUE(std::filesystem::exists(source_file)) << "Source file does not exist: " << source_file.string();
 
@@ -65,6 +97,10 @@ void ProjectIntegrationTestSuite::CompileAndCompareFile(const std::filesystem::p
     cmd << " -I " << include_dir.string();
   }
 
+  if (!extra_arguments.empty()) {
+    cmd << " " << extra_arguments;
+  }
+
   // Run compiler
   std::ostringstream out;
   std::ostringstream err;
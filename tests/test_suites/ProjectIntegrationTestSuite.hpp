@@ -20,12 +20,16 @@ public:
   // Compile an integrational file with include directory and compare with expected output
   void CompileAndCompareIntegrational(const std::string& filename_without_extension);
 
+  // Same, but preprocess to a token file with --emit-preprocessed first and compile that with --from-preprocessed
+  void CompileAndCompareIntegrationalFromPreprocessed(const std::string& filename_without_extension);
+
 private:
   // Helper method to compile a file and compare output
   void CompileAndCompareFile(const std::filesystem::path& source_file,
                              const std::filesystem::path& expected_output_file,
                              const std::filesystem::path& actual_output_file,
-                             const std::filesystem::path& include_dir = {});
+                             const std::filesystem::path& include_dir = {},
+                             const std::string& extra_arguments = {});
 
   // Helper method to compare two files
   bool CompareFiles(const std::filesystem::path& file1, const std::filesystem::path& file2);
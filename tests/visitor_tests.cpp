@@ -1,8 +1,19 @@
 #include <gtest/gtest.h>
 
+#include <type_traits>
+#include <utility>
+
+#include "lib/parser/ast/nodes/base/NodeCasting.hpp"
+#include "lib/parser/ast/nodes/decls/ClassDecl.hpp"
+#include "lib/parser/ast/nodes/decls/FunctionDecl.hpp"
+#include "lib/parser/ast/nodes/exprs/literals/IntLit.hpp"
+#include "lib/parser/ast/nodes/stmts/Block.hpp"
+#include "lib/parser/ast/nodes/stmts/ReturnStmt.hpp"
 #include "lib/parser/ast/visitors/LintVisitor.hpp"
 #include "lib/parser/ast/visitors/StructuralValidator.hpp"
 #include "lib/parser/ast/visitors/TypeChecker.hpp"
+#include "lib/parser/tokens/SourceId.hpp"
+#include "lib/parser/tokens/SourceSpan.hpp"
 #include "test_suites/VisitorTestSuite.hpp"
 
 using namespace ovum::compiler::parser;
@@ -2733,3 +2744,74 @@ TEST_F(VisitorTestSuite, TypeChecker_ValidInterfaceWithVoidMethods) {
     EXPECT_FALSE(found_error) << "Should not have type errors for interface with void methods";
   }
 }
+
+TEST_F(VisitorTestSuite, NodeKind_CastsFollowKindTags) {
+  auto module = Parse(R"(
+  fun answer(): int {
+    return 42
+  }
+)");
+  ASSERT_NE(module, nullptr);
+  ASSERT_EQ(module->Decls().size(), 1U);
+  EXPECT_EQ(module->Kind(), NodeKind::kModule);
+  EXPECT_FALSE(Isa<Decl>(*module));
+
+  Decl* decl = module->MutableDecls().front().get();
+  EXPECT_TRUE(Isa<Decl>(decl));
+  EXPECT_TRUE(Isa<FunctionDecl>(decl));
+  EXPECT_FALSE(Isa<Stmt>(decl));
+  EXPECT_EQ(DynCast<ClassDecl>(decl), nullptr);
+  EXPECT_FALSE(Isa<FunctionDecl>(static_cast<Decl*>(nullptr)));
+  EXPECT_EQ(DynCast<FunctionDecl>(static_cast<Decl*>(nullptr)), nullptr);
+
+  const FunctionDecl& function = Cast<FunctionDecl>(std::as_const(*decl));
+  ASSERT_NE(function.Body(), nullptr);
+  ASSERT_EQ(function.Body()->GetStatements().size(), 1U);
+  const Stmt* stmt = function.Body()->GetStatements().front().get();
+  EXPECT_TRUE(Isa<Stmt>(stmt));
+  EXPECT_FALSE(Isa<Expr>(stmt));
+
+  const auto* ret = DynCast<ReturnStmt>(stmt);
+  ASSERT_NE(ret, nullptr);
+  const auto* value = DynCast<IntLit>(ret->Value());
+  ASSERT_NE(value, nullptr);
+  EXPECT_TRUE(Isa<Expr>(value));
+  EXPECT_EQ(value->Value(), 42);
+}
+
+TEST_F(VisitorTestSuite, SourceId_KeepsSpansTrivial) {
+  static_assert(std::is_trivially_copyable_v<SourceSpan>);
+  EXPECT_EQ(sizeof(SourceId), sizeof(std::uint32_t));
+
+  const SourceId main(1);
+  const SourceId lib(2);
+  EXPECT_TRUE(main.IsValid());
+  EXPECT_NE(main, lib);
+  EXPECT_EQ(SourceId(1), main);
+  EXPECT_FALSE(SourceId{}.IsValid());
+
+  auto module = Parse(R"(
+  fun first(): int {
+    return 1
+  }
+  fun second(): int {
+    return 2
+  }
+)");
+  ASSERT_NE(module, nullptr);
+  ASSERT_EQ(module->Decls().size(), 2U);
+  const SourceSpan& first_span = module->Decls()[0]->Span();
+  const SourceSpan& second_span = module->Decls()[1]->Span();
+  ASSERT_LT(first_span.GetEnd(), second_span.GetEnd());
+
+  const SourceSpan first(main, first_span.GetStart(), first_span.GetEnd());
+  const SourceSpan second(main, second_span.GetStart(), second_span.GetEnd());
+  const SourceSpan joined = SourceSpan::Union(first, second);
+  EXPECT_EQ(joined.GetSourceId(), main);
+  EXPECT_EQ(joined.GetStart(), first.GetStart());
+  EXPECT_EQ(joined.GetEnd(), second.GetEnd());
+
+  // Spans of different sources do not merge.
+  const SourceSpan elsewhere(lib, second_span.GetStart(), second_span.GetEnd());
+  EXPECT_EQ(SourceSpan::Union(first, elsewhere).GetEnd(), first.GetEnd());
+}